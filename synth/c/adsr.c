@@ -22,6 +22,31 @@
 #include <adsr.h>
 #include <synth-stdio.h>
 
+/* adsr_recip() - calculate m and s such that x / d == (x * m) >> s for 0 <= x < 2^30
+ *
+ * With 2^k <= d < 2^(k+1), s = 31 + k and m = 2^s / d + 1, which is less than 2^32.
+ * m exceeds 2^s / d by at most 1, so x * m / 2^s exceeds x / d by less than x / 2^s. For x < 2^30
+ * that's less than 1 / 2^(k+1), which is less than 1/d, so the integer part is unchanged.
+ * d <= 0 gives m = 0.
+*/
+static void adsr_recip(dv_i32_t d, dv_u32_t *m, dv_u32_t *s)
+{
+	int k = 0;
+
+	if ( d <= 0 )
+	{
+		*m = 0;
+		*s = 0;
+		return;
+	}
+
+	while ( (2 << k) <= d )
+		k++;
+
+	*s = 31 + k;
+	*m = (dv_u32_t)(((dv_u64_t)1 << *s) / (dv_u64_t)d + 1);
+}
+
 /* adsr_init() - configures the specified adsr structure with its four parameters
 */
 void adsr_init(struct adsr_s *adsr, dv_i32_t a, dv_i32_t d, dv_i32_t s, dv_i32_t r, dv_i32_t sps)
@@ -42,6 +67,9 @@ void adsr_init(struct adsr_s *adsr, dv_i32_t a, dv_i32_t d, dv_i32_t s, dv_i32_t
 	adsr->tSustain = adsr->tAttack + adsr->tDecay;
 	adsr->tTotal = adsr->tAttack + adsr->tDecay + adsr->tRelease;
 
+	adsr_recip(adsr->tAttack, &adsr->mAttack, &adsr->sAttack);
+	adsr_recip(adsr->tDecay, &adsr->mDecay, &adsr->sDecay);
+
 	sy_printf("adsr_init(): A = %d, D = %d, S = %d, R = %d\n",
 				adsr->a, adsr->d, adsr->s, adsr->r);
 	sy_printf("adsr_init(): tAttack = %d, tDecay = %d, gSustain = %d, tRelease = %d\n",
@@ -58,6 +86,7 @@ void adsr_set_a(struct adsr_s *adsr, dv_i32_t a, dv_i32_t sps)
 	adsr->tAttack = (sps * a)/ADSR_AMAX;
 	adsr->tSustain = adsr->tAttack + adsr->tDecay;
 	adsr->tTotal = adsr->tAttack + adsr->tDecay + adsr->tRelease;
+	adsr_recip(adsr->tAttack, &adsr->mAttack, &adsr->sAttack);
 }
 
 void adsr_set_d(struct adsr_s *adsr, dv_i32_t d, dv_i32_t sps)
@@ -66,6 +95,7 @@ void adsr_set_d(struct adsr_s *adsr, dv_i32_t d, dv_i32_t sps)
 	adsr->tDecay = (sps * d)/ADSR_AMAX;
 	adsr->tSustain = adsr->tAttack + adsr->tDecay;
 	adsr->tTotal = adsr->tAttack + adsr->tDecay + adsr->tRelease;
+	adsr_recip(adsr->tDecay, &adsr->mDecay, &adsr->sDecay);
 }
 
 void adsr_set_s(struct adsr_s *adsr, dv_i32_t s, dv_i32_t sps)
@@ -86,85 +116,11 @@ void adsr_set_r(struct adsr_s *adsr, dv_i32_t r, dv_i32_t sps)
 */
 dv_i32_t envelope_gen(struct envelope_s *env)
 {
-	if ( env->position < 0 )
-	{
-#if 0
-		env->state = 'x';
-#endif
-		return 0;					/* Not in use */
-	}
-
-	struct adsr_s *adsr = env->adsr;
-
-	if ( env->position < adsr->tAttack )
-	{
-		/* Attack phase
-		*/
-		env->position++;
-		dv_i32_t v = (ADSR_GMAX * env->position) / adsr->tAttack;
-#if 0
-		if ( env->state != 'a' )
-		{
-			env->state = 'a';
-			sy_printf("Attack: %d, %d\n", env->position, v);
-		}
-#endif
-		return v;
-	}
-
-	if ( env->position < adsr->tSustain )
-	{
-		/* Attack phase
-		*/
-		env->position++;
-		dv_i32_t v = adsr->gSustain + (adsr->gDecay * (env->position - adsr->tAttack)) / adsr->tDecay;
-#if 0
-		if ( env->state != 'd' )
-		{
-			env->state = 'd';
-			sy_printf("Decay: %d, %d\n", env->position, v);
-		}
-#endif
-		return v;
-	}
-
-	if ( env->position == adsr->tSustain )
-	{
-		/* Attack phase
-		*/
-#if 0
-		if ( env->state != 's' )
-		{
-			env->state = 's';
-			sy_printf("Sustain: %d\n", adsr->gSustain);
-		}
-#endif
-		return adsr->gSustain;
-	}
-
-	env->position++;
-
-	if ( env->position <= adsr->tTotal )
-	{
-		/* Release phase
-		*/
-		dv_i32_t v = adsr->gSustain * (env->position - adsr->tSustain) / adsr->tDecay;
-#if 0
-		if ( env->state != 'r' )
-		{
-			env->state = 'r';
-			sy_printf("Release: %d\n", v);
-		}
-#endif
-		return v;
-	}
+	dv_i32_t v = adsr_gen(env->adsr, &env->position);
 
-	/* End of release phase
-	*/
 #if 0
-	sy_printf("Envelope finished %d\n", env->position);
-	env->state = 'x';
+	if ( env->position < 0 )
+		sy_printf("Envelope finished\n");
 #endif
-	env->position = -1;
-	return 0;
+	return v;
 }
@@ -38,7 +38,10 @@ static dv_u32_t tmin;
 void effect_adc_init(struct effect_s *e)
 {
 	e->func = &effect_adc_input;
+	e->blockfunc = DV_NULL;
+	e->framefunc = &effect_adc_frame;
 	e->control = &effect_adc;
+	e->control_size = sizeof(effect_adc);
 	e->name = "adc";
 	effect_adc.select = 1;
 	effect_adc.pace = 0;
@@ -53,8 +56,7 @@ void effect_adc_init(struct effect_s *e)
  * Two input channels are read. One is returned as the generator's output.
  * The other is ignored.
  *
- * Future: feed the second channel into a message queue so to permit two-channel
- * operation.
+ * This is the mono version; the effect processor uses effect_adc_frame() for two-channel operation.
 */
 dv_i64_t effect_adc_input(struct effect_s *e, dv_i64_t unused_signal)
 {
@@ -89,3 +91,21 @@ dv_i64_t effect_adc_input(struct effect_s *e, dv_i64_t unused_signal)
 
 	return (dv_i64_t)(adc->select ? right : left);
 }
+
+/* effect_adc_frame() - read a block of stereo input from ADC
+ *
+ * The left channel goes to channel 0 and the right to channel 1. The block's input is ignored.
+*/
+void effect_adc_frame(struct effect_s *e, struct effect_block_s *b, int n)
+{
+	for ( int i = 0; i < n; i++ )
+	{
+		dv_i32_t left, right;
+
+		dv_pcm_read(&left);
+		dv_pcm_read(&right);
+
+		b->s[0][i] = (dv_i64_t)left;
+		b->s[1][i] = (dv_i64_t)right;
+	}
+}
@@ -19,6 +19,7 @@
 */
 #include <dv-config.h>
 #include <davroska.h>
+#include <synth-config.h>
 
 #include <effect.h>
 #include <effect-dac.h>
@@ -34,13 +35,30 @@ struct effect_dac_s effect_dac;
 void effect_dac_init(struct effect_s *e)
 {
 	e->func = &effect_dac_output;
+	e->blockfunc = DV_NULL;
+	e->framefunc = &effect_dac_frame;
 	e->control = &effect_dac;
+	e->control_size = sizeof(effect_dac);
 	e->name = "dac";
 	effect_dac.select = 1;
 	effect_dac.max = 2147483647L;
 	effect_dac.min = -2147483647L;
 }
 
+/* effect_dac_clip() - clip a signal so that it lies between min and max.
+ *
+ * Temporary: divide the output values by 2 until I find out why the DAC doesn't see the first bit.
+*/
+static inline dv_i32_t effect_dac_clip(struct effect_dac_s *dac, dv_i64_t signal)
+{
+	if ( signal > dac->max )
+		signal = dac->max;
+	else if ( signal < dac->min )
+		signal = dac->min;
+
+	return (dv_i32_t)(signal/2);
+}
+
 /* effect_dac_output() - write signal to DAC
  *
  * This pseudo-effect generator writes a signal to the DAC. It generates a zero output signal.
@@ -49,41 +67,73 @@ void effect_dac_init(struct effect_s *e)
  *	- the selected channel is written with the input signal clipped to 32 bits
  *	- the other channel is written with zero
  *
- * Future: feed the unselected channel from a message queue so to permit two-channel operation.
+ * This is the mono version; the effect processor uses effect_dac_frame() for two-channel operation.
 */
 dv_i64_t effect_dac_output(struct effect_s *e, dv_i64_t signal)
 {
 	struct effect_dac_s *dac = (struct effect_dac_s *)e->control;
 	dv_i32_t left = 0, right = 0;
 
-	/* Clip the input so that it lies between min and max.
-	*/
-	if ( signal > dac->max )
-		signal = dac->max;
-	else if ( signal < dac->min )
-		signal = dac->min;
-
-	/* Select the signal into either right or left
-	 *
-	 * Temporary: divide the output values by 2 until I find out why the DAC doesn't see the first bit.
+	/* Select the clipped signal into either right or left
 	*/
 	if ( dac->select )
 	{
-		right = (dv_i32_t)(signal/2);
+		right = effect_dac_clip(dac, signal);
 	}
 	else
 	{
-		left = (dv_i32_t)(signal/2);
+		left = effect_dac_clip(dac, signal);
 	}
 
-	monitor_start(&core1_idle);
+	struct monitor_elapsed_s *idle = monitor_idle(dv_get_coreidx());
+
+	monitor_start(idle);
 
 	/* Write the values to the DAC.
 	*/
 	dv_pcm_write(left);
 	dv_pcm_write(right);
 
-	monitor_elapsed(&core1_idle, monitor_frc());
+	monitor_elapsed(idle, monitor_frc());
 	
 	return 0;
 }
+
+/* effect_dac_frame() - write a block of stereo signal to DAC
+ *
+ * Channel 0 is written to the left DAC channel and channel 1 to the right. The select
+ * setting is only used by the mono effect_dac_output().
+ * The whole block is clipped first, then written. The block is zeroed on return.
+ * The timing of the writes is used to detect missed deadlines and FIFO underruns.
+*/
+void effect_dac_frame(struct effect_s *e, struct effect_block_s *b, int n)
+{
+	struct effect_dac_s *dac = (struct effect_dac_s *)e->control;
+	struct monitor_elapsed_s *idle = monitor_idle(dv_get_coreidx());
+	dv_i32_t left[EFFECT_BLOCK_LEN];
+	dv_i32_t right[EFFECT_BLOCK_LEN];
+	dv_u32_t t_ready, now;
+
+	for ( int i = 0; i < n; i++ )
+	{
+		left[i] = effect_dac_clip(dac, b->s[0][i]);
+		right[i] = effect_dac_clip(dac, b->s[1][i]);
+		b->s[0][i] = 0;
+		b->s[1][i] = 0;
+	}
+
+	t_ready = monitor_frc();
+	idle->last = t_ready;
+
+	/* Write the values to the DAC.
+	*/
+	for ( int i = 0; i < n; i++ )
+	{
+		dv_pcm_write(left[i]);
+		dv_pcm_write(right[i]);
+	}
+
+	now = monitor_frc();
+	monitor_elapsed(idle, now);
+	monitor_xrun_check(&dac_xrun, t_ready, now, n);
+}
@@ -0,0 +1,116 @@
+/*	effect-pipe.c - inter-core pipeline stages
+ *
+ *	Copyright 2026 David Haworth
+ *
+ *	This file is part of SynthEffect.
+ *
+ *	SynthEffect is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	SynthEffect is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with SynthEffect.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <dv-config.h>
+#include <davroska.h>
+#include <synth-config.h>
+
+#include <effect.h>
+#include <effect-pipe.h>
+#include <monitor.h>
+
+/* effect_pipe_init() - initialise a pipe stage that passes blocks to the given core
+ *
+ * The pipe's FIFO is primed with EFFECT_PIPE_LATENCY blocks of silence.
+*/
+void effect_pipe_init(struct effect_s *e, struct effect_pipe_s *p, dv_i32_t core)
+{
+	e->func = &effect_pipe_passthru;
+	e->blockfunc = DV_NULL;
+	e->framefunc = &effect_pipe_send;
+	e->control = p;
+	e->control_size = 0;			/* The FIFO stays where it is */
+	e->name = "pipe";
+
+	p->core = core;
+	p->head = 0;
+	p->tail = EFFECT_PIPE_LATENCY;
+
+	for ( int b = 0; b < EFFECT_PIPE_LEN; b++ )
+	{
+		for ( int c = 0; c < EFFECT_N_CHANNELS; c++ )
+		{
+			for ( int i = 0; i < EFFECT_BLOCK_LEN; i++ )
+				p->block[b].s[c][i] = 0;
+		}
+	}
+}
+
+/* effect_pipe_passthru() - a pipe in a single-core (per-sample) chain does nothing
+*/
+dv_i64_t effect_pipe_passthru(struct effect_s *e, dv_i64_t signal)
+{
+	return signal;
+}
+
+/* effect_pipe_send() - push a block into the FIFO
+ *
+ * Waits if the FIFO is full. The block is copied before the tail is advanced, so the consumer
+ * never sees a partial block.
+*/
+void effect_pipe_send(struct effect_s *e, struct effect_block_s *b, int n)
+{
+	struct effect_pipe_s *p = (struct effect_pipe_s *)e->control;
+	dv_u32_t tail = p->tail;
+
+	while ( (tail - p->head) >= EFFECT_PIPE_LEN )
+	{
+		/* Wait for the consumer */
+	}
+	dv_barrier();
+
+	struct effect_block_s *blk = &p->block[tail % EFFECT_PIPE_LEN];
+	for ( int c = 0; c < EFFECT_N_CHANNELS; c++ )
+	{
+		for ( int i = 0; i < n; i++ )
+			blk->s[c][i] = b->s[c][i];
+	}
+
+	dv_barrier();
+	p->tail = tail + 1;
+}
+
+/* effect_pipe_receive() - pull a block from the FIFO
+ *
+ * Waits if the FIFO is empty. The waiting time is recorded as idle time.
+*/
+void effect_pipe_receive(struct effect_s *e, struct effect_block_s *b, int n)
+{
+	struct effect_pipe_s *p = (struct effect_pipe_s *)e->control;
+	dv_u32_t head = p->head;
+	struct monitor_elapsed_s *idle = monitor_idle(dv_get_coreidx());
+
+	monitor_start(idle);
+	while ( p->tail == head )
+	{
+		/* Wait for the producer */
+	}
+	monitor_elapsed(idle, monitor_frc());
+	dv_barrier();
+
+	struct effect_block_s *blk = &p->block[head % EFFECT_PIPE_LEN];
+	for ( int c = 0; c < EFFECT_N_CHANNELS; c++ )
+	{
+		for ( int i = 0; i < n; i++ )
+			b->s[c][i] = blk->s[c][i];
+	}
+
+	dv_barrier();
+	p->head = head + 1;
+}
@@ -28,87 +28,1019 @@
 #include <wave.h>
 
 #include <synth-stdio.h>
+#include <monitor.h>
 
-struct adsr_s note_adsr;
+struct synth_patch_s synth_patch[SYNTH_N_PARTS];
+struct synth_alloc_s synth_alloc;
 struct effect_synth_s synth;
-struct effect_synth_mono_s notegen[MAX_POLYPHONIC];
+struct synth_voicebank_s voice;
 
-static void synth_start_note(dv_i32_t midi_note);
-static void synth_stop_note(dv_i32_t midi_note);
-static struct effect_synth_mono_s *synth_find_generator(dv_i32_t midi_note);
+#if SYNTH_VOICE_WORKERS > 0
+struct synth_worker_s synth_worker[SYNTH_VOICE_WORKERS];
+#endif
+
+/* The synth's effect stage. The control block is moved when the effect chain is compiled,
+ * so it must always be accessed via the stage's control pointer.
+*/
+static struct effect_s *synth_effect;
+
+static void synth_start_note(struct effect_synth_s *sy, int p, dv_u32_t note);
+static void synth_stop_note(struct effect_synth_s *sy, int p, dv_i32_t midi_note);
+static int synth_alloc_voice(struct effect_synth_s *sy, int p, dv_u32_t note, int *fade);
+static void synth_free_voice(struct effect_synth_s *sy, int v);
+static void synth_steal_unlink(struct synth_part_s *pt, int v);
+static void synth_reclaim(struct effect_synth_s *sy, dv_boolean_t post);
+static void synth_layout(struct effect_synth_s *sy, dv_boolean_t post);
+static void synth_alloc_build(struct effect_synth_s *sy, int p, const dv_u8_t *moved);
+
+/* synth_voice_patch() - return the patch of the part that a voice belongs to
+*/
+static inline struct synth_patch_s *synth_voice_patch(int v)
+{
+	return &synth_patch[voice.part[v / SYNTH_LANES]];
+}
+
+/* synth_unison() - return the no. of oscillators per note of a patch (1 to SYNTH_LANES)
+*/
+static inline int synth_unison(struct synth_patch_s *pa)
+{
+	int n_osc = pa->unison;			/* Core 0 can change it at any time */
+
+	if ( n_osc < 1 )
+		return 1;
+	if ( n_osc > SYNTH_LANES )
+		return SYNTH_LANES;
+	return n_osc;
+}
+
+/* synth_detune() - return a phase increment raised by cents/256 cents
+ *
+ * Whole octaves are shifts. 2^(c/1200) for the remaining -600 to 600 cents is computed as e^x
+ * with x = c * ln(2) / 1200, using the first five terms of the series. The error is less than
+ * 0.1 cent. All the scaling is done with arithmetic shifts, so that negative detunes are rounded
+ * in the same direction as positive ones.
+*/
+static dv_u32_t synth_detune(dv_u32_t incr, dv_i32_t cents)
+{
+	int octave = 0;
+
+	while ( cents >= 600 * 256 )
+	{
+		cents -= 1200 * 256;
+		octave++;
+	}
+	while ( cents < -600 * 256 )
+	{
+		cents += 1200 * 256;
+		octave--;
+	}
+
+	dv_i64_t x = ((dv_i64_t)cents * 38766) >> 10;		/* 2^24 * ln(2) / (1200 * 256) = 37.857 */
+	dv_i64_t x2 = (x * x) >> 24;
+	dv_i64_t x3 = (x2 * x) >> 24;
+	dv_i64_t x4 = (x3 * x) >> 24;
+	dv_i64_t ratio = (1 << 24) + x + x2 / 2 + x3 / 6 + x4 / 24;
+	dv_u64_t detuned = ((dv_u64_t)incr * (dv_u64_t)ratio) >> 24;
+
+	detuned = (octave >= 0) ? (detuned << octave) : (detuned >> -octave);
+	if ( detuned > 0xffffffffu )
+		detuned = 0xffffffffu;
+	return (dv_u32_t)detuned;
+}
+
+/* synth_voice_tune() - set the phase increments of a voice for its note, raised by cents
+ *
+ * The oscillators of a unison note are spread evenly over the patch's detune around the pitch.
+ * Each oscillator reads the level of the wave table for its increment, so that it doesn't alias.
+*/
+static void synth_voice_tune(int v, dv_i32_t cents)
+{
+	struct synth_patch_s *pa = synth_voice_patch(v);
+	int n_osc = voice.n_osc[v / SYNTH_LANES];
+	dv_u32_t incr = wave_incr[voice.midi_note[v]];
+
+	voice.cents[v] = cents;
+
+	for ( int k = 0; k < n_osc; k++ )
+	{
+		dv_i32_t c = cents * 256;
+
+		if ( n_osc > 1 )
+			c += (pa->detune * 256 * (2 * k - (n_osc - 1))) / (2 * (n_osc - 1));
+
+		dv_u32_t osc_incr = (c == 0) ? incr : synth_detune(incr, c);
+		int l = wave_level(osc_incr);
+
+		voice.incr[v+k] = osc_incr;
+		voice.table[v+k] = voice.wave[v]->level[l];
+		voice.shift[v+k] = voice.wave[v]->shift[l];
+	}
+}
+
+/* synth_modulate_voice() - evaluate the modulation matrix for a voice
+ *
+ * Sets the voice's pitch and the amplitude that it ramps to over the next n samples. n == 0 ==>
+ * the voice is starting: the amplitude is set at once and the pitch is always set.
+ * The part's sources must be up to date (see synth_modulate()).
+*/
+static void synth_modulate_voice(struct effect_synth_s *sy, int v, int n)
+{
+	int p = voice.part[v / SYNTH_LANES];
+	struct synth_patch_s *pa = &synth_patch[p];
+	struct synth_part_s *pt = &sy->part[p];
+	dv_i32_t amp = SYNTH_AMP1;
+	dv_i32_t cents = 0;
+
+	for ( int i = 0; i < SYNTH_MOD_SLOTS; i++ )
+	{
+		struct synth_mod_s *m = &pa->mod[i];
+		dv_i32_t x;
+
+		if ( m->amount == 0 || m->source == SYNTH_MOD_NONE )
+			continue;
+
+		if ( m->source == SYNTH_MOD_VELOCITY )
+			x = voice.velocity[v];
+		else if ( m->source == SYNTH_MOD_ENVELOPE )
+			x = voice.gain[v];
+		else
+			x = pt->src[m->source];
+
+		if ( m->dest == SYNTH_DEST_PITCH )
+		{
+			cents += (m->amount * x * SYNTH_MOD_CENTS) / SYNTH_MOD1;
+		}
+		else if ( m->dest == SYNTH_DEST_AMP )
+		{
+			if ( m->source == SYNTH_MOD_LFO1 || m->source == SYNTH_MOD_LFO2 )
+				x = (x + SYNTH_MOD1) / 2;
+
+			if ( m->amount > 0 )
+				amp -= m->amount * (SYNTH_MOD1 - x) * (SYNTH_AMP1 / (SYNTH_MOD1 * SYNTH_MOD1));
+			else
+				amp += m->amount * x * (SYNTH_AMP1 / (SYNTH_MOD1 * SYNTH_MOD1));
+		}
+	}
+
+	if ( amp < 0 )
+		amp = 0;
+
+	/* An octave above the highest note is still well within the range of the phase increment
+	*/
+	if ( cents > 1200 )
+		cents = 1200;
+	else if ( cents < -1200 )
+		cents = -1200;
+
+	if ( n == 0 )
+	{
+		voice.amp[v] = amp;
+		voice.amp_step[v] = 0;
+		synth_voice_tune(v, cents);
+	}
+	else
+	{
+		voice.amp_step[v] = (amp - voice.amp[v]) / n;
+
+		if ( cents != voice.cents[v] )
+			synth_voice_tune(v, cents);
+	}
+}
+
+/* synth_lfo() - return the value of a triangle LFO at a phase (-SYNTH_MOD1 to SYNTH_MOD1-1)
+*/
+static inline dv_i32_t synth_lfo(dv_u32_t phase)
+{
+	dv_i32_t x = (dv_i32_t)(phase >> 23);			/* 0 to 511 */
+
+	return ((x < 256) ? x : 511 - x) - SYNTH_MOD1;
+}
+
+/* synth_modulate() - evaluate the modulation matrix of every sounding voice for the next n samples
+ *
+ * This is the control rate: it's done once per block, on core 1, before the voices are rendered.
+ * First each part's LFOs are advanced and its sources are read.
+*/
+static void synth_modulate(struct effect_synth_s *sy, int n)
+{
+	for ( int p = 0; p < SYNTH_N_PARTS; p++ )
+	{
+		struct synth_part_s *pt = &sy->part[p];
+		struct synth_patch_s *pa = &synth_patch[p];
+
+		if ( pt->n_poly <= 0 )
+			continue;
+
+		pt->src[SYNTH_MOD_PRESSURE] = (pt->pressure * SYNTH_MOD1) / 127;
+		pt->src[SYNTH_MOD_WHEEL] = (pt->wheel * SYNTH_MOD1) / 127;
+
+		for ( int k = 0; k < 2; k++ )
+		{
+			pt->lfo_phase[k] += pa->lfo_incr[k] * (dv_u32_t)n;
+			pt->src[SYNTH_MOD_LFO1 + k] = synth_lfo(pt->lfo_phase[k]);
+		}
+	}
+
+	for ( int g = 0; g < sy->n_groups; g++ )
+	{
+		dv_u32_t lanes = voice.lanes[g];
+
+		while ( lanes != 0 )
+		{
+			int l = __builtin_ctz(lanes);
+
+			lanes &= lanes - 1;
+			synth_modulate_voice(sy, g * SYNTH_LANES + l, n);
+		}
+	}
+}
+
+/* synth_voice_start() - start a voice playing the note that has been allocated to it
+ *
+ * In a unison group the voice is lane 0, which holds the envelope of all the note's oscillators.
+ * Their phases are spread evenly so that they don't all peak together at the start of the note.
+*/
+static inline void synth_voice_start(struct effect_synth_s *sy, int v)
+{
+	int n_osc = voice.n_osc[v / SYNTH_LANES];
+
+	voice.age[v] = 0;
+	voice.gain[v] = 0;
+	voice.fade[v] = 0;
+	voice.env_pos[v] = 0;
+	voice.wave[v] = synth_voice_patch(v)->wave;
+
+	synth_modulate_voice(sy, v, 0);
+
+	for ( int k = 0; k < n_osc; k++ )
+		voice.phase[v+k] = (n_osc > 1) ? (dv_u32_t)(((dv_u64_t)k << 32) / n_osc) : -voice.incr[v];
+
+	synth_voice_on(v);
+}
+
+/* synth_voice_fade() - start the fast release of a voice that has been stolen
+ *
+ * The gain falls from its current level to zero in SYNTH_FADE_LEN samples, whatever the phase
+ * of the envelope. Nothing happens if the voice has already finished.
+*/
+static inline void synth_voice_fade(int v)
+{
+	if ( voice.env_pos[v] >= 0 && voice.fade[v] == 0 )
+	{
+		voice.fade_gain[v] = voice.gain[v];
+		voice.fade[v] = SYNTH_FADE_LEN;
+	}
+}
+
+/* synth_retire() - silence a voice now
+ *
+ * If post is set, the voice's worker silences it as the first event of the block. Otherwise
+ * (no workers, or the per-sample path) it's done here.
+*/
+static void synth_retire(struct effect_synth_s *sy, int v, dv_boolean_t post)
+{
+#if SYNTH_VOICE_WORKERS > 0
+	if ( post )
+	{
+		struct synth_worker_s *wk = &synth_worker[synth_voice_owner(v)];
+
+		wk->event[wk->n_events++] = ((dv_u32_t)v << SYNTH_EV_VOICE) | SYNTH_EV_RETIRE;
+		return;
+	}
+#endif
+	synth_voice_off(v);
+}
+
+/* synth_n_used() - return the no. of notes of all the parts that are on the steal lists
+*/
+static int synth_n_used(struct effect_synth_s *sy)
+{
+	int n = 0;
+
+	for ( int p = 0; p < SYNTH_N_PARTS; p++ )
+		n += sy->part[p].n_used;
+
+	return n;
+}
+
+#if SYNTH_GOVERNOR
+/* synth_shed() - choose a voice to shed if more voices are sounding than the governor allows
+ *
+ * The quietest releasing voice is chosen or, if none is releasing, the quietest voice.
+ * Ties go to the oldest. Voices that are fading out after being stolen are left alone.
+ * Returns -1 if no voice needs to be shed.
+*/
+static int synth_shed(struct effect_synth_s *sy)
+{
+	int victim = -1;
+	dv_boolean_t v_rel = 0;
+	dv_i32_t v_level = 0;
+	int n_sounding = 0;
+
+	if ( sy->n_limit >= sy->n_polyphonic )
+		return -1;
+
+	/* Only the voices that the allocator knows about: the ones in the layout that are allocated.
+	*/
+	for ( int g = 0; g < sy->n_groups; g++ )
+	{
+		dv_u32_t lanes = voice.lanes[g] & synth_alloc.used[g];
+
+		while ( lanes != 0 )
+		{
+			int v = g * SYNTH_LANES + __builtin_ctz(lanes);
+
+			lanes &= lanes - 1;
+
+			if ( synth_alloc.reserved[v] )
+				continue;
+
+			n_sounding++;
+
+			dv_boolean_t rel = voice.env_pos[v] > synth_voice_patch(v)->adsr.tSustain;
+			dv_i32_t level = voice.gain[v];
+
+			if ( victim < 0 || (rel && !v_rel) ||
+				 (rel == v_rel && (level < v_level || (level == v_level && voice.age[v] > voice.age[victim]))) )
+			{
+				victim = v;
+				v_rel = rel;
+				v_level = level;
+			}
+		}
+	}
+
+	if ( n_sounding <= sy->n_limit )
+		return -1;
+
+	sy->n_shed++;
+	return victim;
+}
+
+/* synth_fade_out() - fade out a voice that the governor has shed
+ *
+ * The voice comes off its part's steal list and is reserved, as a stolen voice is, so that it gets
+ * the same fast release instead of being cut off with a click. synth_reclaim() frees it when the
+ * fast release has finished. If post is set, the voice's worker starts the fast release as the
+ * first event of the block. Otherwise it's done here.
+*/
+static void synth_fade_out(struct effect_synth_s *sy, int v, dv_boolean_t post)
+{
+	struct synth_alloc_s *a = &synth_alloc;
+	int p = voice.part[v / SYNTH_LANES];
+
+	synth_steal_unlink(&sy->part[p], v);
+	if ( a->note_voice[p][voice.midi_note[v]] == v )
+		a->note_voice[p][voice.midi_note[v]] = -1;
+	a->reserved[v] = 1;
+
+#if SYNTH_VOICE_WORKERS > 0
+	if ( post )
+	{
+		struct synth_worker_s *wk = &synth_worker[synth_voice_owner(v)];
+
+		wk->event[wk->n_events++] = ((dv_u32_t)v << SYNTH_EV_VOICE) | SYNTH_EV_FADE;
+		return;
+	}
+#endif
+	synth_voice_fade(v);
+}
+
+/* synth_govern() - adjust the voice limit according to the time taken by the last block
+ *
+ * Nothing is printed here because it runs in the audio path; the monitor task reports what the
+ * governor has done (see synth_print_governor()). The monitor runs once a second but takes its
+ * reports in turn, so the governor's report comes only every 10 seconds.
+*/
+static void synth_govern(struct effect_synth_s *sy, dv_u32_t t, int n)
+{
+	dv_u32_t budget = n * MONITOR_TICKS_PER_SAMPLE;
+
+	if ( t > (budget / 100) * SYNTH_GOV_HIGH )
+	{
+		int limit = synth_n_used(sy);
+
+		sy->gov_calm = 0;
+
+		if ( limit > sy->n_limit )
+			limit = sy->n_limit;
+		limit--;
+		if ( limit < SYNTH_GOV_MIN )
+			limit = SYNTH_GOV_MIN;
+
+		if ( limit < sy->n_limit )
+		{
+			sy->n_limit = limit;
+			sy->n_lowered++;
+		}
+	}
+	else if ( t < (budget / 100) * SYNTH_GOV_LOW )
+	{
+		if ( sy->n_limit < sy->n_polyphonic && ++sy->gov_calm >= SYNTH_GOV_HOLD )
+		{
+			sy->gov_calm = 0;
+			sy->n_limit++;
+		}
+	}
+	else
+	{
+		sy->gov_calm = 0;
+	}
+}
+
+/* synth_print_governor() - report the governor's state if it has acted since the last report
+ *
+ * Called by the monitor task every 10 seconds (one pass in ten; see Monitor_main()). The counters
+ * only ever increase, so they are compared with the values that were last reported.
+*/
+void synth_print_governor(void)
+{
+	static dv_u32_t last_lowered;
+	static dv_u32_t last_shed;
+	struct effect_synth_s *sy;
+	dv_u32_t n_lowered, n_shed;
+
+	if ( synth_effect == DV_NULL )
+		return;
+
+	sy = (struct effect_synth_s *)synth_effect->control;
+	n_lowered = sy->n_lowered;
+	n_shed = sy->n_shed;
+
+	if ( n_lowered != last_lowered || n_shed != last_shed || sy->n_limit < sy->n_polyphonic )
+	{
+		sy_printf("synth: voice limit %d of %d, lowered %u times, %u voices shed\n",
+					sy->n_limit, sy->n_polyphonic, n_lowered - last_lowered, n_shed - last_shed);
+		last_lowered = n_lowered;
+		last_shed = n_shed;
+	}
+}
+#endif
+
+/* synth_peek_event() - look at the next note message of a part that's due in this block
+ *
+ * The block started at "now" and the previous one at "base". The messages that were sent between
+ * the two are due; each one takes effect at the sample offset that corresponds to its time since
+ * base. So every note starts exactly one block after it was sent, however many messages there are.
+ * A message that's older than base is late and takes effect at offset 0. That includes a message
+ * that's so old (more than 67 ms) that its time stamp has wrapped and appears to be in the future:
+ * a message can only be pending if it was sent within one block period after now.
+ *
+ * Returns the offset (< n), with the message in *note. Returns -1 if the part's queue is empty or
+ * the next message isn't due yet.
+*/
+static int synth_peek_event(int p, dv_u32_t base, dv_u32_t now, int n, dv_u32_t *note)
+{
+	struct notequeue_s *nq = &notechannels.nq[p];
+	dv_rbm_t *rbm = &nq->rbm;
+	dv_i32_t t;
+	int offset;
+
+	if ( dv_rb_empty(rbm) )
+		return -1;
+
+	*note = nq->buffer[rbm->head];
+
+	if ( note_pending(*note, now, EFFECT_BLOCK_LEN * MONITOR_TICKS_PER_SAMPLE) )
+		return -1;							/* Sent during this block */
+
+	t = note_ticks(*note, base);
+	if ( t <= 0 || t >= note_ticks(note_stamp(now), base) )
+		return 0;							/* Late, or so late that the time stamp has wrapped */
+
+	offset = (t + MONITOR_TICKS_PER_SAMPLE/2) / MONITOR_TICKS_PER_SAMPLE;
+	return (offset < n) ? offset : (n - 1);
+}
+
+/* synth_next_event() - find the next note message that's due in this block, from all the parts
+ *
+ * Each part's queue is in order of time, so the next message is the first message of the part
+ * that has the lowest offset. Ties go to the lowest part.
+ *
+ * Returns the offset, with the message in *note and its part in *part. Returns -1 if no message is due.
+*/
+static int synth_next_event(dv_u32_t base, dv_u32_t now, int n, dv_u32_t *note, int *part)
+{
+	int offset = -1;
+
+	for ( int p = 0; p < SYNTH_N_PARTS && offset != 0; p++ )
+	{
+		dv_u32_t msg;
+		int o = synth_peek_event(p, base, now, n, &msg);
+
+		if ( o >= 0 && (offset < 0 || o < offset) )
+		{
+			offset = o;
+			*note = msg;
+			*part = p;
+		}
+	}
+
+	return offset;
+}
+
+/* synth_drop_event() - remove the message that synth_next_event() returned from its part's queue
+*/
+static void synth_drop_event(int p)
+{
+	dv_rbm_t *rbm = &notechannels.nq[p].rbm;
+	dv_i32_t head = dv_rb_add1(rbm, rbm->head);
+
+	dv_barrier();
+	rbm->head = head;
+}
+
+/* synth_apply_event() - start or stop a note of a part
+*/
+static void synth_apply_event(struct effect_synth_s *sy, int p, dv_u32_t note)
+{
+	if ( (note & NOTE_START) == 0 )
+		synth_stop_note(sy, p, note & 0x7f);
+	else
+		synth_start_note(sy, p, note);
+
+#if 0
+	sy_printf("Note: %d %05x\n", p, note);
+#endif
+}
+
+/* synth_generate() - generate the next sample of the sequence of note generators.
+ *
+ * The number of simultaneous notes (up to MAX_POLYPHONIC) is controlled by the master program.
+*/
+static inline dv_i64_t synth_generate(struct effect_synth_s *sy)
+{
+	dv_i64_t my_signal = 0;
+	dv_u32_t base = sy->t_block;
+	dv_u32_t now = monitor_frc();
+	dv_u32_t note;
+	int p;
+
+	sy->t_block = now;
+
+	/* First apply the note-on/note-off messages that are due. This is a block of one sample,
+	 * so they all take effect now. Voices that have finished are freed before any new ones
+	 * are allocated.
+	*/
+	/* The modulation is updated at the same rate as in the block version.
+	*/
+	if ( sy->mod_count <= 0 )
+	{
+		synth_modulate(sy, EFFECT_BLOCK_LEN);
+		sy->mod_count = EFFECT_BLOCK_LEN;
+	}
+	sy->mod_count--;
+
+	if ( synth_next_event(base, now, 1, &note, &p) >= 0 )
+	{
+		synth_reclaim(sy, 0);
+
+		for ( int k = 0; k < SYNTH_MAX_NOTES && synth_next_event(base, now, 1, &note, &p) >= 0; k++ )
+		{
+			synth_apply_event(sy, p, note);
+			synth_drop_event(p);
+		}
+	}
+
+	/* Now generate all the active notes. This path is mono, so a unison note's stereo spread
+	 * is mixed down.
+	*/
+	for ( int g = 0; g < sy->n_groups; g++ )
+	{
+		dv_u32_t lanes = voice.lanes[g];
+
+		if ( voice.n_osc[g] > 1 )
+		{
+			if ( lanes != 0 )
+			{
+				dv_i64_t right;
+				dv_i64_t left = synth_play_unison(g * SYNTH_LANES, &right);
+
+				my_signal += (left + right) / 2;
+			}
+			continue;
+		}
+
+		while ( lanes != 0 )
+		{
+			int l = __builtin_ctz(lanes);
+
+			lanes &= lanes - 1;
+			my_signal += synth_play_voice(g * SYNTH_LANES + l);
+		}
+	}
+
+	return (my_signal * sy->gain)/SYNTH_GAIN1;
+}
+
+/* synth_render_one() - add n samples of the sounding voices of group g to the mixes
+ *
+ * The voices of an ordinary group go into the mono mix. A unison group is one note, which
+ * goes into the left and right mixes.
+*/
+static inline void synth_render_one(int g, dv_i64_t *mix, dv_i64_t *left, dv_i64_t *right, int n)
+{
+	dv_u32_t lanes = voice.lanes[g];
+
+	if ( lanes == 0 )
+		return;
+
+	if ( voice.n_osc[g] > 1 )
+		synth_render_unison(g, left, right, n);
+	else
+		synth_render_group(g, lanes, mix, n);
+}
+
+#if SYNTH_VOICE_WORKERS == 0
+/* synth_render() - add n samples of all the sounding voices to the mixes, one group of voices at a time
+*/
+static void synth_render(struct effect_synth_s *sy, dv_i64_t *mix, dv_i64_t *left, dv_i64_t *right, int n)
+{
+	for ( int g = 0; g < sy->n_groups; g++ )
+		synth_render_one(g, mix, left, right, n);
+}
+#endif
+
+/* effect_synth() - sequence of note generators.
+ *
+ * The output of this note generator is added to the input signal and returned
+ * In this way, multiple notes are combined.
+*/
+dv_i64_t effect_synth(struct effect_s *e, dv_i64_t unused_signal)
+{
+	return synth_generate((struct effect_synth_s *)e->control);
+}
+
+#if SYNTH_VOICE_WORKERS > 0
+/* synth_post_events() - pass the pending note messages to the workers that own the voices
+ *
+ * Called while all the workers are waiting for the next block, so the voice states are stable.
+ * All the messages that are due are taken from the queue; each event carries the message's
+ * sample offset in the block. The voices are allocated now, so a voice that is stolen later in
+ * the block is handed over at the new note's offset. A note that steals a voice is posted
+ * with a fade event for the stolen voice at the same offset.
+ * Voices that finished during the last block are freed first.
+ * The voices that are shed by the governor or retired by a change of layout are passed to their
+ * owners as the first events, at offset 0.
+*/
+static void synth_post_events(struct effect_synth_s *sy, dv_u32_t base, dv_u32_t now, int n)
+{
+	dv_u32_t note;
+	int p;
+	int offset;
+
+	for ( int w = 0; w < SYNTH_VOICE_WORKERS; w++ )
+		synth_worker[w].n_events = 0;
+
+	synth_reclaim(sy, 1);
+
+#if SYNTH_GOVERNOR
+	{
+		int v = synth_shed(sy);
+
+		if ( v >= 0 )
+			synth_fade_out(sy, v, 1);
+	}
+#endif
+
+	for ( int k = 0; k < SYNTH_MAX_NOTES && (offset = synth_next_event(base, now, n, &note, &p)) >= 0; k++ )
+	{
+		dv_i32_t midi_note = note & 0x7f;
+		int v;
+		int fade = -1;
+
+		if ( (note & NOTE_START) == 0 )
+			v = synth_alloc.note_voice[p][midi_note];
+		else
+			v = synth_alloc_voice(sy, p, note, &fade);	/* Allocation is done by core 1 */
+
+		if ( fade >= 0 )
+		{
+			struct synth_worker_s *wk = &synth_worker[synth_voice_owner(fade)];
+
+			wk->event[wk->n_events++] = ((dv_u32_t)fade << SYNTH_EV_VOICE) |
+										((dv_u32_t)offset << SYNTH_EV_OFFSET) | SYNTH_EV_FADE;
+		}
+
+		if ( v >= 0 )
+		{
+			struct synth_worker_s *wk = &synth_worker[synth_voice_owner(v)];
+
+			wk->event[wk->n_events++] = ((dv_u32_t)v << SYNTH_EV_VOICE) |
+										((dv_u32_t)offset << SYNTH_EV_OFFSET) | (note & (NOTE_START | 0x7f));
+		}
+
+		synth_drop_event(p);
+	}
+}
+#endif
+
+/* effect_synth_frame() - sequence of note generators, block version.
+ *
+ * Fills the block with the generated signal. The input is ignored, as in effect_synth().
+ * The ordinary voices are mono, so they go to all the channels. The oscillators of unison notes
+ * are spread across the stereo image; channel 0 is left and channel 1 is right.
+ *
+ * With voice workers, the voices are rendered on cores 2 and 3. This stage passes the note events
+ * to the workers, starts them, waits for them to finish (the per-block barrier) and adds up their
+ * partial mixes.
+ *
+ * The note messages that were sent during the previous block take effect in this block, each at
+ * the sample offset that corresponds to the time it was sent. So the latency is one block and
+ * doesn't depend on the number of messages.
+ *
+ * The modulation matrix is evaluated for the sounding voices before the block is rendered.
+ * A note that starts during the block is modulated when it starts.
+ *
+ * The time taken is passed to the governor, which might shed a voice at the start of the next block.
+*/
+void effect_synth_frame(struct effect_s *e, struct effect_block_s *b, int n)
+{
+	struct effect_synth_s *sy = (struct effect_synth_s *)e->control;
+	dv_i64_t *buf = b->s[0];
+	dv_i64_t uni[2][EFFECT_BLOCK_LEN];
+	dv_u32_t base = sy->t_block;
+	dv_u32_t now = monitor_frc();
+
+	sy->t_block = now;
+
+#if SYNTH_VOICE_WORKERS > 0
+	synth_post_events(sy, base, now, n);
+	synth_modulate(sy, n);
+
+	for ( int w = 0; w < SYNTH_VOICE_WORKERS; w++ )
+	{
+		synth_worker[w].n = n;
+		dv_barrier();
+		synth_worker[w].go++;
+	}
+
+	for ( int w = 0; w < SYNTH_VOICE_WORKERS; w++ )
+	{
+		while ( synth_worker[w].done != synth_worker[w].go )
+		{
+			/* Wait for the worker */
+		}
+	}
+	dv_barrier();
+
+	for ( int i = 0; i < n; i++ )
+	{
+		dv_i64_t my_signal = 0;
+		dv_i64_t left = 0;
+		dv_i64_t right = 0;
+
+		for ( int w = 0; w < SYNTH_VOICE_WORKERS; w++ )
+		{
+			my_signal += synth_worker[w].mix[i];
+			left += synth_worker[w].uni[0][i];
+			right += synth_worker[w].uni[1][i];
+		}
+
+		buf[i] = my_signal;
+		uni[0][i] = left;
+		uni[1][i] = right;
+	}
+#else
+	synth_reclaim(sy, 0);
+
+#if SYNTH_GOVERNOR
+	{
+		int v = synth_shed(sy);
+
+		if ( v >= 0 )
+			synth_fade_out(sy, v, 0);
+	}
+#endif
 
-/* effect_synth() - sequence of note generators.
- *
- * The output of this note generator is added to the input signal and returned
- * In this way, multiple notes are combined.
- *
- * The number of simultaneous notes (up to MAX_POLYPHONIC) is controlled by the master program.
-*/
-dv_i64_t effect_synth(struct effect_s *e, dv_i64_t unused_signal)
-{
-	struct effect_synth_s *sy = (struct effect_synth_s *)e->control;
-	dv_i64_t my_signal = 0;
+	synth_modulate(sy, n);
 
-	struct notequeue_s *nq = &notechannels.nq[NQ_SYNTH];
-	dv_rbm_t *rbm = &nq->rbm;
+	for ( int i = 0; i < n; i++ )
+	{
+		buf[i] = 0;
+		uni[0][i] = 0;
+		uni[1][i] = 0;
+	}
 
-	/* First check for a new note-on/note-off message
+	/* The voices are rendered up to the offset of each message, then the message is applied.
+	 * The offsets are in order because the messages are.
 	*/
-	if ( !dv_rb_empty(rbm) )
 	{
-		dv_i32_t head = rbm->head;
-		dv_u32_t note = nq->buffer[head];
-		head = dv_rb_add1(rbm, head);
+		dv_u32_t note;
+		int p;
+		int s = 0;
+		int offset;
 
-		if ( (note & NOTE_START) == 0 )
-			synth_stop_note(note & 0x7f);
-		else
-			synth_start_note(note & 0x7f);	/* Velocity ignored */
+		for ( int k = 0; k < SYNTH_MAX_NOTES && (offset = synth_next_event(base, now, n, &note, &p)) >= 0; k++ )
+		{
+			if ( offset > s )
+			{
+				synth_render(sy, &buf[s], &uni[0][s], &uni[1][s], offset - s);
+				s = offset;
+			}
+			synth_apply_event(sy, p, note);
+			synth_drop_event(p);
+		}
 
-		dv_barrier();
-		rbm->head = head;
+		synth_render(sy, &buf[s], &uni[0][s], &uni[1][s], n - s);
+	}
+#endif
 
-#if 0
-		sy_printf("Note: %05x\n", note);
+	for ( int i = 0; i < n; i++ )
+	{
+		dv_i64_t my_signal = buf[i];
+
+		for ( int c = 0; c < EFFECT_N_CHANNELS; c++ )
+			b->s[c][i] = ((my_signal + uni[c & 1][i]) * sy->gain)/SYNTH_GAIN1;
+	}
+
+#if SYNTH_GOVERNOR
+	synth_govern(sy, monitor_frc() - now, n);
 #endif
+}
+
+#if SYNTH_VOICE_WORKERS > 0
+/* synth_worker_render() - render samples [s, e) of a worker's voices into its partial mixes
+*/
+static void synth_worker_render(struct effect_synth_s *sy, int w, int s, int e)
+{
+	struct synth_worker_s *wk = &synth_worker[w];
+	int n_groups = sy->n_groups;
+
+	for ( int g = w; g < n_groups; g += SYNTH_VOICE_WORKERS )
+		synth_render_one(g, &wk->mix[s], &wk->uni[0][s], &wk->uni[1][s], e - s);
+}
 
+/* synth_worker_block() - render one block of a worker's voices
+ *
+ * The voices are rendered up to the offset of each note event, then the event is applied.
+*/
+void synth_worker_block(int w)
+{
+	struct synth_worker_s *wk = &synth_worker[w];
+	struct effect_synth_s *sy = (struct effect_synth_s *)synth_effect->control;
+	int s = 0;
+
+	for ( int i = 0; i < wk->n; i++ )
+	{
+		wk->mix[i] = 0;
+		wk->uni[0][i] = 0;
+		wk->uni[1][i] = 0;
 	}
 
-	/* Now generate all the active notes
-	*/
-	for ( int i = 0; i < sy->n_polyphonic; i++ )
+	for ( int k = 0; k < wk->n_events; k++ )
 	{
-		my_signal += synth_play_note(&notegen[i]);
+		dv_u32_t ev = wk->event[k];
+		int v = ev >> SYNTH_EV_VOICE;
+		int offset = (ev >> SYNTH_EV_OFFSET) & SYNTH_EV_OFFSET_MASK;
+
+		if ( offset > s )
+		{
+			synth_worker_render(sy, w, s, offset);
+			s = offset;
+		}
+
+		if ( (ev & SYNTH_EV_RETIRE) != 0 )
+			synth_voice_off(v);
+		else if ( (ev & SYNTH_EV_FADE) != 0 )
+			synth_voice_fade(v);
+		else if ( (ev & NOTE_START) == 0 )
+			adsr_release(&synth_voice_patch(v)->adsr, &voice.env_pos[v]);
+		else
+			synth_voice_start(sy, v);
 	}
 
-	return (my_signal * sy->gain)/SYNTH_GAIN1;
+	synth_worker_render(sy, w, s, wk->n);
+}
+
+/* synth_voice_worker() - main loop of a voice worker core. Never returns.
+*/
+void synth_voice_worker(int w)
+{
+	struct synth_worker_s *wk = &synth_worker[w];
+	struct monitor_elapsed_s *loop = monitor_loop(2 + w);
+	dv_u32_t seq = wk->done;
+
+	for (;;)
+	{
+		while ( wk->go == seq )
+		{
+			/* Wait for core 1 */
+		}
+		dv_barrier();
+
+		synth_worker_block(w);
+
+		seq++;
+		dv_barrier();
+		wk->done = seq;
+
+		monitor_elapsed(loop, monitor_frc());
+	}
 }
+#endif
 
 
-/* effect_synth_init() - initialises the array of effect_synth_s structures
+/* effect_synth_init() - initialises the synth and its voice bank
 */
 void effect_synth_init(struct effect_s *e)
 {
 	e->func = &effect_synth;
+	e->blockfunc = DV_NULL;
+	e->framefunc = &effect_synth_frame;
 	e->control = &synth;
+	e->control_size = sizeof(synth);
 	e->name = "synth";
+	synth_effect = e;
 
-	synth.n_polyphonic = 10;
+	synth.n_polyphonic = 0;
 	synth.gain = SYNTH_GAIN1/3;
+	synth.n_limit = 0;
+	synth.gov_calm = 0;
+	synth.n_shed = 0;
+	synth.n_lowered = 0;
+	synth.t_block = monitor_frc();
+	synth.n_groups = 0;
+	synth.mod_count = 0;
+
+	/* Only part 0 plays at first. n_req = -1 makes synth_layout() build every part's lists.
+	 * All the parts start with the same patch, and share the one set of wave tables for now.
+	*/
+	adsr_init(&synth_patch[0].adsr, 3, 3, ADSR_GMAX-12, 3, SAMPLES_PER_SEC);
+	synth_patch[0].wave = wave_table(SAW);
+	synth_patch[0].unison = 1;
+	synth_patch[0].detune = 0;
+	synth_patch[0].spread = 0;
+	synth_patch[0].mod_slot = 0;
+
+	for ( int i = 0; i < SYNTH_MOD_SLOTS; i++ )
+	{
+		synth_patch[0].mod[i].source = SYNTH_MOD_NONE;
+		synth_patch[0].mod[i].dest = SYNTH_DEST_PITCH;
+		synth_patch[0].mod[i].amount = 0;
+	}
 
-	adsr_init(&note_adsr, 3, 3, ADSR_GMAX-12, 3, SAMPLES_PER_SEC);
+	for ( int k = 0; k < 2; k++ )
+		synth_patch[0].lfo_incr[k] = 0;
 
-	for ( int i = 0; i < MAX_POLYPHONIC; i++ )
+	for ( int p = 0; p < SYNTH_N_PARTS; p++ )
 	{
-		notegen[i].vco.root = DV_NULL;
-		notegen[i].envelope.adsr = &note_adsr;
-		notegen[i].envelope.position = -1;
-		notegen[i].envelope.state = 'x';
+		struct synth_part_s *pt = &synth.part[p];
+
+		pt->n_polyphonic = (p == 0) ? SYNTH_N_POLY : 0;
+		pt->n_req = -1;
+		pt->n_poly = 0;
+		pt->first = 0;
+		pt->n_voices = 0;
+		pt->n_osc = 1;
+		pt->n_free = 0;
+		pt->n_used = 0;
+		pt->oldest = -1;
+		pt->newest = -1;
+		pt->pressure = 0;
+		pt->wheel = 0;
+
+		for ( int k = 0; k < 2; k++ )
+			pt->lfo_phase[k] = 0;
+
+		for ( int i = 0; i < SYNTH_MOD_N_SOURCES; i++ )
+			pt->src[i] = 0;
+
+		synth_patch[p] = synth_patch[0];
+	}
+
+	for ( int v = 0; v < SYNTH_N_VOICES; v++ )
+	{
+		voice.env_pos[v] = -1;
+		voice.fade[v] = 0;
+		voice.fade_gain[v] = 0;
+		voice.gain[v] = 0;
+		voice.phase[v] = 0;
+		voice.incr[v] = 0;
+		voice.amp[v] = SYNTH_AMP1;
+		voice.amp_step[v] = 0;
+		voice.velocity[v] = 0;
+		voice.cents[v] = 0;
+		voice.table[v] = DV_NULL;
+		voice.wave[v] = wave_table(SAW);
+		voice.shift[v] = 32 - WAVE_BITS;
+		voice.age[v] = 0;
+		voice.midi_note[v] = 0;
+	}
+
+	for ( int g = 0; g < SYNTH_N_GROUPS; g++ )
+	{
+		voice.lanes[g] = 0;
+		voice.part[g] = 0;
+		voice.n_osc[g] = 1;
 	}
+
+	synth_alloc.batch = 0;
+	synth_layout(&synth, 0);
 }
 
 
-/* synth_play_note() - generate the next sample of a single note
+/* synth_play_voice() - generate the next sample of a single voice
  *
  * This is where the work is really done.
  *
@@ -124,26 +1056,23 @@ void effect_synth_init(struct effect_s *e)
  *	- another envelope generator to modulate the vcf (or to modulate the vcf's lfo)
  *	- etc etc.
 */
-dv_i64_t synth_play_note(struct effect_synth_mono_s *ng)
+dv_i64_t synth_play_voice(int v)
 {
-	if ( ng->envelope.position < 0 )
+	if ( voice.env_pos[v] < 0 )
 		return 0;
 
-	/* Do I care about overflow here? It happens after about 15 minutes.
-	*/
-	ng->age++;
-
-	/* Compute the ADSR gain.
+	/* Compute the ADSR gain, or the gain of the fast release of a stolen voice, and modulate it.
 	*/
-	dv_i32_t gain = envelope_gen(&ng->envelope);
+	dv_i32_t gain = synth_voice_amp(v, synth_voice_envelope(v));
 
 	/* Compute current raw waveform value.
 	*/
-	dv_i32_t sample = tone_play(&ng->vco);
+	voice.phase[v] += voice.incr[v];
+	dv_i32_t sample = wave_sample(voice.table[v], voice.shift[v], voice.phase[v]);
 
 #if 0
-	if ( (ng->age %  SAMPLES_PER_SEC) == 0 )
-		sy_printf("gen: %d, %d, %d\n", ng-notegen, sample, gain);
+	if ( (voice.age[v] %  SAMPLES_PER_SEC) == 0 )
+		sy_printf("gen: %d, %d, %d\n", v, sample, gain);
 #endif
 
 	/* Signal is sample * gain.
@@ -151,23 +1080,59 @@ dv_i64_t synth_play_note(struct effect_synth_mono_s *ng)
 	return ((dv_i64_t)sample * (dv_i64_t)gain) / ADSR_GMAX;
 }
 
+/* synth_play_unison() - generate the next sample of a unison note
+ *
+ * v is lane 0 of the note's group. The envelope is computed once for all the oscillators. Each
+ * oscillator's sample goes to the left and right outputs, weighted by its pan and divided by the
+ * no. of oscillators so that the note's peaks are no louder than those of a single voice.
+ * Returns the left output; the right output is placed in *right.
+*/
+dv_i64_t synth_play_unison(int v, dv_i64_t *right)
+{
+	int n_osc = voice.n_osc[v / SYNTH_LANES];
+	int spread = synth_voice_patch(v)->spread;
+	dv_i64_t left = 0;
+
+	*right = 0;
+
+	if ( voice.env_pos[v] < 0 )
+		return 0;
+
+	dv_i32_t gain = synth_voice_amp(v, synth_voice_envelope(v));
+
+	for ( int k = 0; k < n_osc; k++ )
+	{
+		int o = v + k;
+		voice.phase[o] += voice.incr[o];
+
+		dv_i32_t sample = wave_sample(voice.table[o], voice.shift[o], voice.phase[o]);
+		dv_i32_t pan = synth_unison_pan(k, n_osc, spread);
+		dv_i32_t g_l = (gain * ((SYNTH_PAN1 - pan) / n_osc)) / SYNTH_PAN1;
+		dv_i32_t g_r = (gain * ((SYNTH_PAN1 + pan) / n_osc)) / SYNTH_PAN1;
+
+		left += ((dv_i64_t)sample * (dv_i64_t)g_l) / ADSR_GMAX;
+		*right += ((dv_i64_t)sample * (dv_i64_t)g_r) / ADSR_GMAX;
+	}
+
+	return left;
+}
+
 
-/* synth_start_note() - start playing a note
+/* synth_start_note() - start playing a note of a part
 */
-void synth_start_note(dv_i32_t midi_note)
+void synth_start_note(struct effect_synth_s *sy, int p, dv_u32_t note)
 {
-	struct effect_synth_mono_s *ng = synth_find_generator(midi_note);
+	int fade;
+	int v = synth_alloc_voice(sy, p, note, &fade);
 
 #if 0
-	sy_printf("Start note: %d\n", ng-notegen);
+	sy_printf("Start note: %d %d\n", p, v);
 #endif
-	ng->age = 0;
-	ng->midi_note = midi_note;
-
-	/* Midi note 0 is C @ 8.175 Hz (i.e. the C of our root table, index 3)
-	*/
-	tone_start(&ng->vco, (midi_note+3)%12, 1 << ((midi_note+3)/12));
-	envelope_start(&ng->envelope);
+	if ( v < 0 )
+		return;								/* Part is off */
+	if ( fade >= 0 )
+		synth_voice_fade(fade);
+	synth_voice_start(sy, v);
 }
 
 
@@ -176,80 +1141,500 @@ void synth_start_note(dv_i32_t midi_note)
  * The note (if it's there) is set into its release phase.
  * The note doesn't actually stop playing until the end of its release phase.
 */
-void synth_stop_note(dv_i32_t midi_note)
+void synth_stop_note(struct effect_synth_s *sy, int p, dv_i32_t midi_note)
 {
-	for ( int i = 0; i < synth.n_polyphonic; i++ )
+	int v = synth_alloc.note_voice[p][midi_note];
+
+	if ( v >= 0 )
 	{
-		if ( notegen[i].midi_note == midi_note )
-		{
 #if 0
-			sy_printf("Stop note: %d\n", i);
+		sy_printf("Stop note: %d %d\n", p, v);
 #endif
-			envelope_stop(&notegen[i].envelope);
-			return;
+		adsr_release(&synth_patch[p].adsr, &voice.env_pos[v]);
+	}
+}
+
+/* synth_steal_unlink() - remove a voice from its part's steal list
+*/
+static void synth_steal_unlink(struct synth_part_s *pt, int v)
+{
+	struct synth_alloc_s *a = &synth_alloc;
+	int older = a->older[v];
+	int newer = a->newer[v];
+
+	if ( older < 0 )
+		pt->oldest = newer;
+	else
+		a->newer[older] = newer;
+
+	if ( newer < 0 )
+		pt->newest = older;
+	else
+		a->older[newer] = older;
+
+	pt->n_used--;
+}
+
+/* synth_steal_insert() - put a voice on its part's steal list just after (newer than) voice "older"
+ *
+ * older == -1 puts the voice on the old end of the list.
+*/
+static void synth_steal_insert(struct synth_part_s *pt, int v, int older)
+{
+	struct synth_alloc_s *a = &synth_alloc;
+	int newer = (older < 0) ? pt->oldest : a->newer[older];
+
+	a->older[v] = older;
+	a->newer[v] = newer;
+
+	if ( older < 0 )
+		pt->oldest = v;
+	else
+		a->newer[older] = v;
+
+	if ( newer < 0 )
+		pt->newest = v;
+	else
+		a->older[newer] = v;
+
+	pt->n_used++;
+}
+
+/* synth_steal_rank() - rank a note for stealing; the lowest rank is stolen first
+ *
+ * A releasing voice ranks below a sustaining one. Within that, the rank is the voice's current
+ * envelope gain, so the quietest voice goes first. A voice that was allocated in the current batch
+ * hasn't made a sound yet (or only just started), so it ranks above all the others.
+*/
+static dv_i32_t synth_steal_rank(int v)
+{
+	dv_i32_t rank;
+
+	if ( voice.env_pos[v] < 0 )
+		rank = 0;										/* Already finished */
+	else if ( voice.env_pos[v] > synth_voice_patch(v)->adsr.tSustain )
+		rank = voice.gain[v];							/* Releasing */
+	else
+		rank = voice.gain[v] + ADSR_GMAX + 1;
+
+	if ( synth_alloc.v_batch[v] == synth_alloc.batch )
+		rank += 2 * (ADSR_GMAX + 1);
+
+	return rank;
+}
+
+/* synth_steal_choose() - choose the note to steal when all n_poly notes of a part are playing
+ *
+ * Of the SYNTH_STEAL_SCAN oldest notes on the part's steal list, the one with the lowest rank
+ * (see synth_steal_rank()) is chosen. Ties go to the oldest. The scan is bounded so that the
+ * time taken doesn't grow with the number of notes; a newer note is hardly ever the best choice
+ * anyway, because it's the most likely to be still sounding. With SYNTH_STEAL_SCAN == 1 this is
+ * the plain oldest-note steal.
+*/
+static int synth_steal_choose(struct synth_part_s *pt)
+{
+	int victim = pt->oldest;
+	dv_i32_t v_rank = synth_steal_rank(victim);
+
+	for ( int v = synth_alloc.newer[victim], n = 1; v >= 0 && v_rank > 0 && n < SYNTH_STEAL_SCAN;
+			v = synth_alloc.newer[v], n++ )
+	{
+		dv_i32_t rank = synth_steal_rank(v);
+
+		if ( rank < v_rank )
+		{
+			victim = v;
+			v_rank = rank;
+		}
+	}
+
+	return victim;
+}
+
+/* synth_alloc_voice() - allocate a voice of part p for a new note
+ *
+ * Choice of voice:
+ *		1. The voice that is already allocated to the note (it is restarted)
+ *		2. A free voice, if fewer than n_poly notes of the part are playing
+ *		3. A free voice, after stealing a note (see synth_steal_choose()). The stolen voice is
+ *		   reserved and returned in *fade; the caller starts its fast release when the new note
+ *		   starts.
+ *		4. The stolen voice itself (it is restarted), if all the free voices are still fading
+ *
+ * If the governor has limited the number of sounding voices and the limit has been reached,
+ * a note of the part is stolen as if all its n_poly notes were playing. A voice that the governor
+ * has shed is reserved without a free voice being set aside for it, so a part can have fewer than
+ * n_poly notes playing and still have no free voice; that's treated in the same way (case 4).
+ *
+ * The voice becomes the newest on the steal list. Its MIDI note and velocity are set here from
+ * the note message; starting it is up to the caller (or the voice's worker).
+ *
+ * Returns -1 if the part is off, or if all its voices are fading and there's no note to steal.
+*/
+int synth_alloc_voice(struct effect_synth_s *sy, int p, dv_u32_t note, int *fade)
+{
+	struct synth_alloc_s *a = &synth_alloc;
+	struct synth_part_s *pt = &sy->part[p];
+	dv_i32_t midi_note = note & 0x7f;
+	int v = a->note_voice[p][midi_note];
+	dv_boolean_t full = (pt->n_used >= pt->n_poly) ||
+						(sy->n_limit < sy->n_polyphonic && synth_n_used(sy) >= sy->n_limit);
+
+	*fade = -1;
+
+	if ( pt->n_poly <= 0 )
+		return -1;
+
+	if ( v >= 0 )
+	{
+		synth_steal_unlink(pt, v);			/* Same note: restart it as the newest */
+	}
+	else if ( (full || pt->n_free <= 0) && pt->n_used > 0 )
+	{
+		v = synth_steal_choose(pt);			/* Steal */
+		synth_steal_unlink(pt, v);
+		a->note_voice[p][voice.midi_note[v]] = -1;
+
+		if ( pt->n_free > 0 )
+		{
+			a->reserved[v] = 1;
+			*fade = v;
+			v = a->free[pt->first + --pt->n_free];
+			a->used[v / SYNTH_LANES] |= (dv_u8_t)(1u << (v % SYNTH_LANES));
+		}
+	}
+	else if ( pt->n_free <= 0 )
+	{
+		return -1;							/* All the part's voices are fading */
+	}
+	else
+	{
+		v = a->free[pt->first + --pt->n_free];
+		a->used[v / SYNTH_LANES] |= (dv_u8_t)(1u << (v % SYNTH_LANES));
+	}
+
+	synth_steal_insert(pt, v, pt->newest);
+	a->note_voice[p][midi_note] = v;
+	a->v_batch[v] = a->batch;
+	voice.midi_note[v] = midi_note;
+	voice.velocity[v] = (((note >> 8) & 0x7f) * SYNTH_MOD1) / 127;
+
+	return v;
+}
+
+/* synth_free_voice() - return an allocated or reserved voice to its part's free stack
+ *
+ * Called when the voice's envelope or fast release has finished or the voice has been retired.
+*/
+void synth_free_voice(struct effect_synth_s *sy, int v)
+{
+	struct synth_alloc_s *a = &synth_alloc;
+	int p = voice.part[v / SYNTH_LANES];
+	struct synth_part_s *pt = &sy->part[p];
+
+	if ( a->reserved[v] )
+	{
+		a->reserved[v] = 0;					/* Not on the steal list */
+	}
+	else
+	{
+		synth_steal_unlink(pt, v);
+
+		if ( a->note_voice[p][voice.midi_note[v]] == v )
+			a->note_voice[p][voice.midi_note[v]] = -1;
+	}
+
+	a->used[v / SYNTH_LANES] &= (dv_u8_t)~(1u << (v % SYNTH_LANES));
+	a->free[pt->first + pt->n_free++] = v;
+}
+
+/* synth_reclaim() - free the voices whose envelopes have finished
+ *
+ * Called by core 1 before it allocates voices for a batch of note messages. Any voices that
+ * were allocated for earlier messages have been started by then, so a voice that is used but
+ * not sounding has finished.
+ * If the polyphony or unison of any part has changed, the voices are laid out again first.
+*/
+void synth_reclaim(struct effect_synth_s *sy, dv_boolean_t post)
+{
+	struct synth_alloc_s *a = &synth_alloc;
+
+	for ( int p = 0; p < SYNTH_N_PARTS; p++ )
+	{
+		if ( sy->part[p].n_polyphonic != sy->part[p].n_req || synth_unison(&synth_patch[p]) != sy->part[p].n_osc )
+		{
+			synth_layout(sy, post);
+			break;
+		}
+	}
+
+	a->batch++;
+
+	for ( int g = 0; g < sy->n_groups; g++ )
+	{
+		dv_u32_t ended = a->used[g] & ~voice.lanes[g];
+
+		while ( ended != 0 )
+		{
+			int l = __builtin_ctz(ended);
+
+			ended &= ended - 1;
+			synth_free_voice(sy, g * SYNTH_LANES + l);
 		}
 	}
 }
 
+/* synth_retire_group() - retire all the sounding voices of a group
+*/
+static void synth_retire_group(struct effect_synth_s *sy, int g, dv_boolean_t post)
+{
+	dv_u32_t lanes = voice.lanes[g];
+
+	while ( lanes != 0 )
+	{
+		int l = __builtin_ctz(lanes);
+
+		lanes &= lanes - 1;
+		synth_retire(sy, g * SYNTH_LANES + l, post);
+	}
+}
 
-/* synth_find_generator() - find the best note generator to use for a new note
+/* synth_layout() - lay out the parts' pools of voices
  *
- * Criteria for "best":
- *		1. Not playing
- *		2. Playing same note
- *		3. Playing longest
+ * The pools are whole groups, in part order from group 0. Each part that has notes gets enough
+ * groups for its n_polyphonic notes and SYNTH_FADE_VOICES more. If the voices run out, the later
+ * parts get fewer notes (or none). A group that changes part, or that is no longer in a pool,
+ * has its sounding voices retired. The lists of each part whose pool has changed are rebuilt.
+ *
+ * A part whose patch has unison needs a group for each note. It gets one group's worth of fade
+ * voices, so at most SYNTH_FADE_VOICES / SYNTH_LANES of its stolen notes fade out at once; any
+ * others are cut off (see synth_alloc_voice()). A group that changes its no. of oscillators is
+ * retired as if it had changed part.
+ *
+ * This only happens when a part's polyphony or unison is changed. The governor's limit is reset
+ * to the new total no. of notes.
 */
-struct effect_synth_mono_s *synth_find_generator(dv_i32_t midi_note)
+void synth_layout(struct effect_synth_s *sy, dv_boolean_t post)
 {
-	struct effect_synth_mono_s *ngx = &notegen[0];
-	struct effect_synth_mono_s *ng = ngx;
+	dv_u8_t moved[SYNTH_N_GROUPS];
+	int g = 0;
 
-	for ( int i = 0; i < synth.n_polyphonic; i++ )
+	sy->n_polyphonic = 0;
+
+	for ( int p = 0; p < SYNTH_N_PARTS; p++ )
 	{
-		if ( ngx->envelope.position < 0 )
-			return ngx;						/* Return a free generator */
+		struct synth_part_s *pt = &sy->part[p];
+		int n_req = pt->n_polyphonic;		/* Core 0 can change it at any time */
+		int n_osc = synth_unison(&synth_patch[p]);
+		int n_poly = n_req;
+		int per_group = (n_osc > 1) ? 1 : SYNTH_LANES;		/* Notes per group */
+		int ng = (n_poly > 0) ? (n_poly * SYNTH_LANES / per_group + SYNTH_FADE_VOICES + SYNTH_LANES - 1) / SYNTH_LANES : 0;
+		dv_boolean_t changed = (n_req != pt->n_req || n_osc != pt->n_osc);
+
+		if ( ng > SYNTH_N_GROUPS - g )
+		{
+			ng = SYNTH_N_GROUPS - g;
+			if ( n_poly > ng * per_group )
+				n_poly = ng * per_group;
+		}
+
+		for ( int i = g; i < g + ng; i++ )
+		{
+			moved[i] = (voice.part[i] != p || voice.n_osc[i] != n_osc);
 
-		if ( ngx->midi_note == midi_note )
-			return ngx;						/* Return a generator that's playing the same note */
+			if ( moved[i] )
+			{
+				synth_retire_group(sy, i, post);
+				voice.part[i] = p;
+				voice.n_osc[i] = n_osc;
+				changed = 1;
+			}
+		}
 
-		if ( ngx->age > ng->age ) 
+		if ( changed || n_poly != pt->n_poly || g * SYNTH_LANES != pt->first || ng * SYNTH_LANES != pt->n_voices )
 		{
-			ng = ngx;						/* Remember an older generator */
+			pt->n_req = n_req;
+			pt->n_osc = n_osc;
+			pt->n_poly = n_poly;
+			pt->first = g * SYNTH_LANES;
+			pt->n_voices = ng * SYNTH_LANES;
+			synth_alloc_build(sy, p, moved);
 		}
-		ngx++;
+
+		g += ng;
+		sy->n_polyphonic += n_poly;
+	}
+
+	for ( int i = g; i < SYNTH_N_GROUPS; i++ )
+	{
+		synth_retire_group(sy, i, post);
+		synth_alloc.used[i] = 0;
+	}
+
+	sy->n_groups = g;
+	sy->n_limit = sy->n_polyphonic;
+	sy->gov_calm = 0;
+}
+
+/* synth_alloc_build() - build the allocator's lists for the pool of part p
+ *
+ * The sounding voices go on the steal list in order of age, oldest first, except that the ones
+ * that are fading out stay reserved. The silent voices go on the free stack so that the
+ * lowest-numbered voice is used first. The voices of the groups that have just moved to this part
+ * (moved[g]) are being retired, so they are free. In a unison pool only lane 0 of each group
+ * is a voice as far as the allocator is concerned.
+*/
+void synth_alloc_build(struct effect_synth_s *sy, int p, const dv_u8_t *moved)
+{
+	struct synth_alloc_s *a = &synth_alloc;
+	struct synth_part_s *pt = &sy->part[p];
+	int step = (pt->n_osc > 1) ? SYNTH_LANES : 1;
+
+	pt->n_free = 0;
+	pt->n_used = 0;
+	pt->oldest = -1;
+	pt->newest = -1;
+
+	for ( int i = 0; i < SYNTH_N_NOTES; i++ )
+		a->note_voice[p][i] = -1;
+
+	for ( int v = pt->first; v < pt->first + pt->n_voices; v++ )
+	{
+		a->used[v / SYNTH_LANES] = 0;
+		a->reserved[v] = 0;
 	}
 
-	return ng;
+	for ( int v = pt->first + pt->n_voices - step; v >= pt->first; v -= step )
+	{
+		a->v_batch[v] = a->batch;
+
+		if ( voice.env_pos[v] < 0 || moved[v / SYNTH_LANES] )
+		{
+			a->free[pt->first + pt->n_free++] = v;
+			continue;
+		}
+
+		a->used[v / SYNTH_LANES] |= (dv_u8_t)(1u << (v % SYNTH_LANES));
+
+		if ( voice.fade[v] > 0 )
+		{
+			a->reserved[v] = 1;
+			continue;
+		}
+
+		/* Insert in order of age. This only happens when the no. of voices is changed.
+		*/
+		int older = pt->newest;
+
+		while ( older >= 0 && voice.age[older] < voice.age[v] )
+			older = a->older[older];
+
+		synth_steal_insert(pt, v, older);
+
+		int other = a->note_voice[p][voice.midi_note[v]];
+
+		if ( other < 0 || voice.age[other] > voice.age[v] )
+			a->note_voice[p][voice.midi_note[v]] = v;
+	}
 }
 
-/* synth_control() - control the synth with various parameters
+/* synth_control() - control a part of the synth with various parameters
  *
  * controllers 0 to 127 are midi controller values - see synth-config.h
- * controller 128 - number of polyphonic notes
+ * controller 128 - number of polyphonic notes of the part (0 ==> the part is off)
+ * controller 129 - channel pressure
+ *
+ * A change of polyphony or unison takes effect at the start of the next block (see synth_layout()).
+ * A change of detune or spread takes effect at the next note. The modulation sources and the
+ * matrix take effect at the next block (see synth_modulate()).
 */
-void synth_control(dv_i32_t controller, dv_i32_t value)
+void synth_control(int part, dv_i32_t controller, dv_i32_t value)
 {
+	struct effect_synth_s *sy = (struct effect_synth_s *)synth_effect->control;
+	struct synth_patch_s *pa;
+
+	if ( part < 0 || part >= SYNTH_N_PARTS )
+		return;
+
+	pa = &synth_patch[part];
+
 	switch ( controller )
 	{
 	case SYNTH_CTRL_ENVELOPE_A:
-		adsr_set_a(&note_adsr, value, SAMPLES_PER_SEC);
+		adsr_set_a(&pa->adsr, value, SAMPLES_PER_SEC);
 		break;
 
 	case SYNTH_CTRL_ENVELOPE_D:
-		adsr_set_d(&note_adsr, value, SAMPLES_PER_SEC);
+		adsr_set_d(&pa->adsr, value, SAMPLES_PER_SEC);
 		break;
 
 	case SYNTH_CTRL_ENVELOPE_S:
-		adsr_set_s(&note_adsr, value, SAMPLES_PER_SEC);
+		adsr_set_s(&pa->adsr, value, SAMPLES_PER_SEC);
 		break;
 
 	case SYNTH_CTRL_ENVELOPE_R:
-		adsr_set_r(&note_adsr, value, SAMPLES_PER_SEC);
+		adsr_set_r(&pa->adsr, value, SAMPLES_PER_SEC);
 		break;
 
+	case SYNTH_CTRL_PART_NOTES:
 	case SYNTH_CTRL_N_POLY:
-		if ( value > 0 && value <= MAX_POLYPHONIC )
-			synth.n_polyphonic = value;
+		if ( value >= 0 && value <= MAX_POLYPHONIC )
+			sy->part[part].n_polyphonic = value;
+		break;
+
+	case SYNTH_CTRL_UNISON:
+		if ( value >= 0 && value <= SYNTH_LANES )
+			pa->unison = (value == 0) ? 1 : value;
+		break;
+
+	case SYNTH_CTRL_DETUNE:
+		if ( value >= 0 && value <= 100 )
+			pa->detune = value;
+		break;
+
+	case SYNTH_CTRL_SPREAD:
+		if ( value >= 0 && value <= SYNTH_PAN1 )
+			pa->spread = value;
+		break;
+
+	case SYNTH_CTRL_WAVEFORM:
+		if ( value >= 0 && value < WAVE_N_TYPES )
+			pa->wave = wave_table(SAW + value);
+		break;
+
+	case SYNTH_CTRL_MOD_WHEEL:
+		sy->part[part].wheel = value;
+		break;
+
+	case SYNTH_CTRL_PRESSURE:
+		sy->part[part].pressure = value;
+		break;
+
+	case SYNTH_CTRL_LFO1_RATE:
+	case SYNTH_CTRL_LFO2_RATE:
+		if ( value >= 0 && value <= 127 )
+			pa->lfo_incr[controller - SYNTH_CTRL_LFO1_RATE] =
+							(dv_u32_t)(((dv_u64_t)value << SYNTH_LFO_SHIFT) / SAMPLES_PER_SEC);
+		break;
+
+	case SYNTH_CTRL_MOD_SLOT:
+		if ( value >= 0 && value < SYNTH_MOD_SLOTS )
+			pa->mod_slot = value;
+		break;
+
+	case SYNTH_CTRL_MOD_SOURCE:
+		if ( value >= 0 && value < SYNTH_MOD_N_SOURCES )
+			pa->mod[pa->mod_slot].source = value;
+		break;
+
+	case SYNTH_CTRL_MOD_DEST:
+		if ( value == SYNTH_DEST_PITCH || value == SYNTH_DEST_AMP )
+			pa->mod[pa->mod_slot].dest = value;
+		break;
+
+	case SYNTH_CTRL_MOD_AMOUNT:
+		if ( value >= 0 && value <= 127 )
+			pa->mod[pa->mod_slot].amount = (value - 64) * 2;
 		break;
 
 	default:
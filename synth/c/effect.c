@@ -19,16 +19,45 @@
 */
 #include <dv-config.h>
 #include <davroska.h>
+#include <synth-config.h>
 #include <effect.h>
+#include <effect-pipe.h>
 #include <monitor.h>
 
 /* This control structure controls a single, sequential processing sequence
- * However, it should be possible to extend to a multiprocessing environment
- * by having a "first" pointer per core and having some inter-core
- * communication stages
+ * The sequence can be split between cores by pipe stages; the compiled chain then has a
+ * segment per core.
 */
 struct effect_s effect_list;
 
+/* The two compiled chains, the pointer to the published one and, for each core, the chain
+ * that the core is using (DV_NULL if none). There's a single arena for the control blocks.
+*/
+static struct effect_chain_s effect_chains[2];
+struct effect_chain_s * volatile effect_published = &effect_chains[0];
+static struct effect_chain_s * volatile effect_current[EFFECT_N_CORES];
+static dv_u32_t effect_generation;		/* No. of chains published */
+
+static dv_u64_t effect_arena[EFFECT_ARENA_SIZE/sizeof(dv_u64_t)] __attribute__((aligned(64)));
+
+/* The blocks that are allocated in the arena, in order of position. Each remembers where its
+ * control block came from (home), so that the block can be copied back when it's freed.
+ * A block can be in use by the stages of the list and of the published chain, which can be
+ * different stages, so there's room for two chains' worth.
+*/
+struct effect_arena_block_s
+{
+	struct effect_s *owner;
+	void *home;
+	dv_u32_t first;			/* Index of the first word in the arena */
+	dv_u32_t nwords;
+};
+
+#define EFFECT_ARENA_N_BLOCKS	(2*N_EFFECT_STAGES)
+
+static struct effect_arena_block_s effect_arena_block[EFFECT_ARENA_N_BLOCKS];
+static int effect_arena_n_blocks;
+
 /* effect_init() - initialises the list of effect stages
 */
 void effect_init(void)
@@ -36,7 +65,10 @@ void effect_init(void)
 	effect_list.next = DV_NULL;
 	effect_list.prev = DV_NULL;
 	effect_list.func = DV_NULL;
+	effect_list.blockfunc = DV_NULL;
+	effect_list.framefunc = DV_NULL;
 	effect_list.control = DV_NULL;
+	effect_list.control_stride = 0;
 }
 
 /* effect_chain() - processes an effect chain from start to end
@@ -54,26 +86,142 @@ dv_i64_t effect_chain(struct effect_s *e, dv_i64_t signal)
 	return x;
 }
 
-/* effect_processor() - processes the list of effects
+/* effect_stage_mono() - runs a mono stage over one channel of a block
+ *
+ * Stages that only have a per-sample function are called once per sample.
+*/
+static inline void effect_stage_mono(struct effect_s *e, dv_i64_t *buf, int n)
+{
+	if ( e->blockfunc == DV_NULL )
+	{
+		effectstage_t func = e->func;
+
+		for ( int i = 0; i < n; i++ )
+		{
+			buf[i] = func(e, buf[i]);
+		}
+	}
+	else
+	{
+		e->blockfunc(e, buf, n);
+	}
+}
+
+/* effect_stage_block() - runs a single stage over a block
+ *
+ * Mono stages are run over each channel in turn. If the stage has a control block per channel
+ * (see effect_compile()), each channel is run with a copy of the descriptor that points to
+ * that channel's control block. The compiled descriptor itself is never modified here.
+*/
+static inline void effect_stage_block(struct effect_s *e, struct effect_block_s *b, int n)
+{
+	if ( e->framefunc == DV_NULL )
+	{
+		if ( e->control_stride == 0 )
+		{
+			for ( int c = 0; c < EFFECT_N_CHANNELS; c++ )
+			{
+				effect_stage_mono(e, b->s[c], n);
+			}
+		}
+		else
+		{
+			struct effect_s ce = *e;
+
+			for ( int c = 0; c < EFFECT_N_CHANNELS; c++ )
+			{
+				effect_stage_mono(&ce, b->s[c], n);
+				ce.control = (char *)ce.control + e->control_stride;
+			}
+		}
+	}
+	else
+	{
+		e->framefunc(e, b, n);
+	}
+}
+
+/* effect_chain_block() - processes an effect chain from start to end, a block at a time
+ *
+ * Each stage transforms the whole block (in place) before the next stage sees it.
+*/
+void effect_chain_block(struct effect_s *e, struct effect_block_s *b, int n)
+{
+	while ( e != DV_NULL )
+	{
+		effect_stage_block(e, b, n);
+		e = e->next;
+	}
+}
+
+/* effect_process_block() - processes a block through a core's segment of the compiled chain
  *
- * Note: the stage input/output variable (x) is not initialized each time round the loop.
+ * A block boundary is where a core switches to a newly-published chain. Setting
+ * effect_current acknowledges the switch. effect_compile() might have published another chain
+ * after effect_published was read and, not yet seeing the acknowledgement, taken the chain that
+ * was read as free. So effect_published is read again after the acknowledgement, and the
+ * switch is repeated until the two agree. effect_compile() publishes before it looks at the
+ * acknowledgements, so if it missed this one, this core sees its new chain.
+*/
+void effect_process_block(int core, struct effect_block_s *b, int n)
+{
+	struct effect_chain_s *ch = effect_published;
+
+	while ( ch != effect_current[core] )
+	{
+		dv_barrier();						/* Finished with the old chain */
+		effect_current[core] = ch;
+		dv_barrier();						/* Acknowledge, then check again */
+		ch = effect_published;
+	}
+
+	struct effect_s *e = &ch->stage[ch->segment[core].first];
+	int ns = ch->segment[core].n;
+
+	for ( int i = 0; i < ns; i++ )
+	{
+#if EFFECT_PROFILE
+		dv_u32_t t0 = monitor_stage_clock();
+		effect_stage_block(&e[i], b, n);
+		monitor_stage_record(e[i].profile, monitor_stage_clock() - t0);
+#else
+		effect_stage_block(&e[i], b, n);
+#endif
+	}
+}
+
+/* effect_processor() - processes a core's segment of the compiled list of effects
+ *
+ * The chain is processed in blocks of EFFECT_BLOCK_LEN samples. The loop time that's
+ * measured is therefore the time per block.
+ *
+ * Note: the block buffer is not initialized each time round the loop.
  * This permits some kind of feedback if needed later if needed.
  *
  * However, it is likely that the first stage discards its input and the last stage produces zero output.
+ *
+ * A core whose segment is empty just picks up each new chain, so a pipe to it can be added later.
 */
-void effect_processor(void)
+void effect_processor(int core)
 {
-	dv_i64_t x = 0;
+	static struct effect_block_s buf[EFFECT_N_CORES];
+	struct monitor_elapsed_s *loop = monitor_loop(core);
+
+#if EFFECT_PROFILE
+	monitor_stage_enable();
+#endif
 
 	for (;;)
 	{
-		struct effect_s *e = effect_list.next;
-		x = effect_chain(e, x);
-		monitor_elapsed(&core1_loop, monitor_frc()); 
+		effect_process_block(core, &buf[core], EFFECT_BLOCK_LEN);
+		monitor_elapsed(loop, monitor_frc()); 
 	}
 }
 
 /* effect_append() - appends a new effect to the end of the list
+ *
+ * The change is not seen by the processor until the list is compiled.
+ * The list must only be edited by one core.
 */
 void effect_append(struct effect_s *e)
 {
@@ -91,3 +239,307 @@ void effect_append(struct effect_s *e)
 		effect_list.prev = e;
 	}
 }
+
+/* effect_insert() - inserts an effect into the list after the given effect
+ *
+ * If after is DV_NULL the effect becomes the first in the list.
+*/
+void effect_insert(struct effect_s *e, struct effect_s *after)
+{
+	e->prev = after;
+	e->next = (after == DV_NULL) ? effect_list.next : after->next;
+
+	if ( e->next == DV_NULL )
+		effect_list.prev = e;
+	else
+		e->next->prev = e;
+
+	if ( after == DV_NULL )
+		effect_list.next = e;
+	else
+		after->next = e;
+}
+
+/* effect_remove() - removes an effect from the list
+ *
+ * The effect's control block stays in the arena until the list has been compiled without it and
+ * no core can still be using it. Then it's copied back to where it came from (see
+ * effect_arena_reclaim()). Either way, the effect can be inserted again later with its state intact.
+*/
+void effect_remove(struct effect_s *e)
+{
+	if ( e->prev == DV_NULL )
+		effect_list.next = e->next;
+	else
+		e->prev->next = e->next;
+
+	if ( e->next == DV_NULL )
+		effect_list.prev = e->prev;
+	else
+		e->next->prev = e->prev;
+
+	e->next = DV_NULL;
+	e->prev = DV_NULL;
+}
+
+/* effect_arena_alloc() - allocate space for a stage's control block in the arena
+ *
+ * The first gap that's big enough is used. Returns DV_NULL if there's no room.
+*/
+static void *effect_arena_alloc(struct effect_s *e, dv_u32_t size)
+{
+	dv_u32_t nwords = (size + sizeof(dv_u64_t) - 1) / sizeof(dv_u64_t);
+	dv_u32_t first = 0;
+	int i;
+
+	if ( effect_arena_n_blocks >= EFFECT_ARENA_N_BLOCKS )
+		return DV_NULL;
+
+	for ( i = 0; i < effect_arena_n_blocks; i++ )
+	{
+		if ( (effect_arena_block[i].first - first) >= nwords )
+			break;
+		first = effect_arena_block[i].first + effect_arena_block[i].nwords;
+	}
+
+	if ( (first + nwords) > (EFFECT_ARENA_SIZE / sizeof(dv_u64_t)) )
+		return DV_NULL;
+
+	for ( int j = effect_arena_n_blocks; j > i; j-- )
+		effect_arena_block[j] = effect_arena_block[j-1];
+	effect_arena_n_blocks++;
+
+	effect_arena_block[i].owner = e;
+	effect_arena_block[i].home = e->control;
+	effect_arena_block[i].first = first;
+	effect_arena_block[i].nwords = nwords;
+
+	return &effect_arena[first];
+}
+
+/* effect_arena_reclaim() - free the blocks of the arena that no stage can be using
+ *
+ * Called by effect_compile() when no core is using the unpublished chain. A block is still in use
+ * if a stage of the list or of the published chain points to it. Any other block belongs to a
+ * stage that has been removed (or re-initialised); if the stage still points to the block, the
+ * control block is copied back to where it came from, so the stage can be inserted again later
+ * with its state intact. For a mono stage with a control block per channel, that's channel 0's.
+*/
+static void effect_arena_reclaim(void)
+{
+	struct effect_chain_s *pub = effect_published;
+	int n = 0;
+
+	for ( int i = 0; i < effect_arena_n_blocks; i++ )
+	{
+		struct effect_arena_block_s *blk = &effect_arena_block[i];
+		void *control = &effect_arena[blk->first];
+		dv_boolean_t used = 0;
+
+		for ( struct effect_s *e = effect_list.next; e != DV_NULL && !used; e = e->next )
+			used = (e->control == control);
+
+		for ( int core = 0; core < EFFECT_N_CORES && !used; core++ )
+		{
+			for ( int k = 0; k < pub->segment[core].n && !used; k++ )
+				used = (pub->stage[pub->segment[core].first + k].control == control);
+		}
+
+		if ( used )
+		{
+			effect_arena_block[n++] = *blk;
+		}
+		else if ( blk->owner->control == control )
+		{
+			char *src = (char *)control;
+			char *dst = (char *)blk->home;
+
+			for ( dv_u32_t j = 0; j < blk->owner->control_size; j++ )
+				dst[j] = src[j];
+
+			blk->owner->control = blk->home;
+		}
+	}
+
+	effect_arena_n_blocks = n;
+}
+
+/* effect_in_arena() - returns true if the control block is already in the arena
+*/
+static inline dv_boolean_t effect_in_arena(void *control)
+{
+	return ( (dv_address_t)control >= (dv_address_t)&effect_arena[0] ) &&
+		   ( (dv_address_t)control < (dv_address_t)&effect_arena[EFFECT_ARENA_SIZE/sizeof(dv_u64_t)] );
+}
+
+/* effect_emit() - appends a stage to a compiled chain and to the current segment
+*/
+static void effect_emit(struct effect_chain_s *ch, struct effect_s *e, struct effect_segment_s *seg, int *n)
+{
+	struct effect_s *c = &ch->stage[*n];
+
+	*c = *e;
+	c->next = DV_NULL;
+#if EFFECT_PROFILE
+	c->profile = monitor_stage_find(c->name, seg - &ch->segment[0]);
+#endif
+	if ( seg->n > 0 )
+	{
+		c->prev = c - 1;
+		c->prev->next = c;
+	}
+	else
+	{
+		c->prev = DV_NULL;
+		seg->first = *n;
+	}
+
+	seg->n++;
+	(*n)++;
+}
+
+/* effect_compile() - compiles the list of effects into the contiguous array used for processing
+ *
+ * The first time a stage is compiled its control block is copied into the arena and the stage's
+ * control pointer is changed to point to the copy. A mono stage gets one copy per channel, placed
+ * control_stride bytes apart; the control pointer points to channel 0's. Functions that access a
+ * stage's control block must therefore use the control pointer, not the original variable.
+ * The space of a stage that has been removed is reclaimed once no core can be using it (see
+ * effect_arena_reclaim()), so the list can be re-patched any number of times.
+ *
+ * The chain starts on EFFECT_FIRST_CORE. Each pipe ends the current core's segment with a send
+ * stage and starts the segment of the pipe's core with a receive stage. Each core can have only
+ * one segment. A pipe can only feed a core that runs effect_processor(): one of the cores from
+ * EFFECT_PIPE_FIRST_CORE to EFFECT_N_CORES-1. Core 0 runs davroska and the cores below
+ * EFFECT_PIPE_FIRST_CORE are voice workers, so a pipe to one of them would fill up and stop the
+ * chain.
+ *
+ * A stage that's in the published chain must stay on its core. Each core switches to the new
+ * chain at its own block boundary, so a stage that moved could run on two cores at once. To move a
+ * stage, remove it and compile, then insert it in its new place and compile again. A pipe's core
+ * mustn't be changed while the pipe is in the published chain, for the same reason.
+ *
+ * The descriptors in each segment are linked together so that effect_chain() can also be used on them.
+ *
+ * The chain is compiled into the unpublished buffer, which is then published. If a core hasn't yet
+ * acknowledged the previous publication, the unpublished buffer might still be in use; in that case
+ * this function waits until it has been released, which takes at most one block.
+ *
+ * Returns 0 on success, -1 if there are too many stages, the arena is full, the pipes are
+ * inconsistent or a stage would move to another core. The published chain is unchanged on failure.
+*/
+int effect_compile(void)
+{
+	struct effect_s *e;
+	struct effect_chain_s *ch;
+	int n = 0;
+	int core = EFFECT_FIRST_CORE;
+	dv_u32_t used = (1 << core);
+
+	for ( e = effect_list.next; e != DV_NULL; e = e->next )
+	{
+		if ( n >= N_EFFECT_STAGES )
+			return -1;
+
+		if ( effect_generation != 0 && e->published == effect_generation && e->core != core )
+			return -1;								/* Would run on two cores at once */
+
+		if ( effect_is_pipe(e) )
+		{
+			dv_i32_t next_core = ((struct effect_pipe_s *)e->control)->core;
+
+			if ( next_core < EFFECT_PIPE_FIRST_CORE || next_core >= EFFECT_N_CORES ||
+				 (used & (1 << next_core)) != 0 )
+				return -1;
+			used |= (1 << next_core);
+			core = next_core;
+		}
+		n++;
+	}
+
+	/* Wait until no core is using the unpublished chain. A core that doesn't run effect_processor()
+	 * never uses a chain, so it's never waited for.
+	*/
+	ch = (effect_published == &effect_chains[0]) ? &effect_chains[1] : &effect_chains[0];
+	for ( core = 0; core < EFFECT_N_CORES; core++ )
+	{
+		while ( effect_current[core] == ch )
+		{
+			/* Wait for the core to move to the published chain */
+		}
+	}
+	dv_barrier();
+
+	/* Free the control blocks of the stages that are no longer used, then move the new stages'
+	 * control blocks into the arena.
+	*/
+	effect_arena_reclaim();
+
+	for ( e = effect_list.next; e != DV_NULL; e = e->next )
+	{
+		if ( effect_is_pipe(e) || e->control_size == 0 )
+		{
+			e->control_stride = 0;
+		}
+		else if ( !effect_in_arena(e->control) )
+		{
+			/* A mono stage gets one copy of the control block per channel.
+			*/
+			dv_u32_t stride = (e->control_size + sizeof(dv_u64_t) - 1) & ~(sizeof(dv_u64_t) - 1);
+			int nch = (e->framefunc == DV_NULL) ? EFFECT_N_CHANNELS : 1;
+			char *src = (char *)e->control;
+			char *dst = (char *)effect_arena_alloc(e, stride * nch);
+
+			if ( dst == DV_NULL )
+				return -1;
+
+			for ( int c = 0; c < nch; c++ )
+			{
+				for ( dv_u32_t i = 0; i < e->control_size; i++ )
+					dst[c * stride + i] = src[i];
+			}
+
+			e->control = dst;
+			e->control_stride = (nch > 1) ? stride : 0;
+		}
+	}
+
+	for ( core = 0; core < EFFECT_N_CORES; core++ )
+	{
+		ch->segment[core].first = 0;
+		ch->segment[core].n = 0;
+	}
+
+	n = 0;
+	core = EFFECT_FIRST_CORE;
+	effect_generation++;
+	for ( e = effect_list.next; e != DV_NULL; e = e->next )
+	{
+		e->core = core;
+		e->published = effect_generation;
+
+		if ( effect_is_pipe(e) )
+		{
+			struct effect_s rx = *e;
+
+			effect_emit(ch, e, &ch->segment[core], &n);		/* Send */
+
+			core = ((struct effect_pipe_s *)e->control)->core;
+			rx.framefunc = &effect_pipe_receive;
+			rx.name = "pipe-rx";
+			effect_emit(ch, &rx, &ch->segment[core], &n);	/* Receive */
+		}
+		else
+		{
+			effect_emit(ch, e, &ch->segment[core], &n);
+		}
+	}
+
+	/* Publish the new chain.
+	*/
+	dv_barrier();
+	effect_published = ch;
+	dv_barrier();
+
+	return 0;
+}
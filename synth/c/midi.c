@@ -56,7 +56,7 @@ void midi_scan(void)
 		else if ( midi_idx > 0 )
 		{
 			midi_command[midi_idx++] = c;
-			if ( ( (midi_command[1] & 0xf0) == 0xd0 ) || midi_idx >= 3 )
+			if ( ( (midi_command[0] & 0xf0) == 0xd0 ) || midi_idx >= 3 )
 			{
 				midi_idx = 0;
 				dispatch_midi_command(midi_command);
@@ -82,11 +82,11 @@ void midi_scan(void)
 
 /* dispatch_midi_command() - dispatch a 2- or 3-byte midi command.
  *
- * Currently only 9 (note on), 8 (note off) and b (controller change) are recognised.
- * Any other commands are ignored.
+ * Currently only 9 (note on), 8 (note off), b (controller change) and d (channel pressure)
+ * are recognised. Any other commands are ignored.
  *
  * Note on and note off are sent to a note queue and will be picked up by the synth's main loop.
- * Controller changes are made immediately.
+ * Controller changes are made immediately. Channel pressure is a controller of the synth.
 */
 static void dispatch_midi_command(dv_u32_t *cmd)
 {
@@ -114,17 +114,25 @@ static void dispatch_midi_command(dv_u32_t *cmd)
 		sy_printf("controller(%d, %d, %d)\n", ch, cmd[1], cmd[2]);
 		controller_change(ch, cmd[1], cmd[2]);
 	}
+	else if ( c == 0xd )	/* Channel pressure */
+	{
+		controller_change(ch, SYNTH_CTRL_PRESSURE, cmd[1]);
+	}
 }
 
-/* controller_change() - forward a controller change message to the appropriate synth
+/* controller_change() - forward a controller change message to the appropriate part of the synth
  *
- * Only handles messages for the channels corresponding to note queues.
+ * Only handles messages for the channels corresponding to note queues: part p reads queue p.
  * To do - generalise the note queue to be a control interface too.
 */
 static void controller_change(dv_u32_t ch, dv_u32_t id, dv_u32_t val)
 {
-	if ( ch == notechannels.nq[NQ_SYNTH].channel )
+	for ( int p = 0; p < SYNTH_N_PARTS; p++ )
 	{
-		synth_control((dv_i32_t)id, (dv_i32_t)val);
+		if ( ch == notechannels.nq[p].channel )
+		{
+			synth_control(p, (dv_i32_t)id, (dv_i32_t)val);
+			break;
+		}
 	}
 }
@@ -20,6 +20,7 @@
 #include <dv-config.h>
 #include <synth-stdio.h>
 #include <monitor.h>
+#include <effect-synth.h>
 
 struct monitor_elapsed_s core1_loop;
 struct monitor_elapsed_s core1_idle;
@@ -30,8 +31,103 @@ struct monitor_elapsed_s core2_idle;
 struct monitor_elapsed_s core3_loop;
 struct monitor_elapsed_s core3_idle;
 
+struct monitor_xrun_s dac_xrun;
+
 int monitor_pace;
 
+#if EFFECT_PROFILE
+static struct monitor_stage_s monitor_stage[MONITOR_N_STAGES];
+static int monitor_n_stage;
+
+/* monitor_same_name() - returns true if two stage names are the same
+*/
+static dv_boolean_t monitor_same_name(const char *a, const char *b)
+{
+	while ( *a != '\0' && *a == *b )
+	{
+		a++;
+		b++;
+	}
+	return *a == *b;
+}
+
+/* monitor_stage_find() - find (or create) the timing entry for a stage on a core
+ *
+ * Called by effect_compile(). If the table is full, the last entry is shared.
+*/
+struct monitor_stage_s *monitor_stage_find(char *name, dv_i32_t core)
+{
+	struct monitor_stage_s *ms;
+
+	if ( name == DV_NULL )
+		name = "***Unknown***";
+
+	for ( int i = 0; i < monitor_n_stage; i++ )
+	{
+		ms = &monitor_stage[i];
+		if ( ms->core == core && monitor_same_name(ms->name, name) )
+			return ms;
+	}
+
+	if ( monitor_n_stage >= MONITOR_N_STAGES )
+		return &monitor_stage[MONITOR_N_STAGES-1];
+
+	ms = &monitor_stage[monitor_n_stage++];
+	ms->name = name;
+	ms->core = core;
+	ms->n = 0;
+	return ms;
+}
+
+/* monitor_stage_enable() - enable the PMU cycle counter (or L2 refill counter) on the calling core
+*/
+void monitor_stage_enable(void)
+{
+#if EFFECT_PROFILE == 2 && defined(__aarch64__)
+	dv_u64_t pmcr;
+	__asm volatile ("mrs %0, pmcr_el0" : "=r"(pmcr));
+	__asm volatile ("msr pmcr_el0, %0" : : "r"(pmcr | 0x1));				/* E: enable counters */
+	__asm volatile ("msr pmcntenset_el0, %0" : : "r"(0x80000000uL));		/* C: enable cycle counter */
+#elif EFFECT_PROFILE == 3 && defined(__aarch64__)
+	dv_u64_t pmcr;
+	__asm volatile ("msr pmevtyper0_el0, %0" : : "r"((dv_u64_t)MONITOR_PMU_L2D_REFILL));
+	__asm volatile ("mrs %0, pmcr_el0" : "=r"(pmcr));
+	__asm volatile ("msr pmcr_el0, %0" : : "r"(pmcr | 0x1));				/* E: enable counters */
+	__asm volatile ("msr pmcntenset_el0, %0" : : "r"(0x1uL));				/* P0: enable event counter 0 */
+#endif
+}
+
+/* monitor_stage_print() - report the timing of all the stages, then restart the measurement
+ *
+ * The histogram is printed from the lowest to the highest non-empty bucket. The first
+ * number is the lowest bucket's power of two.
+*/
+void monitor_stage_print(void)
+{
+	for ( int i = 0; i < monitor_n_stage; i++ )
+	{
+		struct monitor_stage_s *ms = &monitor_stage[i];
+		int lo, hi;
+
+		if ( ms->n == 0 )
+			continue;
+
+		sy_printf("Stage %s (core %d): n = %u, min = %u, mean = %u, max = %u\n", ms->name, ms->core,
+					ms->n, ms->min, (dv_u32_t)(ms->total / ms->n), ms->max);
+
+		for ( lo = 0; lo < MONITOR_HIST_N-1 && ms->hist[lo] == 0; lo++ )	{ }
+		for ( hi = MONITOR_HIST_N-1; hi > lo && ms->hist[hi] == 0; hi-- )	{ }
+
+		sy_printf("  hist 2^%d:", lo);
+		for ( int b = lo; b <= hi; b++ )
+			sy_printf(" %u", ms->hist[b]);
+		sy_printf("\n");
+
+		ms->n = 0;
+	}
+}
+#endif
+
 /* Monitor_main() - monitor task main function
  *
  * Runs once per second
@@ -54,33 +150,49 @@ void Monitor_main(void)
 		print_elapsed(&core1_idle, "Idle 1");
 		core1_idle.init = 0;
 		break;
+	/* Cores 2 and 3 are only reported if they're running part of the effect chain.
+	*/
 	case 2:
-#if 0
-		print_elapsed(&core2_loop, "Loop 2");
-		core2_loop.init = 0;
+		if ( core2_loop.init )
+		{
+			print_elapsed(&core2_loop, "Loop 2");
+			core2_loop.init = 0;
+		}
 		break;
-#endif
 	case 3:
-#if 0
-		print_elapsed(&core2_idle, "Idle 2");
-		core2_idle.init = 0;
+		if ( core2_idle.init )
+		{
+			print_elapsed(&core2_idle, "Idle 2");
+			core2_idle.init = 0;
+		}
 		break;
-#endif
 	case 4:
-#if 0
-		print_elapsed(&core3_loop, "Loop 3");
-		core3_loop.init = 0;
+		if ( core3_loop.init )
+		{
+			print_elapsed(&core3_loop, "Loop 3");
+			core3_loop.init = 0;
+		}
 		break;
-#endif
 	case 5:
-#if 0
-		print_elapsed(&core3_idle, "Idle 3");
-		core3_idle.init = 0;
+		if ( core3_idle.init )
+		{
+			print_elapsed(&core3_idle, "Idle 3");
+			core3_idle.init = 0;
+		}
 		break;
-#endif
 	case 6:
+#if EFFECT_PROFILE
+		monitor_stage_print();
+#endif
+		break;
 	case 7:
+		print_xrun(&dac_xrun, "Xrun");
+		break;
 	case 8:
+#if SYNTH_GOVERNOR
+		synth_print_governor();
+#endif
+		break;
 	case 9:
 	default:
 		break;
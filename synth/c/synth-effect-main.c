@@ -33,6 +33,7 @@
 #include <effect-adc.h>
 #include <effect-dac.h>
 #include <effect-synth.h>
+#include <effect-pipe.h>
 
 volatile dv_boolean_t effect_sync;
 
@@ -44,9 +45,15 @@ volatile dv_boolean_t effect_sync;
 #define EFFECT_STAGE_DAC	1
 #define EFFECT_STAGE_CTRL	2		/* For single-core */
 #define EFFECT_STAGE_SYNTH	3
+#define EFFECT_STAGE_PIPE2	4		/* Pipe to core 2 */
+#define EFFECT_STAGE_PIPE3	5		/* Pipe to core 3 */
 
 struct effect_s effect_stage[N_EFFECT_STAGES];
 
+#if EFFECT_PIPELINE
+struct effect_pipe_s effect_pipe[2];
+#endif
+
 /* syntheffect_init() - the function that runs at startup
  *
  * Initialise all the synth data structures
@@ -60,19 +67,6 @@ void syntheffect_init(void)
 	charbuf_init();
 	notechannels_init();
 
-	/* Initialise the waveform tables
-	*/
-	sy_printf("syntheffect_init: calling wave_init().\n");
-	if ( wave_init() != 0 )
-	{
-		panic("wave_init", "Oops! wave buffer too small");
-	}
-
-	/* Generate a set of root waveforms
-	*/
-	sy_printf("syntheffect_init: calling wave_generate(SAW).\n");
-	wave_generate(SAW);
-
 	/* Initialise an initial set of effect stages
 	*/
 	sy_printf("syntheffect_init: calling effect_init().\n");
@@ -88,10 +82,28 @@ void syntheffect_init(void)
 	effect_synth_init(&effect_stage[EFFECT_STAGE_SYNTH]);
 	effect_append(&effect_stage[EFFECT_STAGE_SYNTH]);
 
+#if EFFECT_PIPELINE
+	/* Synth on core 1, effects on core 2, output on core 3
+	*/
+	sy_printf("syntheffect_init: adding pipe to core 2\n");
+	effect_pipe_init(&effect_stage[EFFECT_STAGE_PIPE2], &effect_pipe[0], 2);
+	effect_append(&effect_stage[EFFECT_STAGE_PIPE2]);
+
+	sy_printf("syntheffect_init: adding pipe to core 3\n");
+	effect_pipe_init(&effect_stage[EFFECT_STAGE_PIPE3], &effect_pipe[1], 3);
+	effect_append(&effect_stage[EFFECT_STAGE_PIPE3]);
+#endif
+
 	sy_printf("syntheffect_init: adding DAC effect\n");
 	effect_dac_init(&effect_stage[EFFECT_STAGE_DAC]);		/* DAC output stage */
 	effect_append(&effect_stage[EFFECT_STAGE_DAC]);
 
+	sy_printf("syntheffect_init: compiling effect chain\n");
+	if ( effect_compile() != 0 )
+	{
+		panic("effect_compile", "Oops! too many effect stages or control arena too small");
+	}
+
 	{
 		struct effect_s *e = effect_list.next;
 
@@ -140,7 +152,7 @@ void run_core1(void)
 	/* Do the stuff!
 	*/
 	sy_printf("run_core1: calling effect_processor()\n");
-	effect_processor();		/* Never returns */
+	effect_processor(1);		/* Never returns */
 }
 
 void run_core2(void)
@@ -151,13 +163,18 @@ void run_core2(void)
 	{
 	}
 
-	/* Nothing to do yet
+#if SYNTH_VOICE_WORKERS > 0
+	/* Render a share of the synth voices
 	*/
-	sy_printf("run_core2: sleeping\n");
-	for (;;)
-	{
-		__asm ("wfe");
-	}
+	sy_printf("run_core2: calling synth_voice_worker()\n");
+	synth_voice_worker(0);		/* Never returns */
+#endif
+
+	/* Run this core's part of the effect chain. The segment might be empty now, but a pipe to
+	 * this core can be added at any time (see effect_compile()), so the core has to be ready.
+	*/
+	sy_printf("run_core2: calling effect_processor()\n");
+	effect_processor(2);		/* Never returns */
 }
 
 void run_core3(void)
@@ -168,13 +185,18 @@ void run_core3(void)
 	{
 	}
 
-	/* Nothing to do yet
+#if SYNTH_VOICE_WORKERS > 1
+	/* Render a share of the synth voices
 	*/
-	sy_printf("run_core3: sleeping\n");
-	for (;;)
-	{
-		__asm ("wfe");
-	}
+	sy_printf("run_core3: calling synth_voice_worker()\n");
+	synth_voice_worker(1);		/* Never returns */
+#endif
+
+	/* Run this core's part of the effect chain. The segment might be empty now, but a pipe to
+	 * this core can be added at any time (see effect_compile()), so the core has to be ready.
+	*/
+	sy_printf("run_core3: calling effect_processor()\n");
+	effect_processor(3);		/* Never returns */
 }
 
 void panic(char *func, char *msg)
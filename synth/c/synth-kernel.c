@@ -0,0 +1,431 @@
+/*	synth-kernel.c - the synth's voice rendering kernel
+ *
+ *	Copyright 2026 David Haworth
+ *
+ *	This file is part of SynthEffect.
+ *
+ *	SynthEffect is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	SynthEffect is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with SynthEffect.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <dv-config.h>
+#include <davroska.h>
+#include <synth-config.h>
+
+#include <effect-synth.h>
+#include <adsr.h>
+
+#if SYNTH_SIMD && defined(__aarch64__)
+#include <arm_neon.h>
+#define SYNTH_NEON	1
+#elif SYNTH_SIMD && defined(__x86_64__)
+#include <emmintrin.h>
+#define SYNTH_SSE2	1
+#endif
+
+/* synth_render_group_ref() - render n samples of the voices of group g that are selected by lanes
+ *
+ * This is the scalar reference: each voice is played one sample at a time by synth_play_voice().
+ * The voices' signals are added to mix. A voice whose envelope finishes is removed from
+ * voice.lanes[g].
+*/
+void synth_render_group_ref(int g, dv_u32_t lanes, dv_i64_t *mix, int n)
+{
+	for ( int l = 0; l < SYNTH_LANES; l++ )
+	{
+		if ( (lanes & (1u << l)) == 0 )
+			continue;
+
+		for ( int s = 0; s < n; s++ )
+			mix[s] += synth_play_voice(g * SYNTH_LANES + l);
+	}
+}
+
+/* synth_render_unison_ref() - render n samples of the unison note of group g
+ *
+ * This is the scalar reference: the note is played one sample at a time by synth_play_unison().
+ * Its signal is added to left and right.
+*/
+void synth_render_unison_ref(int g, dv_i64_t *left, dv_i64_t *right, int n)
+{
+	for ( int s = 0; s < n; s++ )
+	{
+		dv_i64_t r;
+
+		left[s] += synth_play_unison(g * SYNTH_LANES, &r);
+		right[s] += r;
+	}
+}
+
+#if SYNTH_SIMD
+/* The SIMD kernel processes SYNTH_LANES voices side by side. The lane-wise logic is written with
+ * the compiler's vector extension, which generates NEON code on the Pi and SSE2 code on a host.
+ * Comparisons give a mask with all bits set (-1) in the lanes where they're true, so they're used
+ * with & and | to select between values. Only the widening (32 x 32 -> 64 bit) multiplications
+ * use the architecture's intrinsics.
+ *
+ * The result must be identical to synth_render_group_ref():
+ *	- the envelope divisions use the reciprocals in the ADSR profile (see adsr_recip())
+ *	- the VCA divides by ADSR_GMAX with a shift, rounding towards zero as the C division does
+ *	- the wave table reads are done lane by lane, for the active voices only, and interpolated as
+ *	  wave_sample() does (see synth_vwave())
+*/
+#if SYNTH_LANES != 4
+#error "The SIMD voice kernel has 4 lanes"
+#endif
+#if ADSR_GMAX != 128
+#error "The SIMD voice kernel expects ADSR_GMAX == 128"
+#endif
+#define SYNTH_GMAX_SHIFT	7
+#if SYNTH_PAN1 != 128
+#error "The SIMD voice kernel expects SYNTH_PAN1 == 128"
+#endif
+#define SYNTH_PAN_SHIFT		7
+
+typedef dv_i32_t synth_v4_t __attribute__((vector_size(16)));
+typedef dv_u32_t synth_v4u_t __attribute__((vector_size(16)));
+typedef dv_i64_t synth_v2l_t __attribute__((vector_size(16)));
+
+#define SYNTH_SEL(m, a, b)	(((a) & (m)) | ((b) & ~(m)))
+
+static const wave_sample_t synth_silence[2] = { 0, 0 };		/* A cycle and its guard */
+
+/* synth_vdiv() - divide each lane by a constant, using its reciprocal m and shift s
+*/
+static inline synth_v4_t synth_vdiv(synth_v4_t x, dv_u32_t m, dv_u32_t s)
+{
+#if SYNTH_NEON
+	uint32x4_t ux = (uint32x4_t)x;
+	uint64x2_t lo = vmull_u32(vget_low_u32(ux), vdup_n_u32(m));
+	uint64x2_t hi = vmull_high_u32(ux, vdupq_n_u32(m));
+	int64x2_t sh = vdupq_n_s64(-(dv_i64_t)s);
+
+	lo = vshlq_u64(lo, sh);
+	hi = vshlq_u64(hi, sh);
+	return (synth_v4_t)vcombine_u32(vmovn_u64(lo), vmovn_u64(hi));
+#elif SYNTH_SSE2
+	__m128i ux = (__m128i)x;
+	__m128i um = _mm_set1_epi32((int)m);
+	__m128i cnt = _mm_cvtsi32_si128((int)s);
+	__m128i even = _mm_srl_epi64(_mm_mul_epu32(ux, um), cnt);
+	__m128i odd = _mm_srl_epi64(_mm_mul_epu32(_mm_srli_epi64(ux, 32), um), cnt);
+
+	return (synth_v4_t)_mm_or_si128(_mm_and_si128(even, _mm_set_epi32(0, -1, 0, -1)), _mm_slli_epi64(odd, 32));
+#else
+	synth_v4_t q;
+
+	for ( int l = 0; l < SYNTH_LANES; l++ )
+		q[l] = (dv_i32_t)(((dv_u64_t)(dv_u32_t)x[l] * m) >> s);
+	return q;
+#endif
+}
+
+/* synth_vvca() - return sample * gain / ADSR_GMAX for each lane, with lanes 0 and 2 and lanes
+ * 1 and 3 added together
+ *
+ * The gains are never negative.
+*/
+static inline synth_v2l_t synth_vvca(synth_v4_t sample, synth_v4_t gain)
+{
+#if SYNTH_NEON
+	int32x4_t a = (int32x4_t)sample;
+	int32x4_t g = (int32x4_t)gain;
+	int64x2_t lo = vmull_s32(vget_low_s32(a), vget_low_s32(g));
+	int64x2_t hi = vmull_high_s32(a, g);
+	int64x2_t round = vdupq_n_s64(ADSR_GMAX - 1);
+
+	/* Add GMAX-1 to negative products so that the shift rounds towards zero
+	*/
+	lo = vshrq_n_s64(vaddq_s64(lo, vandq_s64(vshrq_n_s64(lo, 63), round)), SYNTH_GMAX_SHIFT);
+	hi = vshrq_n_s64(vaddq_s64(hi, vandq_s64(vshrq_n_s64(hi, 63), round)), SYNTH_GMAX_SHIFT);
+	return (synth_v2l_t)vaddq_s64(lo, hi);
+#elif SYNTH_SSE2
+	/* SSE2 only has an unsigned 32 x 32 multiply, so multiply the magnitudes and restore the signs
+	*/
+	__m128i a = (__m128i)sample;
+	__m128i g = (__m128i)gain;
+	__m128i sign = _mm_srai_epi32(a, 31);
+	__m128i mag = _mm_sub_epi32(_mm_xor_si128(a, sign), sign);
+	__m128i even = _mm_srli_epi64(_mm_mul_epu32(mag, g), SYNTH_GMAX_SHIFT);
+	__m128i odd = _mm_srli_epi64(_mm_mul_epu32(_mm_srli_epi64(mag, 32), _mm_srli_epi64(g, 32)), SYNTH_GMAX_SHIFT);
+	__m128i s_even = _mm_shuffle_epi32(sign, _MM_SHUFFLE(2, 2, 0, 0));
+	__m128i s_odd = _mm_shuffle_epi32(sign, _MM_SHUFFLE(3, 3, 1, 1));
+
+	even = _mm_sub_epi64(_mm_xor_si128(even, s_even), s_even);
+	odd = _mm_sub_epi64(_mm_xor_si128(odd, s_odd), s_odd);
+	return (synth_v2l_t)_mm_add_epi64(even, odd);
+#else
+	synth_v2l_t sum = { 0, 0 };
+
+	for ( int l = 0; l < SYNTH_LANES; l++ )
+		sum[l & 1] += ((dv_i64_t)sample[l] * (dv_i64_t)gain[l]) / ADSR_GMAX;
+	return sum;
+#endif
+}
+
+/* synth_vwave() - return the amplitude of each lane's wave table at the lane's phase, as wave_sample() does
+ *
+ * The reads are done lane by lane because each lane has its own table, with its own length (sh).
+ * The interpolation is done side by side, in unsigned arithmetic as in wave_sample().
+*/
+static inline synth_v4_t synth_vwave(const wave_sample_t *const *tab, const dv_u32_t *sh, synth_v4u_t ph)
+{
+	const dv_u32_t i0 = ph[0] >> sh[0];
+	const dv_u32_t i1 = ph[1] >> sh[1];
+	const dv_u32_t i2 = ph[2] >> sh[2];
+	const dv_u32_t i3 = ph[3] >> sh[3];
+#if WAVE_SAMPLE_BITS == 16
+	synth_v4_t s0 = { tab[0][i0], tab[1][i1], tab[2][i2], tab[3][i3] };
+	synth_v4_t s1 = { tab[0][i0+1], tab[1][i1+1], tab[2][i2+1], tab[3][i3+1] };
+	synth_v4u_t f = { ph[0] >> (sh[0] - WAVE_INTERP_BITS), ph[1] >> (sh[1] - WAVE_INTERP_BITS),
+					  ph[2] >> (sh[2] - WAVE_INTERP_BITS), ph[3] >> (sh[3] - WAVE_INTERP_BITS) };
+	synth_v4u_t d = (synth_v4u_t)((s1 - s0) * (synth_v4_t)(f & ((1u << WAVE_INTERP_BITS) - 1)));
+
+	return (synth_v4_t)(((synth_v4u_t)s0 << 16) + (d << (16 - WAVE_INTERP_BITS)));
+#else
+	synth_v4_t s = { tab[0][i0], tab[1][i1], tab[2][i2], tab[3][i3] };
+
+	return s;
+#endif
+}
+
+/* synth_render_group() - render n samples of the voices of group g that are selected by lanes
+ *
+ * SIMD version of synth_render_group_ref(). The voices' state is held in vectors for the whole
+ * block. Each step does what adsr_gen() and synth_play_voice() do, for all the lanes at once,
+ * including the ramp of the amplitude modulation.
+*/
+void synth_render_group(int g, dv_u32_t lanes, dv_i64_t *mix, int n)
+{
+	const struct adsr_s *adsr = &synth_patch[voice.part[g]].adsr;
+	const synth_v4_t bit = { 1, 2, 4, 8 };
+	const synth_v4_t valid = (bit & (dv_i32_t)lanes) != 0;
+	const int v = g * SYNTH_LANES;
+	synth_v4_t pos, gain, age, fade, fgain, act, amp, amp_step;
+	synth_v4u_t phase, incr;
+	synth_v2l_t part[EFFECT_BLOCK_LEN];
+	int s;
+
+	__builtin_memcpy(&pos, &voice.env_pos[v], sizeof(pos));
+
+	act = (pos >= 0) & valid;
+	if ( (act[0] | act[1] | act[2] | act[3]) == 0 )
+		return;								/* All silent */
+
+	__builtin_memcpy(&gain, &voice.gain[v], sizeof(gain));
+	__builtin_memcpy(&phase, &voice.phase[v], sizeof(phase));
+	__builtin_memcpy(&incr, &voice.incr[v], sizeof(incr));
+	__builtin_memcpy(&age, &voice.age[v], sizeof(age));
+	__builtin_memcpy(&fade, &voice.fade[v], sizeof(fade));
+	__builtin_memcpy(&fgain, &voice.fade_gain[v], sizeof(fgain));
+	__builtin_memcpy(&amp, &voice.amp[v], sizeof(amp));
+	__builtin_memcpy(&amp_step, &voice.amp_step[v], sizeof(amp_step));
+
+	/* The wave tables of the silent lanes are replaced by a table of silence. A lane that falls
+	 * silent during the block keeps its table, but it reads sample 0 and the gain is zero.
+	 * Each lane's table has its own length, so the shift to the position is done in the
+	 * lane-by-lane reads.
+	*/
+	const wave_sample_t *tab[SYNTH_LANES];
+	dv_u32_t sh[SYNTH_LANES];
+
+	for ( int l = 0; l < SYNTH_LANES; l++ )
+	{
+		tab[l] = act[l] ? voice.table[v + l] : synth_silence;
+		sh[l] = act[l] ? voice.shift[v + l] : 32 - WAVE_BITS;
+	}
+
+	const dv_i32_t tA = adsr->tAttack;
+	const dv_i32_t tS = adsr->tSustain;
+	const dv_i32_t tT = adsr->tTotal;
+	const dv_i32_t gS = adsr->gSustain;
+	const dv_i32_t gD = adsr->gDecay;
+
+	for ( s = 0; s < n; s++ )
+	{
+		act = (pos >= 0) & valid;
+
+		if ( (act[0] | act[1] | act[2] | act[3]) == 0 )
+			break;
+
+		/* Envelope: the phase is chosen by the position before the step, as in adsr_gen().
+		 * Usually all the voices are sustaining, so the divisions are skipped.
+		 * A voice that is fading out after being stolen ignores its envelope.
+		*/
+		synth_v4_t in_f = fade > 0;
+		synth_v4_t in_s = (pos == tS) & ~in_f;
+		synth_v4_t g;
+
+		if ( ((in_s | ~act)[0] & (in_s | ~act)[1] & (in_s | ~act)[2] & (in_s | ~act)[3]) != 0 )
+		{
+			g = gS & act;
+		}
+		else
+		{
+			synth_v4_t pos1 = pos + 1;
+			synth_v4_t in_a = pos < tA;
+			synth_v4_t in_r = pos > tS;
+			synth_v4_t in_d = ~(in_a | in_s | in_r);
+			synth_v4_t end = in_r & (pos1 > tT);
+
+			synth_v4_t g_a = synth_vdiv(pos1 * ADSR_GMAX, adsr->mAttack, adsr->sAttack);
+			synth_v4_t num = SYNTH_SEL(in_d, (pos1 - tA) * gD, (pos1 - tS) * gS);
+			synth_v4_t g_dr = synth_vdiv(num, adsr->mDecay, adsr->sDecay) + (in_d & gS);
+			synth_v4_t pos_next = SYNTH_SEL(in_s, pos, SYNTH_SEL(end, -1, pos1));
+
+			g = SYNTH_SEL(in_a, g_a, SYNTH_SEL(in_s, gS, g_dr)) & ~end;
+
+			/* Fast release
+			*/
+			synth_v4_t fade1 = fade - 1;
+			synth_v4_t g_f = (fgain * fade1) >> SYNTH_FADE_SHIFT;
+
+			in_f &= act;
+			pos_next = SYNTH_SEL(in_f, SYNTH_SEL(fade1 == 0, -1, pos), pos_next);
+			g = SYNTH_SEL(in_f, g_f, g) & act;
+			fade = SYNTH_SEL(in_f, fade1, fade);
+			pos = SYNTH_SEL(act, pos_next, pos);
+		}
+
+		gain = SYNTH_SEL(act, g, gain);
+		age -= act;							/* act is -1 in the active lanes */
+
+		/* Modulation: the amplitude ramps towards the value for the end of the block
+		*/
+		amp = SYNTH_SEL(act, amp + amp_step, amp);
+
+		/* Tone: the phase wraps round by itself, and its top bits are the position in the table.
+		 * The silent lanes read sample 0 of a silent table.
+		*/
+		phase = SYNTH_SEL((synth_v4u_t)act, phase + incr, phase);
+
+		synth_v4_t sample = synth_vwave(tab, sh, phase & (synth_v4u_t)act);
+
+		/* VCA
+		*/
+		part[s] = synth_vvca(sample, (g * amp) >> SYNTH_AMP_SHIFT);
+	}
+
+	/* The partial sums are added to the mix after the loop, which keeps the loop free of
+	 * horizontal additions. s is the number of samples rendered before all the lanes fell silent.
+	*/
+	for ( int i = 0; i < s; i++ )
+		mix[i] += part[i][0] + part[i][1];
+
+	__builtin_memcpy(&voice.env_pos[v], &pos, sizeof(pos));
+	__builtin_memcpy(&voice.gain[v], &gain, sizeof(gain));
+	__builtin_memcpy(&voice.phase[v], &phase, sizeof(phase));
+	__builtin_memcpy(&voice.age[v], &age, sizeof(age));
+	__builtin_memcpy(&voice.fade[v], &fade, sizeof(fade));
+	__builtin_memcpy(&voice.amp[v], &amp, sizeof(amp));
+
+	/* Remove the voices that have finished
+	*/
+	for ( int l = 0; l < SYNTH_LANES; l++ )
+	{
+		if ( valid[l] && pos[l] < 0 )
+			voice.lanes[g] &= (dv_u8_t)~(1u << l);
+	}
+}
+
+/* synth_render_unison() - render n samples of the unison note of group g
+ *
+ * SIMD version of synth_render_unison_ref(). The lanes are the note's oscillators. The envelope
+ * is the note's, so it's computed once per sample by the scalar synth_voice_envelope(); the
+ * oscillators' phases, wave table reads and VCAs are done side by side. Each oscillator has
+ * a left and a right gain, which are the envelope's gain weighted as in synth_play_unison().
+*/
+void synth_render_unison(int g, dv_i64_t *left, dv_i64_t *right, int n)
+{
+	const int v = g * SYNTH_LANES;
+	const int n_osc = voice.n_osc[g];
+	const int spread = synth_patch[voice.part[g]].spread;
+	synth_v4_t osc, pan_l, pan_r;
+	synth_v4u_t phase, incr;
+	synth_v2l_t part_l[EFFECT_BLOCK_LEN];
+	synth_v2l_t part_r[EFFECT_BLOCK_LEN];
+	const wave_sample_t *tab[SYNTH_LANES];
+	dv_u32_t sh[SYNTH_LANES];
+	int s;
+
+	if ( voice.env_pos[v] < 0 )
+		return;
+
+	__builtin_memcpy(&phase, &voice.phase[v], sizeof(phase));
+	__builtin_memcpy(&incr, &voice.incr[v], sizeof(incr));
+
+	/* The lanes beyond the note's oscillators read a table of silence and have no gain.
+	*/
+	for ( int l = 0; l < SYNTH_LANES; l++ )
+	{
+		dv_i32_t pan = (l < n_osc) ? synth_unison_pan(l, n_osc, spread) : 0;
+
+		osc[l] = (l < n_osc) ? -1 : 0;
+		pan_l[l] = ((SYNTH_PAN1 - pan) / n_osc) & osc[l];
+		pan_r[l] = ((SYNTH_PAN1 + pan) / n_osc) & osc[l];
+		tab[l] = (l < n_osc) ? voice.table[v + l] : synth_silence;
+		sh[l] = (l < n_osc) ? voice.shift[v + l] : 32 - WAVE_BITS;
+	}
+
+	/* Usually the note is sustaining, and it stays that way for the whole block because the
+	 * messages only change it between calls. Then the envelope is just the sustain level.
+	*/
+	const struct adsr_s *adsr = &synth_patch[voice.part[g]].adsr;
+	const dv_boolean_t sustain = (voice.env_pos[v] == adsr->tSustain && voice.fade[v] == 0);
+
+	if ( sustain )
+	{
+		voice.age[v] += n;
+		voice.gain[v] = adsr->gSustain;
+	}
+
+	for ( s = 0; s < n; s++ )
+	{
+		if ( voice.env_pos[v] < 0 )
+			break;
+
+		dv_i32_t gain = synth_voice_amp(v, sustain ? adsr->gSustain : synth_voice_envelope(v));
+
+		/* Tone: as in synth_render_group()
+		*/
+		phase = SYNTH_SEL((synth_v4u_t)osc, phase + incr, phase);
+
+		synth_v4_t sample = synth_vwave(tab, sh, phase & (synth_v4u_t)osc);
+
+		/* VCA: the weights are no more than SYNTH_PAN1, so the gains are no more than ADSR_GMAX
+		*/
+		part_l[s] = synth_vvca(sample, (pan_l * gain) >> SYNTH_PAN_SHIFT);
+		if ( spread != 0 )
+			part_r[s] = synth_vvca(sample, (pan_r * gain) >> SYNTH_PAN_SHIFT);
+	}
+
+	/* With no spread, the left and right gains are the same
+	*/
+	for ( int i = 0; i < s; i++ )
+	{
+		left[i] += part_l[i][0] + part_l[i][1];
+		right[i] += (spread != 0) ? part_r[i][0] + part_r[i][1] : part_l[i][0] + part_l[i][1];
+	}
+
+	__builtin_memcpy(&voice.phase[v], &phase, sizeof(phase));
+}
+#else
+void synth_render_group(int g, dv_u32_t lanes, dv_i64_t *mix, int n)
+{
+	synth_render_group_ref(g, lanes, mix, n);
+}
+
+void synth_render_unison(int g, dv_i64_t *left, dv_i64_t *right, int n)
+{
+	synth_render_unison_ref(g, left, right, n);
+}
+#endif
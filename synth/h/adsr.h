@@ -45,6 +45,14 @@ struct adsr_s
 	dv_i32_t gDecay;	/* Level difference between gSustain and gMax */
 	dv_i32_t tSustain;	/* tAttack + tDecay */
 	dv_i32_t tTotal;	/* tAttack + tDecay + tRelease */
+
+	/* Reciprocals of tAttack and tDecay: x / t == (x * m) >> s for 0 <= x < 2^30.
+	 * The SIMD voice kernel uses them because there's no vector divide instruction.
+	*/
+	dv_u32_t mAttack;
+	dv_u32_t sAttack;
+	dv_u32_t mDecay;
+	dv_u32_t sDecay;
 };
 
 extern void adsr_init(struct adsr_s *adsr, dv_i32_t a, dv_i32_t d, dv_i32_t s, dv_i32_t r, dv_i32_t sps);
@@ -62,6 +70,69 @@ struct envelope_s
 	char state;					/* State: a,d,s,r or x */
 };
 
+/* adsr_gen() - the envelope generator for a position in an ADSR profile.
+ *
+ * Advances the position and returns the gain. Called once for every sample. The position is -1
+ * when the envelope is not in use and is set to -1 at the end of the release phase.
+ * This is the core of envelope_gen(); the synth's voice bank calls it directly.
+*/
+static inline dv_i32_t adsr_gen(const struct adsr_s *adsr, int *position)
+{
+	int p = *position;
+
+	if ( p < 0 )
+		return 0;					/* Not in use */
+
+	if ( p < adsr->tAttack )
+	{
+		/* Attack phase
+		*/
+		*position = ++p;
+		return (ADSR_GMAX * p) / adsr->tAttack;
+	}
+
+	if ( p < adsr->tSustain )
+	{
+		/* Decay phase
+		*/
+		*position = ++p;
+		return adsr->gSustain + (adsr->gDecay * (p - adsr->tAttack)) / adsr->tDecay;
+	}
+
+	if ( p == adsr->tSustain )
+	{
+		/* Sustain phase
+		*/
+		return adsr->gSustain;
+	}
+
+	p++;
+
+	if ( p <= adsr->tTotal )
+	{
+		/* Release phase
+		*/
+		*position = p;
+		return adsr->gSustain * (p - adsr->tSustain) / adsr->tDecay;
+	}
+
+	/* End of release phase
+	*/
+	*position = -1;
+	return 0;
+}
+
+/* adsr_release() - go straight to the release phase unless already released.
+ *
+ * This might be a bit drastic if the note has a low sustain level and is released
+ * during the attack or decay phase. We'll have to see.
+*/
+static inline void adsr_release(const struct adsr_s *adsr, int *position)
+{
+	if ( (*position >= 0)  && (*position <= adsr->tSustain) )
+		*position = adsr->tSustain + 1;
+}
+
 dv_i32_t envelope_gen(struct envelope_s *env);
 
 static inline void envelope_start(struct envelope_s *env)
@@ -74,13 +145,7 @@ static inline void envelope_start(struct envelope_s *env)
 
 static inline void envelope_stop(struct envelope_s *env)
 {
-	/* Go straight to the release phase unless already released.
-	 *
-	 * This might be a bit drastic if the note has a low sustain level and is released
-	 * during the attack or decay phase. We'll have to see.
-	*/
-	if ( (env->position >= 0)  && (env->position <= env->adsr->tSustain) )
-		env->position = env->adsr->tSustain + 1;
+	adsr_release(env->adsr, &env->position);
 #if 0
 	sy_printf("e.stop: %d\n", env->position);
 #endif
@@ -27,13 +27,14 @@
 
 struct effect_adc_s
 {
-	dv_i32_t select;	/* non-zero ==> right, zero ==> left */
+	dv_i32_t select;	/* non-zero ==> right, zero ==> left (mono input only) */
 	dv_i32_t pace;
 };
 
 extern struct effect_adc_s effect_adc;
 
 extern dv_i64_t effect_adc_input(struct effect_s *e, dv_i64_t signal);
+extern void effect_adc_frame(struct effect_s *e, struct effect_block_s *b, int n);
 extern void effect_adc_init(struct effect_s *e);
 
 #endif
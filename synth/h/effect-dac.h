@@ -28,11 +28,12 @@ struct effect_dac_s
 {
 	dv_i64_t max;
 	dv_i64_t min;
-	dv_i32_t select;	/* non-zero ==> right, zero ==> left */
+	dv_i32_t select;	/* non-zero ==> right, zero ==> left (mono output only) */
 };
 
 extern struct effect_dac_s effect_dac;
 
 extern dv_i64_t effect_dac_output(struct effect_s *e, dv_i64_t input);
+extern void effect_dac_frame(struct effect_s *e, struct effect_block_s *b, int n);
 extern void effect_dac_init(struct effect_s *e);
 #endif
@@ -0,0 +1,64 @@
+/*	effect-pipe.h - header file for inter-core pipeline stages
+ *
+ *	Copyright 2026 David Haworth
+ *
+ *	This file is part of SynthEffect.
+ *
+ *	SynthEffect is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	SynthEffect is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with SynthEffect.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef EFFECT_PIPE_H
+#define EFFECT_PIPE_H	1
+
+#include <dv-config.h>
+#include <davroska.h>
+#include <synth-config.h>
+
+#include <effect.h>
+
+/* A pipe splits the effect chain between two cores.
+ *
+ * In the editing list a pipe is a single stage. When the list is compiled the pipe becomes a
+ * "send" stage at the end of one core's part of the chain and a "receive" stage at the start
+ * of the next core's part. The blocks are passed through a lock-free single-producer/single-consumer
+ * FIFO of EFFECT_PIPE_LEN blocks. All channels are passed.
+ *
+ * The FIFO is primed with EFFECT_PIPE_LATENCY blocks of silence, which is the extra latency
+ * (in blocks) that the pipe adds. It gives the cores some slack to absorb jitter in each other's
+ * processing time. The producer waits if the FIFO is full; the consumer waits if it is empty.
+ *
+ * head and tail are free-running counters. Each is written by only one core.
+*/
+struct effect_pipe_s
+{
+	volatile dv_u32_t head;				/* Blocks consumed; written by the consumer */
+	dv_u32_t pad1[15];
+	volatile dv_u32_t tail;				/* Blocks produced; written by the producer */
+	dv_u32_t pad2[15];
+	dv_i32_t core;						/* The core that runs the stages after the pipe */
+	struct effect_block_s block[EFFECT_PIPE_LEN];
+};
+
+extern void effect_pipe_init(struct effect_s *e, struct effect_pipe_s *p, dv_i32_t core);
+extern dv_i64_t effect_pipe_passthru(struct effect_s *e, dv_i64_t signal);
+extern void effect_pipe_send(struct effect_s *e, struct effect_block_s *b, int n);
+extern void effect_pipe_receive(struct effect_s *e, struct effect_block_s *b, int n);
+
+/* effect_is_pipe() - returns true if the stage is a pipe
+*/
+static inline dv_boolean_t effect_is_pipe(struct effect_s *e)
+{
+	return e->framefunc == &effect_pipe_send;
+}
+
+#endif
@@ -25,29 +25,327 @@
 #include <synth-config.h>
 
 #include <effect.h>
+#include <notequeue.h>
 #include <adsr.h>
 #include <wave.h>
 
-struct effect_synth_mono_s
+/* The voice bank has SYNTH_FADE_VOICES more voices than notes, so that a stolen note can fade
+ * out while the new note starts on another voice.
+ *
+ * The voices are rendered in groups of SYNTH_LANES adjacent voices by synth_render_group(),
+ * which processes the voices of a group side by side (SYNTH_SIMD). Voice v is in group
+ * v / SYNTH_LANES.
+*/
+#define SYNTH_N_VOICES		(MAX_POLYPHONIC + SYNTH_FADE_VOICES)
+#define SYNTH_LANES			4
+#define SYNTH_N_GROUPS		(SYNTH_N_VOICES / SYNTH_LANES)
+
+#if (SYNTH_N_VOICES % SYNTH_LANES) != 0
+#error "MAX_POLYPHONIC + SYNTH_FADE_VOICES must be a multiple of SYNTH_LANES"
+#endif
+#if SYNTH_N_VOICES > 256
+#error "MAX_POLYPHONIC is too big for the voice index in a voice worker's event"
+#endif
+#if SYNTH_N_PARTS > N_NQ
+#error "Each part of the synth needs a note queue"
+#endif
+
+/* The voice bank holds the state of all the note generators as a structure of arrays:
+ * voice v is element v of each array. Rendering a sample of all the voices walks each array
+ * in order, so the voice loop touches only the fields it needs, in as few cache lines as possible,
+ * and the voices can be processed side by side.
+ *
+ * The tone generator of a voice is its phase, increment and wave table, as in struct tonegen_s:
+ * a 32-bit phase accumulator that wraps round at the end of each cycle. The table is the level
+ * of the voice's waveform for the increment, so it changes when the pitch is modulated. The
+ * waveform is the patch's when the note starts; changing the patch's waveform doesn't change
+ * the notes that are already sounding. The envelope is its position in its part's ADSR profile, as in struct envelope_s.
+ * A stolen voice leaves the ADSR profile for a fast release: its gain falls linearly from
+ * fade_gain to zero over SYNTH_FADE_LEN samples. fade counts the samples that remain.
+ *
+ * In a unison group (n_osc[g] > 1) the group is one note: lane 0 holds the note's envelope
+ * and lanes 0 to n_osc-1 are its oscillators, detuned from each other. Only lane 0 ever sounds
+ * as far as env_pos and lanes[] are concerned.
+ *
+ * The modulation matrix (see struct synth_patch_s) is evaluated once per block by core 1, which
+ * sets each voice's pitch (cents, via incr) and the amplitude that its envelope
+ * gain is scaled by. The kernel only ramps amp by amp_step per sample towards the new value, so
+ * modulation adds no per-sample work beyond the ramp. For a unison note they're lane 0's.
+ *
+ * lanes[g] has a bit for each sounding voice of group g: bit l ==> voice (g * SYNTH_LANES + l).
+ * A bit is set when the voice starts and cleared when its envelope finishes or the voice is
+ * retired, so the bit is set if and only if env_pos >= 0. The voice loops visit only the voices
+ * whose bits are set. A group's bits are only changed by the core that renders the group.
+ *
+ * part[g] is the part that group g belongs to; its voices use that part's patch. It's only changed
+ * by core 1 between blocks, after the group's voices have been retired (see synth_layout()).
+*/
+struct synth_voicebank_s
+{
+	int env_pos[SYNTH_N_VOICES];				/* Envelope position; < 0 ==> voice is silent */
+	dv_i32_t gain[SYNTH_N_VOICES];				/* Envelope gain of the latest sample */
+	dv_u32_t phase[SYNTH_N_VOICES];				/* Fraction of a cycle of the wave table */
+	dv_u32_t incr[SYNTH_N_VOICES];				/* Phase increment per sample */
+	const wave_sample_t *table[SYNTH_N_VOICES];	/* Wave table base */
+	dv_u8_t shift[SYNTH_N_VOICES];				/* Phase to position in the wave table */
+	dv_u32_t age[SYNTH_N_VOICES];				/* Samples played since the note started */
+	dv_i32_t fade[SYNTH_N_VOICES];				/* Samples of fast release left; 0 ==> not fading */
+	dv_i32_t fade_gain[SYNTH_N_VOICES];			/* Gain at the start of the fast release */
+	dv_i32_t midi_note[SYNTH_N_VOICES];
+	dv_i32_t amp[SYNTH_N_VOICES];				/* Amplitude modulation; SYNTH_AMP1 ==> none */
+	dv_i32_t amp_step[SYNTH_N_VOICES];			/* Change of amp per sample in this block */
+	dv_i32_t velocity[SYNTH_N_VOICES];			/* Note-on velocity, 0 to SYNTH_MOD1 */
+	dv_i32_t cents[SYNTH_N_VOICES];				/* Pitch modulation in cents */
+	const struct wavetable_s *wave[SYNTH_N_VOICES];	/* Waveform of the note */
+	dv_u8_t lanes[SYNTH_N_GROUPS];				/* Sounding voices of each group */
+	dv_u8_t part[SYNTH_N_GROUPS];				/* Part of each group */
+	dv_u8_t n_osc[SYNTH_N_GROUPS];				/* Oscillators per note; 1 ==> SYNTH_LANES voices */
+};
+
+#define SYNTH_PAN1			128					/* Pan of a unison oscillator: -128 (left) to 128 */
+#define SYNTH_AMP_SHIFT		15
+#define SYNTH_AMP1			(1 << SYNTH_AMP_SHIFT)	/* Unity amplitude modulation */
+#define SYNTH_MOD1			128					/* Full value of a modulation source */
+#define SYNTH_MOD_CENTS		2					/* Pitch: cents per unit of amount */
+#define SYNTH_LFO_SHIFT		29					/* LFO rate: 2^32 / 8 per Hz */
+
+/* A slot of the modulation matrix routes a source to a destination (see synth-config.h).
+ * The amount is -128 to 126. The sources are 0 to SYNTH_MOD1, except the LFOs, which are
+ * -SYNTH_MOD1 to SYNTH_MOD1.
+ *	- pitch: the note is raised by amount * SYNTH_MOD_CENTS cents at full source (lowered if
+ *	  the amount is negative)
+ *	- amplitude: the note is attenuated by amount/128 at zero source and not at all at full source.
+ *	  A negative amount inverts the source. An LFO is treated as 0 at its lowest point and
+ *	  full at its highest.
+ * The slots that have the same destination add up.
+*/
+struct synth_mod_s
 {
-	struct tonegen_s vco;
-	struct envelope_s envelope;
-	dv_u32_t age;
-	dv_i32_t midi_note;
+	int source;
+	int dest;
+	int amount;
 };
 
+/* A part's patch is the sound of its notes: the ADSR profile and the wave table.
+ * All the part's voices use it.
+ *
+ * If unison is more than 1, each note of the part is a group of that many oscillators that share
+ * the note's envelope. The oscillators are spread evenly over detune cents and across the stereo
+ * image by spread (0 ==> all in the centre, SYNTH_PAN1 ==> outer ones hard left and right).
+ *
+ * The modulation matrix and the LFOs' rates are part of the patch too.
+*/
+struct synth_patch_s
+{
+	struct adsr_s adsr;
+	const struct wavetable_s *wave;				/* Band-limited wave tables, one per octave */
+	int unison;									/* Oscillators per note; 1 to SYNTH_LANES */
+	int detune;									/* Cents from the lowest to the highest oscillator */
+	int spread;									/* Pan of the outer oscillators; 0 to SYNTH_PAN1 */
+	int mod_slot;								/* Slot that the SYNTH_CTRL_MOD_xxx controllers set */
+	struct synth_mod_s mod[SYNTH_MOD_SLOTS];
+	dv_u32_t lfo_incr[2];						/* LFO phase increments per sample */
+};
+
+/* The voice allocator belongs to core 1, which allocates a voice for each note-on and finds the
+ * voice for each note-off in constant time.
+ *
+ * Each part has a pool of voices: whole groups, at least SYNTH_FADE_VOICES more than the part's
+ * notes if there are enough voices. The pools are laid out in part order from voice 0 (see
+ * synth_layout()). Each part has its own lists, which only hold the voices of its pool:
+ *	- note_voice[p][] maps each MIDI note to the voice that was last allocated to it
+ *	- the part's free stack is free[first] to free[first+n_free-1], i.e. in its own pool's slots
+ *	- the allocated voices are on a doubly linked list in order of allocation (the steal list).
+ *	  When n_poly notes of a part are playing, a new note steals one of them (see synth_steal_choose()).
+ * A stolen voice fades out (voice.fade) while the new note plays on a free voice. It is reserved
+ * until the fade finishes: it's on neither list, so it can't be stolen or retired again.
+ * used[] holds the allocated and reserved voices of each group in the same form as voice.lanes[].
+ * Once per block (batch) the allocator frees the voices whose envelopes have finished, i.e. those
+ * that are used but no longer sounding. A part's lists are rebuilt when its pool changes.
+ *
+ * The per-voice arrays are too big for the effect arena, so they are a global structure. The
+ * per-part counts and list ends are in the synth's control block (struct synth_part_s).
+*/
+#define SYNTH_N_NOTES		128
+
+struct synth_alloc_s
+{
+	dv_u32_t batch;						/* Counts the blocks (reclaims) */
+	dv_u32_t v_batch[SYNTH_N_VOICES];	/* Batch in which each voice was allocated */
+	dv_i16_t free[SYNTH_N_VOICES];		/* Free voices of each pool */
+	dv_i16_t older[SYNTH_N_VOICES];		/* Steal list links; -1 ==> end of list */
+	dv_i16_t newer[SYNTH_N_VOICES];
+	dv_i16_t note_voice[SYNTH_N_PARTS][SYNTH_N_NOTES];	/* Voice allocated to each MIDI note; -1 ==> none */
+	dv_u8_t reserved[SYNTH_N_VOICES];	/* Voice is fading out after being stolen */
+	dv_u8_t used[SYNTH_N_GROUPS];		/* Allocated and reserved voices of each group */
+};
+
+struct synth_part_s
+{
+	int n_polyphonic;	/* Max. no. of notes; 0 ==> part is off. Set by synth_control() */
+	int n_req;			/* n_polyphonic when the layout was made */
+	int n_poly;			/* No. of notes in the layout; fewer than n_req if the voices ran out */
+	int first;			/* First voice of the part's pool */
+	int n_voices;		/* No. of voices in the pool */
+	int n_osc;			/* Oscillators per note in the layout (patch unison) */
+	int n_free;			/* No. of voices on the free stack */
+	int n_used;			/* No. of voices on the steal list */
+	int oldest;			/* Ends of the steal list; -1 ==> empty */
+	int newest;
+	int pressure;		/* Channel pressure and mod wheel (MIDI values). Set by synth_control() */
+	int wheel;
+	dv_u32_t lfo_phase[2];
+	dv_i32_t src[SYNTH_MOD_N_SOURCES];	/* The part's modulation sources for this block */
+};
+
+/* The load governor (SYNTH_GOVERNOR) times each block of the synth. When the time exceeds
+ * SYNTH_GOV_HIGH % of the block's duration, n_limit is lowered below the number of sounding voices
+ * and the excess voices are shed, quietest releasing voice first. A shed voice fades out with the
+ * fast release of a stolen voice (SYNTH_FADE_LEN). New notes then steal voices
+ * instead of using free ones. After SYNTH_GOV_HOLD blocks below SYNTH_GOV_LOW % the limit is
+ * raised by one, until it reaches n_polyphonic again. The governor covers all the parts.
+*/
 struct effect_synth_s
 {
-	int n_polyphonic;
+	int n_polyphonic;	/* Total no. of notes of all the parts in the layout */
 	int gain;
+	int n_limit;		/* Max. no. of sounding voices; <= n_polyphonic */
+	int gov_calm;		/* Consecutive blocks below SYNTH_GOV_LOW */
+	dv_u32_t n_shed;	/* No. of voices shed by the governor */
+	dv_u32_t n_lowered;	/* No. of blocks that lowered n_limit */
+	dv_u32_t t_block;	/* FRC at the start of the latest block */
+	int n_groups;		/* No. of groups in the layout */
+	int mod_count;		/* Samples until the next modulation update (per-sample path) */
+	struct synth_part_s part[SYNTH_N_PARTS];
 };
 
-extern struct effect_synth_mono_s notegen[MAX_POLYPHONIC];
+/* A voice worker renders the voices that are owned by its core into a partial mix.
+ *
+ * The voices are owned a group at a time: group g is owned by worker (g % SYNTH_VOICE_WORKERS),
+ * which runs on core (2 + worker).
+ * While a worker renders a block, only the worker touches its voices, so note events are passed
+ * to the owner. Core 1 may change a worker's voices only between the worker's blocks, when "done"
+ * has caught up with "go": after posting the events, effect_synth_frame() calls synth_modulate(),
+ * which retunes the sounding voices (synth_voice_tune()) before the next "go". The stage posts the
+ * events and the block length, advances "go" and waits for "done" to catch up. Then it sums the
+ * partial mixes. The events, mix and voices are only touched by one side at a time, so there's
+ * no locking.
+ *
+ * Each event carries the sample offset in the block at which it takes effect. The events are
+ * posted in order of offset.
+*/
+#define SYNTH_MAX_NOTES		NQ_LEN			/* Note messages taken per block, from all the parts */
+#define SYNTH_MAX_EVENTS	(SYNTH_N_VOICES+2*SYNTH_MAX_NOTES+1)	/* Retirements + notes + fades */
+#define SYNTH_EV_VOICE		24				/* Shift for the voice index in an event */
+#define SYNTH_EV_OFFSET		18				/* Shift for the sample offset in an event */
+#define SYNTH_EV_OFFSET_MASK	0x3f
+#define SYNTH_EV_RETIRE		0x20000			/* Silence the voice now */
+#define SYNTH_EV_FADE		0x08000			/* The voice has been stolen: fade it out */
+
+#if EFFECT_BLOCK_LEN > (SYNTH_EV_OFFSET_MASK+1)
+#error "EFFECT_BLOCK_LEN is too big for the offset in a voice worker's event"
+#endif
+
+#define synth_voice_owner(v)	(((v) / SYNTH_LANES) % SYNTH_VOICE_WORKERS)
+
+struct synth_worker_s
+{
+	volatile dv_u32_t go;					/* Block counter; written by core 1 */
+	dv_u32_t pad1[15];
+	volatile dv_u32_t done;					/* Block counter; written by the worker */
+	dv_u32_t pad2[15];
+	int n;									/* Samples in this block */
+	int n_events;							/* Note events for this block */
+	dv_u32_t event[SYNTH_MAX_EVENTS];		/* voice, offset and note message, fade or retirement */
+	dv_i64_t mix[EFFECT_BLOCK_LEN];			/* Partial mix of this worker's voices */
+	dv_i64_t uni[2][EFFECT_BLOCK_LEN];		/* Partial stereo mix of this worker's unison notes */
+};
+
+extern struct synth_voicebank_s voice;
+extern struct synth_patch_s synth_patch[SYNTH_N_PARTS];
+extern struct synth_alloc_s synth_alloc;
 extern struct effect_synth_s synth;
+#if SYNTH_VOICE_WORKERS > 0
+extern struct synth_worker_s synth_worker[SYNTH_VOICE_WORKERS];
+#endif
+
+/* synth_voice_on() - mark a voice as sounding
+*/
+static inline void synth_voice_on(int v)
+{
+	voice.lanes[v / SYNTH_LANES] |= (dv_u8_t)(1u << (v % SYNTH_LANES));
+}
+
+/* synth_voice_off() - silence a voice now
+*/
+static inline void synth_voice_off(int v)
+{
+	voice.env_pos[v] = -1;
+	voice.lanes[v / SYNTH_LANES] &= (dv_u8_t)~(1u << (v % SYNTH_LANES));
+}
+
+/* synth_voice_envelope() - step the envelope of a voice and return the gain for this sample
+ *
+ * A voice that has been stolen ignores its envelope and fades out instead.
+ * The voice is silenced when its envelope or fade finishes.
+*/
+static inline dv_i32_t synth_voice_envelope(int v)
+{
+	dv_i32_t gain;
+
+	/* Do I care about overflow here? It happens after about 15 minutes.
+	*/
+	voice.age[v]++;
+
+	if ( voice.fade[v] > 0 )
+	{
+		voice.fade[v]--;
+		gain = (voice.fade_gain[v] * voice.fade[v]) >> SYNTH_FADE_SHIFT;
+
+		if ( voice.fade[v] == 0 )
+			voice.env_pos[v] = -1;
+	}
+	else
+		gain = adsr_gen(&synth_patch[voice.part[v / SYNTH_LANES]].adsr, &voice.env_pos[v]);
+
+	voice.gain[v] = gain;
+
+	if ( voice.env_pos[v] < 0 )
+		synth_voice_off(v);						/* End of the release phase */
+
+	return gain;
+}
+
+/* synth_voice_amp() - apply a voice's amplitude modulation to a gain
+ *
+ * The modulation ramps by one step for each sample.
+*/
+static inline dv_i32_t synth_voice_amp(int v, dv_i32_t gain)
+{
+	voice.amp[v] += voice.amp_step[v];
+
+	return (gain * voice.amp[v]) >> SYNTH_AMP_SHIFT;
+}
+
+/* synth_unison_pan() - return the pan of oscillator k of a unison note (-spread to +spread)
+*/
+static inline dv_i32_t synth_unison_pan(int k, int n_osc, int spread)
+{
+	return (spread * (2 * k - (n_osc - 1))) / (n_osc - 1);
+}
 
 extern dv_i64_t effect_synth(struct effect_s *e, dv_i64_t signal);
+extern void effect_synth_frame(struct effect_s *e, struct effect_block_s *b, int n);
 extern void effect_synth_init(struct effect_s *e);
-extern dv_i64_t synth_play_note(struct effect_synth_mono_s *notegen);
-extern void synth_control(dv_i32_t controller, dv_i32_t value);
+extern dv_i64_t synth_play_voice(int v);
+extern dv_i64_t synth_play_unison(int v, dv_i64_t *right);
+extern void synth_render_group(int g, dv_u32_t lanes, dv_i64_t *mix, int n);
+extern void synth_render_group_ref(int g, dv_u32_t lanes, dv_i64_t *mix, int n);
+extern void synth_render_unison(int g, dv_i64_t *left, dv_i64_t *right, int n);
+extern void synth_render_unison_ref(int g, dv_i64_t *left, dv_i64_t *right, int n);
+extern void synth_control(int part, dv_i32_t controller, dv_i32_t value);
+extern void synth_worker_block(int w);
+extern void synth_voice_worker(int w);
+extern void synth_print_governor(void);
 
 #endif
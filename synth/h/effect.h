@@ -22,6 +22,7 @@
 
 #include <dv-config.h>
 #include <davroska.h>
+#include <synth-config.h>
 
 /* The effects generator consists of a sequence of 2 or more single digital
  * transformations of an input signal.
@@ -37,27 +38,96 @@
  * 
  * In the case of generation, it's possible that the process is recursive.
  *
+ * A stage can also provide a block function that transforms a buffer of samples in place.
+ * The effect processor passes a block of EFFECT_BLOCK_LEN samples through the chain, so a stage
+ * with a block function is called once per block instead of once per sample. Stages that only
+ * have a per-sample function are called once per sample by an adapter in the block chain.
+ *
+ * A block carries EFFECT_N_CHANNELS channels of samples (channel 0 is left, 1 is right).
+ * Mono stages (func and blockfunc) work on one channel; the chain runs them over each channel
+ * in turn. effect_compile() gives each channel its own copy of a mono stage's control block
+ * (if it has a non-zero control_size), so a mono stage can keep state between samples (a filter,
+ * a delay line) without the channels mixing. A multi-channel (stereo) stage declares itself by
+ * providing a frame function, which transforms all the channels of the block at once. Its
+ * per-sample function is only used by effect_chain(), which is mono.
+ *
  * The whole is managed using an effect_s structure that contains the head of the
  * list of transformations and some global configuration.
+ *
+ * The list is the editing representation. Before processing, effect_compile() copies the list
+ * into a contiguous array of stage descriptors and moves the stages' control blocks (those with
+ * a non-zero control_size) into a single arena, so that the processor walks an indexed array
+ * with all its control data in a few adjacent cache lines. The list must be recompiled after
+ * it has been changed.
+ *
+ * The list can be split between cores by pipe stages (see effect-pipe.h). The compiled array
+ * then holds one contiguous segment per core, each of which is run by effect_processor() on
+ * its own core.
+ *
+ * There are two compiled chains. The processors use the published one, while effect_compile()
+ * builds the other and then publishes it by swapping the pointer. Each processing core picks up
+ * the new chain at the start of its next block and acknowledges it; the old chain is only reused
+ * once no core is still using it. The list can therefore be edited and recompiled at any time
+ * (from one control core) without disturbing the audio.
 */
-struct effect_s;	/* Forward */
+struct effect_block_s
+{
+	dv_i64_t s[EFFECT_N_CHANNELS][EFFECT_BLOCK_LEN];
+};
+
+struct effect_s;			/* Forward */
+struct monitor_stage_s;		/* Forward */
 typedef dv_i64_t (*effectstage_t)(struct effect_s *, dv_i64_t);
+typedef void (*effectblock_t)(struct effect_s *, dv_i64_t *, int);
+typedef void (*effectframe_t)(struct effect_s *, struct effect_block_s *, int);
 
 struct effect_s
 {
 	struct effect_s *next;
 	struct effect_s *prev;
 	effectstage_t func;
+	effectblock_t blockfunc;		/* DV_NULL ==> use func for each sample */
+	effectframe_t framefunc;		/* DV_NULL ==> mono stage */
 	void *control;
+	dv_u32_t control_size;			/* sizeof(*control); 0 ==> leave control where it is */
+	dv_u32_t control_stride;		/* Bytes between channels' copies of control; 0 ==> shared */
+	dv_i32_t core;					/* Core that runs the stage; set by effect_compile() */
+	dv_u32_t published;				/* Chain (effect_generation) that the stage was last published in */
 	char *name;
+#if EFFECT_PROFILE
+	struct monitor_stage_s *profile;	/* Timing statistics; set by effect_compile() */
+#endif
 };
 
 extern struct effect_s effect_list;
+/* A segment of the compiled chain: the stages that run on one core.
+*/
+struct effect_segment_s
+{
+	int first;
+	int n;
+};
+
+/* A compiled chain. Each pipe becomes two descriptors, so there can be one more descriptor
+ * per core than there are stages.
+*/
+struct effect_chain_s
+{
+	struct effect_segment_s segment[EFFECT_N_CORES];
+	struct effect_s stage[N_EFFECT_STAGES+EFFECT_N_CORES];
+};
+
+extern struct effect_chain_s * volatile effect_published;
 extern volatile dv_boolean_t effect_sync;
 
 extern void effect_init(void);
 extern dv_i64_t effect_chain(struct effect_s *e, dv_i64_t signal);
-extern void effect_processor(void);
+extern void effect_chain_block(struct effect_s *e, struct effect_block_s *b, int n);
+extern void effect_process_block(int core, struct effect_block_s *b, int n);
+extern void effect_processor(int core);
 extern void effect_append(struct effect_s *e);
+extern void effect_insert(struct effect_s *e, struct effect_s *after);
+extern void effect_remove(struct effect_s *e);
+extern int effect_compile(void);
 
 #endif
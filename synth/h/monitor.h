@@ -21,6 +21,7 @@
 #define MONITOR_H	1
 
 #include <dv-config.h>
+#include <synth-config.h>
 #include <synth-stdio.h>
 #include <dv-arm-bcm2835-armtimer.h>
 
@@ -73,6 +74,177 @@ static inline void print_elapsed(struct monitor_elapsed_s *e, char *s)
 	(void)sy_printf("%s: min = %u, max = %u\n", s, e->min, e->max);
 }
 
+#if EFFECT_PROFILE
+/* Per-stage timing statistics for the effect chain.
+ *
+ * There's one entry per stage name per core. Each entry records the time taken by the stage
+ * to process a block: min, max, total (for the mean) and a histogram with a bucket for each power
+ * of two: bucket b counts times t where 2^b <= t < 2^(b+1).
+ *
+ * With EFFECT_PROFILE == 2 the times are in CPU cycles from the PMU cycle counter, otherwise
+ * in FRC ticks. With EFFECT_PROFILE == 3 the "times" are the no. of L2 data cache refills
+ * (PMU event counter 0), which shows how much of a stage's working set misses the cache.
+*/
+#define MONITOR_PMU_L2D_REFILL	0x17	/* PMU event: L2D_CACHE_REFILL */
+
+#define MONITOR_N_STAGES	(N_EFFECT_STAGES+EFFECT_N_CORES)
+#define MONITOR_HIST_N		24
+
+struct monitor_stage_s
+{
+	char *name;
+	dv_i32_t core;
+	dv_u32_t n;			/* No. of blocks measured */
+	dv_u32_t min;
+	dv_u32_t max;
+	dv_u64_t total;
+	dv_u32_t hist[MONITOR_HIST_N];
+};
+
+extern struct monitor_stage_s *monitor_stage_find(char *name, dv_i32_t core);
+extern void monitor_stage_enable(void);
+extern void monitor_stage_print(void);
+
+/* monitor_stage_clock() - return the time base for stage timing
+*/
+static inline dv_u32_t monitor_stage_clock(void)
+{
+#if EFFECT_PROFILE == 2 && defined(__aarch64__)
+	dv_u64_t ccnt;
+	__asm volatile ("mrs %0, pmccntr_el0" : "=r"(ccnt));
+	return (dv_u32_t)ccnt;
+#elif EFFECT_PROFILE == 3 && defined(__aarch64__)
+	dv_u64_t cnt;
+	__asm volatile ("mrs %0, pmevcntr0_el0" : "=r"(cnt));
+	return (dv_u32_t)cnt;
+#else
+	return monitor_frc();
+#endif
+}
+
+/* monitor_stage_record() - record the time taken by a stage
+*/
+static inline void monitor_stage_record(struct monitor_stage_s *ms, dv_u32_t t)
+{
+	int b = (t == 0) ? 0 : (31 - __builtin_clz(t));
+
+	if ( b >= MONITOR_HIST_N )
+		b = MONITOR_HIST_N - 1;
+
+	if ( ms->n == 0 )
+	{
+		ms->min = t;
+		ms->max = t;
+		ms->total = 0;
+		for ( int i = 0; i < MONITOR_HIST_N; i++ )
+			ms->hist[i] = 0;
+	}
+	else
+	{
+		if ( ms->min > t )	ms->min = t;
+		if ( ms->max < t )	ms->max = t;
+	}
+	ms->n++;
+	ms->total += t;
+	ms->hist[b]++;
+}
+#endif
+
+/* Audio deadline (xrun) monitoring.
+ *
+ * The output stage calls monitor_xrun_check() for every block, with the time at which the block
+ * was ready for output and the time at which the output was complete.
+ *
+ * A block misses its deadline if the processing time since the previous block's output is longer
+ * than the block's duration.
+ *
+ * The PCM transmit FIFO's fill level (in FRC ticks of audio) is estimated: it drains in real time
+ * while the block is being processed and fills by the block's duration when the block is written.
+ * An xrun (FIFO underrun) is counted when:
+ *	- the estimated level drops below zero before the block is ready, or
+ *	- the writes take longer than the FIFO's contents at the start of the writes could cover.
+ * A write only waits for space, so the writes of a block take no longer than the level at the start
+ * unless the writer was held up (e.g. by an interrupt) for long enough to let the FIFO run dry.
+ * If the writes waited without an underrun, the FIFO is full at the end.
+*/
+#define MONITOR_FRC_HZ				250000000
+#define MONITOR_TICKS_PER_SAMPLE	(MONITOR_FRC_HZ/SAMPLES_PER_SEC)
+#define MONITOR_FIFO_FRAMES			32		/* PCM FIFO: 64 words = 32 stereo frames */
+#define MONITOR_FIFO_TICKS			(MONITOR_FIFO_FRAMES*MONITOR_TICKS_PER_SAMPLE)
+#define MONITOR_FIFO_WAIT_MIN		(MONITOR_TICKS_PER_SAMPLE/4)
+
+struct monitor_xrun_s
+{
+	dv_u32_t init;		/* Has been initialised */
+	dv_u32_t last;		/* Time at end of previous block's output */
+	dv_i32_t fill;		/* Estimated FIFO fill level at "last" */
+	dv_u32_t missed;	/* No. of blocks that missed their deadline */
+	dv_u32_t xruns;		/* No. of FIFO underruns */
+	dv_u32_t worst;		/* Longest overrun */
+	dv_u32_t t_overrun;	/* Time of the last overrun */
+};
+
+/* monitor_xrun_check() - check a block of n samples for a missed deadline and a FIFO underrun
+*/
+static inline void monitor_xrun_check(struct monitor_xrun_s *x, dv_u32_t t_ready, dv_u32_t now, int n)
+{
+	dv_u32_t budget = n * MONITOR_TICKS_PER_SAMPLE;
+	dv_u32_t busy = t_ready - x->last;
+	dv_u32_t wait = now - t_ready;
+
+	x->last = now;
+
+	if ( !x->init )
+	{
+		x->init = 1;
+		x->fill = MONITOR_FIFO_TICKS;
+		return;
+	}
+
+	if ( busy > budget )
+	{
+		x->missed++;
+		x->t_overrun = now;
+		if ( x->worst < (busy - budget) )
+			x->worst = busy - budget;
+	}
+
+	if ( busy > MONITOR_FIFO_TICKS )
+		busy = MONITOR_FIFO_TICKS + 1;		/* Avoid overflow of fill */
+
+	x->fill -= (dv_i32_t)busy;
+	if ( x->fill < 0 )
+	{
+		x->xruns++;							/* FIFO has run dry and restarted */
+		x->fill = 0;
+	}
+
+	if ( wait > (dv_u32_t)x->fill + MONITOR_FIFO_WAIT_MIN )
+	{
+		x->xruns++;							/* FIFO ran dry during the writes */
+		x->t_overrun = now;
+		x->fill = (budget < MONITOR_FIFO_TICKS) ? (dv_i32_t)budget : MONITOR_FIFO_TICKS;
+	}
+	else if ( wait >= MONITOR_FIFO_WAIT_MIN )
+	{
+		x->fill = MONITOR_FIFO_TICKS;		/* Writes had to wait: FIFO is full */
+	}
+	else
+	{
+		x->fill += (dv_i32_t)budget - (dv_i32_t)wait;
+		if ( x->fill > MONITOR_FIFO_TICKS )
+			x->fill = MONITOR_FIFO_TICKS;
+	}
+}
+
+static inline void print_xrun(struct monitor_xrun_s *x, char *s)
+{
+	(void)sy_printf("%s: missed = %u, xruns = %u, worst = %u, last at %u\n",
+					s, x->missed, x->xruns, x->worst, x->t_overrun);
+}
+
+extern struct monitor_xrun_s dac_xrun;
+
 extern struct monitor_elapsed_s core1_loop;
 extern struct monitor_elapsed_s core1_idle;
 
@@ -82,4 +254,16 @@ extern struct monitor_elapsed_s core2_idle;
 extern struct monitor_elapsed_s core3_loop;
 extern struct monitor_elapsed_s core3_idle;
 
+/* monitor_loop(), monitor_idle() - return a core's loop and idle time monitors
+*/
+static inline struct monitor_elapsed_s *monitor_loop(int core)
+{
+	return (core == 3) ? &core3_loop : (core == 2) ? &core2_loop : &core1_loop;
+}
+
+static inline struct monitor_elapsed_s *monitor_idle(int core)
+{
+	return (core == 3) ? &core3_idle : (core == 2) ? &core2_idle : &core1_idle;
+}
+
 #endif
@@ -23,23 +23,67 @@
 #include <dv-config.h>
 #include <davroska.h>
 #include <dv-ringbuf.h>
+#include <monitor.h>
 
-/* There's one queue for every synth channel that's supported (currently just one).
+/* There's one queue for every synth channel that's supported: one per MIDI channel.
  *
  * The channel index is not necessarily the midi channel number.
  *
- * Each synthesiser reads the note messages from its own channel.
+ * Each part of the synthesiser reads the note messages from its own channel: part p reads queue p.
 */
 #define NQ_LEN	32
 
-#define NQ_SYNTH	0
-#define	N_NQ		1
+#define	N_NQ		16
 
-/* Each note message is 32 bits. These macros differentiate between start and stop.
+/* Each note message is 32 bits:
+ *	bits 0-6	MIDI note
+ *	bits 8-14	velocity
+ *	bit 16		start/stop
+ *	bits 17-31	time stamp: bits 10-24 of the FRC (monitor_frc()) when the message was sent
+ *
+ * The time stamp lets the synth start the note at the right sample in a block. Its resolution is
+ * 1024 ticks (about 1/5 of a sample) and it spans 2^25 ticks (134 ms), so a message can be placed
+ * correctly until it's 67 ms old. An older message looks as if it was sent in the future; see
+ * note_pending().
 */
 #define NOTE_START	0x10000
 #define NOTE_STOP	0x00000
 
+#define NOTE_STAMP_SHIFT		17
+#define NOTE_STAMP_FRC_SHIFT	10
+#define NOTE_STAMP_MASK			0xfffe0000
+
+/* note_stamp() - return the time stamp bits of a note message for an FRC value
+*/
+static inline dv_u32_t note_stamp(dv_u32_t frc)
+{
+	return (frc >> NOTE_STAMP_FRC_SHIFT) << NOTE_STAMP_SHIFT;
+}
+
+/* note_ticks() - return the time from "base" to a note message's time stamp, in FRC ticks
+ *
+ * Negative if the message was sent before base.
+*/
+static inline dv_i32_t note_ticks(dv_u32_t note, dv_u32_t base)
+{
+	dv_i32_t d = (dv_i32_t)((note & NOTE_STAMP_MASK) - note_stamp(base));
+
+	return (d >> NOTE_STAMP_SHIFT) * (1 << NOTE_STAMP_FRC_SHIFT);
+}
+
+/* note_pending() - return true if a note message was sent at or after "base"
+ *
+ * The reader can only be a little way ahead of base: no more than "window" ticks. A message that
+ * appears to be further ahead than that is a message that's more than 67 ms old, whose time stamp
+ * has wrapped. It isn't pending; the caller treats it as late.
+*/
+static inline dv_boolean_t note_pending(dv_u32_t note, dv_u32_t base, dv_i32_t window)
+{
+	dv_i32_t t = note_ticks(note, base);
+
+	return (t >= 0) && (t <= window);
+}
+
 struct notequeue_s
 {
 	dv_u32_t channel;
@@ -56,10 +100,12 @@ extern struct notechannels_s notechannels;
 
 extern void notechannels_init(void);
 
-/* Push a note message into a queue.
+/* Push a note message into a queue, with the time stamp for the given FRC value.
 */
-static inline void send_note(dv_u32_t ch, dv_u32_t note)
+static inline void send_note_at(dv_u32_t ch, dv_u32_t note, dv_u32_t frc)
 {
+	note = (note & ~NOTE_STAMP_MASK) | note_stamp(frc);
+
 	/* First find the note queue that's handling the note's MIDI channel.
 	*/
 	for ( int i = 0; i < N_NQ; i++ )
@@ -84,4 +130,11 @@ static inline void send_note(dv_u32_t ch, dv_u32_t note)
 	}
 }
 
+/* Push a note message into a queue, time stamped now.
+*/
+static inline void send_note(dv_u32_t ch, dv_u32_t note)
+{
+	send_note_at(ch, note, monitor_frc());
+}
+
 #endif
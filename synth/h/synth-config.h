@@ -22,15 +22,86 @@
 
 /* Configuration settings:
  *	SAMPLES_PER_SEC must match the hardware sample rate
+ *	SYNTH_VOICE_WORKERS is the number of cores (2, 3) that render synth voices for core 1 (0 ==> none)
  *	MAX_POLYPHONIC is the number of simultaneous synthesized notes available
+ *	SYNTH_N_PARTS is the number of parts (timbres), each played from its own MIDI channel
+ *	SYNTH_N_POLY is the number of notes of part 0 at startup; the other parts start with none
+ *		(synth_control() can change them; all the parts share the MAX_POLYPHONIC voices)
+ *	SYNTH_SIMD selects the SIMD voice kernel (NEON on the Pi, SSE2 on a host); 0 ==> scalar reference.
+ *	SYNTH_GOVERNOR enables voice shedding when the synth takes too much of the block's time.
+ *	SYNTH_FADE_LEN is the length of the fast release of a stolen voice.
+ *	SYNTH_FADE_VOICES is the number of extra voices that play the fast releases.
+ *	SYNTH_STEAL_SCAN is the number of a part's oldest notes that are considered for stealing.
+ *	WAVE_SAMPLE_BITS is the size of a wave table sample: 16 (interpolated) or 32.
  *	MAX_EFFECT_STAGES is the number of "effects" available. Includes ADC and DAC.
+ *	EFFECT_BLOCK_LEN is the number of samples that each stage processes per pass of the chain.
+ *	EFFECT_N_CHANNELS is the number of audio channels carried through the chain (2 = stereo).
+ *	EFFECT_ARENA_SIZE is the space (bytes) for the control blocks of the compiled effect chain.
+ *	EFFECT_PROFILE enables per-stage timing of the effect chain (1 = FRC, 2 = PMU cycle counter,
+ *		3 = PMU L2 cache refill counter instead of a time).
+ *	EFFECT_PIPELINE selects a chain that is split across cores 1 to 3 by pipes.
+ *	EFFECT_PIPE_LEN is the capacity of an inter-core pipe (blocks).
+ *	EFFECT_PIPE_LATENCY is the number of blocks of latency that each pipe adds.
  *	ADSR_xMAX are the values considered to be full range.
 */
 
 #define SAMPLES_PER_SEC		48000	/* Fixed by the ADC/DAC clock */
-#define MAX_POLYPHONIC		16		/* No. of note generators available */
+#ifndef SYNTH_VOICE_WORKERS
+#define SYNTH_VOICE_WORKERS	0		/* 0 ==> core 1 renders all voices; 1 or 2 ==> cores 2 (and 3) */
+#endif
+#ifndef MAX_POLYPHONIC
+#define MAX_POLYPHONIC		128		/* Max. 252 (8-bit voice index); see voice-bench for the cost */
+#endif
+#define SYNTH_N_PARTS		16		/* Part p plays MIDI channel p */
+#define SYNTH_N_POLY		32		/* The governor sheds voices if a core can't keep up */
+
+#ifndef SYNTH_SIMD
+#define SYNTH_SIMD			1		/* 0 ==> render voices one at a time */
+#endif
+
+#ifndef SYNTH_GOVERNOR
+#define SYNTH_GOVERNOR		1		/* 0 ==> synth runs late when overloaded */
+#endif
+#define SYNTH_GOV_HIGH		75		/* Shed voices above this % of the block's time */
+#define SYNTH_GOV_LOW		50		/* Restore voices below this % of the block's time */
+#define SYNTH_GOV_HOLD		100		/* Blocks below SYNTH_GOV_LOW before each voice is restored */
+#define SYNTH_GOV_MIN		4		/* Never shed below this no. of voices */
+
+#define SYNTH_FADE_SHIFT	7		/* Fast release of a stolen voice: 2^7 samples (2.7 ms) */
+#define SYNTH_FADE_LEN		(1 << SYNTH_FADE_SHIFT)
+#define SYNTH_FADE_VOICES	4		/* Extra voices for the fast releases */
+#define SYNTH_STEAL_SCAN	8		/* Oldest notes ranked when stealing; 1 ==> always the oldest */
+
+#ifndef WAVE_SAMPLE_BITS
+#define WAVE_SAMPLE_BITS	16		/* 32 ==> full-size samples, read without interpolation */
+#endif
+
 #define N_EFFECT_STAGES		20		/* Total no. of effects */
 
+#ifndef EFFECT_BLOCK_LEN
+#define EFFECT_BLOCK_LEN	32		/* Samples per block (e.g. 16, 32, 64) */
+#endif
+#define EFFECT_N_CHANNELS	2		/* Left, right */
+#define EFFECT_ARENA_SIZE	4096	/* Bytes */
+
+#ifndef EFFECT_PROFILE
+#define EFFECT_PROFILE		0		/* 0 ==> no per-stage timing */
+#endif
+
+#define EFFECT_N_CORES		4		/* Cores 1 to 3 can process effects */
+#define EFFECT_FIRST_CORE	1		/* The core that runs the start of the chain */
+#define EFFECT_PIPE_FIRST_CORE	(EFFECT_FIRST_CORE + 1 + SYNTH_VOICE_WORKERS)	/* Lowest core a pipe can feed */
+
+#ifndef EFFECT_PIPELINE
+#define EFFECT_PIPELINE		0		/* 0 ==> whole chain on core 1 */
+#endif
+#define EFFECT_PIPE_LEN		4		/* Blocks */
+#define EFFECT_PIPE_LATENCY	1		/* Blocks; must be less than EFFECT_PIPE_LEN */
+
+#if EFFECT_PIPELINE && (SYNTH_VOICE_WORKERS > 0)
+#error "EFFECT_PIPELINE and SYNTH_VOICE_WORKERS both need cores 2 and 3"
+#endif
+
 #define ADSR_GMAX			128		/* Max output level. This value represents 1.0 */
 #define ADSR_AMAX			128		/* a = 128 -> 1 sec */
 #define ADSR_DMAX			128		/* d = 128 -> 1 sec */
@@ -44,8 +115,36 @@
 #define SYNTH_CTRL_ENVELOPE_D	1	/* Note decay time */
 #define SYNTH_CTRL_ENVELOPE_S	2	/* Note sustain level */
 #define SYNTH_CTRL_ENVELOPE_R	3	/* Note release time */
+#define SYNTH_CTRL_PART_NOTES	20	/* No. of notes of the part (0 ==> part off) */
+#define SYNTH_CTRL_UNISON		21	/* Oscillators per note (1 to 4; 0 ==> 1) */
+#define SYNTH_CTRL_DETUNE		22	/* Cents between the outer unison oscillators (0 to 100) */
+#define SYNTH_CTRL_SPREAD		23	/* Stereo spread of the unison oscillators (0 to 128) */
+#define SYNTH_CTRL_MOD_WHEEL	24	/* Modulation wheel (CC 1 is the decay time) */
+#define SYNTH_CTRL_LFO1_RATE	25	/* LFO 1 frequency in 1/8 Hz */
+#define SYNTH_CTRL_LFO2_RATE	26	/* LFO 2 frequency in 1/8 Hz */
+#define SYNTH_CTRL_MOD_SLOT		27	/* Slot of the modulation matrix that the next three set */
+#define SYNTH_CTRL_MOD_SOURCE	28	/* Source of the slot (SYNTH_MOD_xxx) */
+#define SYNTH_CTRL_MOD_DEST		29	/* Destination of the slot (SYNTH_DEST_xxx) */
+#define SYNTH_CTRL_MOD_AMOUNT	30	/* Amount of the slot (64 ==> 0) */
+#define SYNTH_CTRL_WAVEFORM		31	/* Waveform of new notes: 0 saw, 1 triangle, 2 square, 3 sine */
+
+#define SYNTH_CTRL_N_POLY		128	/* No. of polyphonic channels of the part (up to MAX_POLYPHONIC) */
+#define SYNTH_CTRL_PRESSURE		129	/* Channel pressure (MIDI command 0xd-) */
+
+/* Sources and destinations of the modulation matrix
+*/
+#define SYNTH_MOD_NONE			0
+#define SYNTH_MOD_VELOCITY		1	/* Note-on velocity */
+#define SYNTH_MOD_PRESSURE		2	/* Channel pressure */
+#define SYNTH_MOD_WHEEL			3	/* Modulation wheel */
+#define SYNTH_MOD_LFO1			4	/* Triangle LFOs (bipolar) */
+#define SYNTH_MOD_LFO2			5
+#define SYNTH_MOD_ENVELOPE		6	/* The note's ADSR envelope */
+#define SYNTH_MOD_N_SOURCES		7
 
-#define SYNTH_CTRL_N_POLY		128	/* No. of polyphonic channels */
+#define SYNTH_DEST_PITCH		0	/* 2 cents per unit of amount at full source */
+#define SYNTH_DEST_AMP			1	/* Attenuation by amount/128 at zero source */
+#define SYNTH_MOD_SLOTS			4	/* Slots per patch */
 
 /* Configuration of davroska-related features
 */
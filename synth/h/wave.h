@@ -22,43 +22,124 @@
 
 #include <dv-config.h>
 #include <davroska.h>
+#include <synth-config.h>
 
 #define SAW	1
 #define TRI	2
 #define SQU	3
 #define SIN 4
 
+#define WAVE_N_TYPES	4		/* SAW to SIN */
+
 #define N_NOTEGEN	1
 
-/* A wave table contains an integer multiple of whole waveforms of the note.
- * There will always be a small error because the sample rate is not a whole-number
- * multiple of the fundamental frequency. The number of cycles is chosen to keep the error
- * small enough.
- * The actual value of the wave is held in a wave buffer; the wave member is the base address.
+/* A waveform is held as a set of band-limited wave tables, one per octave of the phase increment
+ * (a level). Each table is a single cycle whose length is a power of two, so the position in the
+ * table is simply the top bits of the phase. The table of a level contains only the harmonics
+ * that are below the Nyquist frequency at the highest pitch of the level, so the tone doesn't
+ * alias. The higher levels have fewer harmonics and so their tables are shorter, down to
+ * WAVE_MIN_LEN samples.
+ *
+ * Level 0 is for increments below 2^WAVE_LEVEL0_BITS (about 23 Hz) and each level above it
+ * is an octave higher. The top level is for increments of 2^31 (the Nyquist frequency) and above.
+ *
+ * The tables of all the waveforms and the phase increments of the midi notes are const data
+ * that is generated at build time by the wave-gen host program (host/c/wave-gen.c). They're all
+ * resident, so each note can use any waveform. The sine has no harmonics to remove, so all its
+ * levels share one table of WAVE_LEN samples.
+ *
+ * Each table has a guard sample after its cycle, a copy of its first sample, so that a read of
+ * the sample after the position never needs to wrap round.
+ *
+ * With WAVE_SAMPLE_BITS == 16 the samples are the top 16 bits of the waveform, which halves the
+ * footprint of the tables in the cache. The tone is interpolated linearly between the two samples
+ * on either side of the phase, using the next WAVE_INTERP_BITS bits of the phase, and that
+ * restores a 32-bit amplitude. With WAVE_SAMPLE_BITS == 32 the sample at the position is used.
 */
+#define WAVE_BITS			11
+#define WAVE_LEN			(1 << WAVE_BITS)
+#define WAVE_MIN_BITS		8
+#define WAVE_MIN_LEN		(1 << WAVE_MIN_BITS)
+#define WAVE_N_LEVELS		12
+#define WAVE_LEVEL0_BITS	21
+#define WAVE_TOTAL_SAMPLES	(2 * WAVE_LEN + WAVE_LEN / 2 + WAVE_LEN / 4 + 8 * WAVE_MIN_LEN + WAVE_N_LEVELS)
+#define WAVE_INTERP_BITS	14
+
+#if WAVE_SAMPLE_BITS == 16
+typedef dv_i16_t wave_sample_t;
+#elif WAVE_SAMPLE_BITS == 32
+typedef dv_i32_t wave_sample_t;
+#else
+#error "WAVE_SAMPLE_BITS must be 16 or 32"
+#endif
+
+#define WAVE_N_NOTES		128
+
 struct wavetable_s
 {
-	double f;
-	dv_i32_t nsamp;
-	dv_i32_t ncyc;
-	dv_i32_t *wave;
+	const wave_sample_t *level[WAVE_N_LEVELS];	/* Single cycle of the wave at each level */
+	dv_u8_t shift[WAVE_N_LEVELS];				/* Phase to position: 32 - log2(length) */
 };
 
-/* A tone generator is used to generate a constant tone of of a given frequency, based on a root
- * wave table. The harmonic is used to increment the position (modulo nsamp of the wave) on each
- * sample. Thus a tone generator can output any harmonic of the give root wave.
+/* A tone generator is used to generate a constant tone of a given frequency from a wave table.
+ * The phase is a 32-bit fraction of a cycle: it wraps round by itself at the end of each cycle,
+ * and its top bits are the position in the wave table. The increment is the frequency
+ * as a fraction of the sample rate (f * 2^32 / SAMPLES_PER_SEC), so a tone can have any pitch
+ * and each sample costs one add and one shift.
 */
 struct tonegen_s
 {
-	struct wavetable_s *root;
-	dv_i32_t harmonic;
-	dv_i32_t position;
+	const wave_sample_t *wave;
+	dv_u32_t shift;
+	dv_u32_t phase;
+	dv_u32_t incr;
 };
 
-extern int wave_init(void);
-extern void wave_generate(int wav);
+extern const struct wavetable_s wavetables[WAVE_N_TYPES];
+extern const dv_u32_t wave_incr[WAVE_N_NOTES];
+
+/* wave_table() - return the wave table of a waveform (SAW to SIN)
+*/
+static inline const struct wavetable_s *wave_table(int wav)
+{
+	return &wavetables[wav - SAW];
+}
+
+/* wave_level() - return the level of the wave tables for a phase increment
+*/
+static inline int wave_level(dv_u32_t incr)
+{
+	int l = 0;
+
+	incr >>= WAVE_LEVEL0_BITS;
+	while ( incr != 0 && l < WAVE_N_LEVELS - 1 )
+	{
+		incr >>= 1;
+		l++;
+	}
+	return l;
+}
+
+/* wave_sample() - return the amplitude of a wave table at a phase
+ *
+ * The interpolated amplitude always lies between the two samples, but the step between them can be
+ * more than the range of a dv_i32_t, so the sum is done in unsigned arithmetic.
+*/
+static inline dv_i32_t wave_sample(const wave_sample_t *wave, dv_u32_t shift, dv_u32_t phase)
+{
+#if WAVE_SAMPLE_BITS == 16
+	dv_u32_t i = phase >> shift;
+	dv_i32_t f = (dv_i32_t)((phase >> (shift - WAVE_INTERP_BITS)) & ((1u << WAVE_INTERP_BITS) - 1));
+	dv_i32_t s0 = wave[i];
+	dv_i32_t d = (wave[i+1] - s0) * f;
+
+	return (dv_i32_t)(((dv_u32_t)s0 << 16) + ((dv_u32_t)d << (16 - WAVE_INTERP_BITS)));
+#else
+	return wave[phase >> shift];
+#endif
+}
 
-extern void tone_start(struct tonegen_s *tg, int note, dv_i32_t harmonic);
+extern void tone_start(struct tonegen_s *tg, int wav, int note, dv_i32_t harmonic);
 extern void tone_stop(struct tonegen_s *tg);
 extern dv_i32_t tone_play(struct tonegen_s *tg);
 
@@ -0,0 +1,136 @@
+/*	effect-bench.c - host benchmark for the effect chain: per-sample versus block processing
+ *
+ *	Copyright 2026 David Haworth
+ *
+ *	This file is part of SynthEffect.
+ *
+ *	SynthEffect is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	SynthEffect is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with SynthEffect.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <dv-config.h>
+#include <davroska.h>
+#include <synth-config.h>
+#include <notequeue.h>
+#include <wave.h>
+#include <effect.h>
+#include <effect-synth.h>
+#include <effect-dac.h>
+#include <monitor.h>
+#include <host.h>
+
+/* Usage: effect-bench [n_notes [seconds]]
+ *
+ * Builds the same synth+dac chain as syntheffect_init(), starts n_notes notes and lets them
+ * sustain, then runs the chain for the given number of seconds of audio, first one sample at a
+ * time with effect_chain() and then in blocks of 1, 2, 4 ... EFFECT_BLOCK_LEN samples with
+ * effect_chain_block() (linked list) and effect_process_block() (compiled chain).
+ * The cost is reported in cycles per sample.
+ *
+ * The synth runs on a virtual clock (host_frc_fixed) that advances by the samples processed, as
+ * in voice-bench. So the governor never sheds a voice, and every row is measured with all the notes.
+*/
+struct effect_s bench_stage[2];
+
+static void start_notes(int n_notes)
+{
+	dv_i64_t x = 0;
+
+	for ( int i = 0; i < n_notes; i++ )
+	{
+		send_note(0, NOTE_START | (100 << 8) | (48 + i * 3));
+		host_frc += MONITOR_TICKS_PER_SAMPLE;
+		x = effect_chain(effect_list.next, x);		/* The synth takes the note when it falls due */
+	}
+}
+
+int main(int argc, char **argv)
+{
+	int n_notes = (argc > 1) ? atoi(argv[1]) : 10;
+	int seconds = (argc > 2) ? atoi(argv[2]) : 10;
+	long nsamp = (long)seconds * SAMPLES_PER_SEC;
+	dv_u64_t t0, t1;
+	double per_sample;
+
+	if ( n_notes < 0 || n_notes > MAX_POLYPHONIC )
+	{
+		fprintf(stderr, "n_notes must be between 0 and %d\n", MAX_POLYPHONIC);
+		return 1;
+	}
+
+	host_frc_fixed = 1;
+	host_frc = 0;
+
+	notechannels_init();
+	effect_init();
+	effect_synth_init(&bench_stage[0]);
+	effect_append(&bench_stage[0]);
+	effect_dac_init(&bench_stage[1]);
+	effect_append(&bench_stage[1]);
+	if ( effect_compile() != 0 )
+		panic("effect_compile", "Oops! compile failed");
+
+	if ( n_notes > 0 )
+		synth_control(0, SYNTH_CTRL_N_POLY, n_notes);
+
+	start_notes(n_notes);
+
+	printf("%d notes, %d seconds of audio, EFFECT_BLOCK_LEN = %d\n", n_notes, seconds, EFFECT_BLOCK_LEN);
+
+	/* Per-sample processing
+	*/
+	{
+		dv_i64_t x = 0;
+
+		t0 = host_cycles();
+		for ( long s = 0; s < nsamp; s++ )
+		{
+			host_frc += MONITOR_TICKS_PER_SAMPLE;
+			x = effect_chain(effect_list.next, x);
+		}
+		t1 = host_cycles();
+	}
+	per_sample = (double)(t1 - t0) / (double)nsamp;
+	printf("per-sample             : %8.1f cycles/sample\n", per_sample);
+
+	/* Block processing with increasing block lengths, first via the list, then compiled.
+	*/
+	for ( int compiled = 0; compiled <= 1; compiled++ )
+	{
+		for ( int n = 1; n <= EFFECT_BLOCK_LEN; n *= 2 )
+		{
+			static struct effect_block_s buf;
+			long nblk = nsamp / n;
+			double per_block_sample;
+
+			t0 = host_cycles();
+			for ( long b = 0; b < nblk; b++ )
+			{
+				host_frc += n * MONITOR_TICKS_PER_SAMPLE;
+				if ( compiled )
+					effect_process_block(EFFECT_FIRST_CORE, &buf, n);
+				else
+					effect_chain_block(effect_list.next, &buf, n);
+			}
+			t1 = host_cycles();
+
+			per_block_sample = (double)(t1 - t0) / (double)(nblk * n);
+			printf("%s block of %-4d : %8.1f cycles/sample (%.2fx)\n", compiled ? "compiled" : "list    ",
+						n, per_block_sample, per_sample/per_block_sample);
+		}
+	}
+
+	return 0;
+}
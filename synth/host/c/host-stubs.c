@@ -0,0 +1,176 @@
+/*	host-stubs.c - host implementations of the davroska/hardware functions used by the DSP code
+ *
+ *	Copyright 2026 David Haworth
+ *
+ *	This file is part of SynthEffect.
+ *
+ *	SynthEffect is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	SynthEffect is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with SynthEffect.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <dv-config.h>
+#include <davroska.h>
+#include <dv-arm-bcm2835-armtimer.h>
+#include <dv-arm-bcm2835-pcm.h>
+#include <synth-config.h>
+#include <synth-stdio.h>
+#include <host.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+volatile dv_boolean_t effect_sync;
+
+void (*host_pcm_sink)(dv_i32_t val);
+int host_pcm_paced;
+dv_u32_t host_pcm_underruns;
+int host_frc_fixed;
+dv_u32_t host_frc;
+dv_u32_t host_pcm_stall;
+
+static int pcm_started;			/* The FIFO has started emptying */
+static dv_u64_t pcm_t0;			/* Time at which the FIFO started emptying */
+static dv_u64_t pcm_written;	/* No. of words written since pcm_t0 */
+
+/* host_ns() - monotonic clock in nanoseconds
+*/
+dv_u64_t host_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (dv_u64_t)ts.tv_sec * 1000000000uL + (dv_u64_t)ts.tv_nsec;
+}
+
+dv_u64_t host_cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	return host_ns();
+#endif
+}
+
+/* dv_arm_bcm2835_armtimer_read_frc() - 250 MHz free-running counter, as on the Pi
+*/
+dv_u32_t dv_arm_bcm2835_armtimer_read_frc(void)
+{
+	if ( host_frc_fixed )
+		return host_frc;
+	return (dv_u32_t)(host_ns() / 4);
+}
+
+/* pcm_now() - the time in ns for the simulated PCM transmitter: the real clock or the virtual FRC
+*/
+static dv_u64_t pcm_now(void)
+{
+	if ( host_frc_fixed )
+		return (dv_u64_t)host_frc * 4;
+	return host_ns();
+}
+
+/* pcm_consumed() - no. of words that the simulated PCM transmitter has taken from the FIFO
+*/
+static dv_u64_t pcm_consumed(dv_u64_t now)
+{
+	return (now - pcm_t0) * (2 * SAMPLES_PER_SEC) / 1000000000uL;
+}
+
+/* pcm_wait() - wait until there's space in the FIFO and return the time
+ *
+ * On the virtual clock the FRC is advanced to the time at which the transmitter takes the word
+ * that makes space.
+*/
+static dv_u64_t pcm_wait(dv_u64_t now)
+{
+	if ( pcm_written < (pcm_consumed(now) + HOST_PCM_FIFO_LEN) )
+		return now;
+
+	if ( host_frc_fixed )
+	{
+		dv_u64_t n = pcm_written - HOST_PCM_FIFO_LEN + 1;
+		dv_u64_t t = pcm_t0 + (n * 1000000000uL + (2 * SAMPLES_PER_SEC) - 1) / (2 * SAMPLES_PER_SEC);
+
+		host_frc = (dv_u32_t)((t + 3) / 4);
+		return pcm_now();
+	}
+
+	while ( pcm_written >= (pcm_consumed(now) + HOST_PCM_FIFO_LEN) )
+		now = host_ns();
+	return now;
+}
+
+void dv_pcm_write(dv_i32_t val)
+{
+	if ( host_pcm_paced )
+	{
+		dv_u64_t now;
+
+		if ( host_frc_fixed && host_pcm_stall != 0 )
+		{
+			host_frc += host_pcm_stall;
+			host_pcm_stall = 0;
+		}
+		now = pcm_now();
+
+		if ( !pcm_started )
+		{
+			pcm_started = 1;
+			pcm_t0 = now;
+		}
+		else if ( pcm_consumed(now) > pcm_written )
+		{
+			/* The FIFO has run dry. Restart it empty.
+			*/
+			host_pcm_underruns++;
+			pcm_t0 = now;
+			pcm_written = 0;
+		}
+
+		(void)pcm_wait(now);
+
+		pcm_written++;
+	}
+
+	if ( host_pcm_sink != DV_NULL )
+		host_pcm_sink(val);
+}
+
+void dv_pcm_read(dv_i32_t *val)
+{
+	*val = 0;
+}
+
+/* sy_printf() - all output goes to stderr so that stdout is free for data
+*/
+int sy_printf(const char *fmt, ...)
+{
+	int nprinted;
+	va_list ap;
+
+	va_start(ap, fmt);
+	nprinted = vfprintf(stderr, fmt, ap);
+	va_end(ap);
+
+	return nprinted;
+}
+
+void panic(char *func, char *msg)
+{
+	fprintf(stderr, "Panic in %s : %s\n\n", func, msg);
+	exit(1);
+}
@@ -0,0 +1,649 @@
+/*	kernel-check.c - host check and benchmark of the synth's voice kernel
+ *
+ *	Copyright 2026 David Haworth
+ *
+ *	This file is part of SynthEffect.
+ *
+ *	SynthEffect is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	SynthEffect is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with SynthEffect.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <dv-config.h>
+#include <davroska.h>
+#include <synth-config.h>
+#include <notequeue.h>
+#include <wave.h>
+#include <effect.h>
+#include <effect-synth.h>
+#include <adsr.h>
+#include <host.h>
+#include <wave-calc.h>
+
+/* Usage: kernel-check [n_trials [seconds]]
+ *
+ * Compares synth_render_group() with the scalar reference synth_render_group_ref() for n_trials
+ * groups of voices in random states (every phase of the envelope and of the fast release of
+ * a stolen voice, random notes, ADSR profiles, pitch and amplitude modulation).
+ * The mixes and the voice states must be identical.
+ * Then does the same for synth_render_unison() and synth_render_unison_ref(), with unison notes
+ * of 2 to SYNTH_LANES oscillators and random detunes and stereo spreads.
+ * Then checks that the synth starts notes at the samples given by their time stamps, including
+ * stamps that are so old that they have wrapped (see check_stamps()), and that a note can start
+ * while a voice that the governor has shed is fading out (see check_shed()). Then measures the
+ * error of the wave tables against the 32-bit tables and the exact waveforms (see check_tables()).
+ *
+ * Then renders the given number of seconds of MAX_POLYPHONIC sustained voices (of all the waveforms,
+ * so that the wave tables are all in use) with each version
+ * and reports the cost in ns per voice-sample and the speed-up, and the same for notes of
+ * SYNTH_LANES unison oscillators in ns per note-sample.
+ *
+ * Exits with 1 if any trial fails.
+*/
+struct effect_s check_stage;
+
+static struct synth_voicebank_s saved;
+
+static int rnd(int n)
+{
+	return rand() % n;
+}
+
+/* rnd_phase() - return a random 32-bit phase
+*/
+static dv_u32_t rnd_phase(void)
+{
+	return ((dv_u32_t)rnd(1 << 16) << 16) | (dv_u32_t)rnd(1 << 16);
+}
+
+/* set_table() - select the level of the wave table of waveform wav for the voice's increment,
+ * as the synth does
+*/
+static void set_table(int v, int wav)
+{
+	int l = wave_level(voice.incr[v]);
+
+	voice.wave[v] = wave_table(wav);
+	voice.table[v] = wave_table(wav)->level[l];
+	voice.shift[v] = wave_table(wav)->shift[l];
+}
+
+/* random_voices() - put the voices of group g into random states
+*/
+static void random_voices(int g)
+{
+	int v = g * SYNTH_LANES;
+
+	voice.lanes[g] = 0;
+
+	for ( int l = 0; l < SYNTH_LANES; l++ )
+	{
+		int note = rnd(128);
+
+		voice.midi_note[v+l] = note;
+		voice.env_pos[v+l] = 0;
+		voice.fade[v+l] = 0;
+		voice.table[v+l] = DV_NULL;
+
+		if ( rnd(8) == 0 )
+		{
+			voice.env_pos[v+l] = -1;
+			continue;
+		}
+
+		/* Start the note, then move it to a random point of its envelope and its wave
+		*/
+		voice.incr[v+l] = wave_incr[note];
+		voice.phase[v+l] = rnd_phase();
+		voice.gain[v+l] = rnd(ADSR_GMAX + 1);
+		voice.age[v+l] = rnd(1000000);
+
+		/* Modulated pitch and an amplitude ramp that stays in range for a block
+		*/
+		if ( rnd(4) )
+			voice.incr[v+l] += rnd(1 << 16) - (1 << 15);
+		set_table(v+l, SAW + rnd(WAVE_N_TYPES));
+		voice.amp[v+l] = rnd(SYNTH_AMP1 + 1);
+		voice.amp_step[v+l] = (rnd(SYNTH_AMP1 + 1) - voice.amp[v+l]) / EFFECT_BLOCK_LEN;
+
+		switch ( rnd(4) )
+		{
+		case 0:		/* Near the start of the attack */
+			voice.env_pos[v+l] = rnd(EFFECT_BLOCK_LEN);
+			break;
+		case 1:		/* Near the sustain phase */
+			voice.env_pos[v+l] = synth_patch[0].adsr.tSustain - rnd(EFFECT_BLOCK_LEN);
+			break;
+		case 2:		/* Near the end of the release */
+			voice.env_pos[v+l] = synth_patch[0].adsr.tTotal - rnd(EFFECT_BLOCK_LEN);
+			break;
+		default:
+			voice.env_pos[v+l] = rnd(synth_patch[0].adsr.tTotal + 1);
+			break;
+		}
+
+		if ( voice.env_pos[v+l] < 0 )
+			voice.env_pos[v+l] = 0;
+
+		if ( rnd(4) == 0 )
+		{
+			voice.fade[v+l] = 1 + rnd(SYNTH_FADE_LEN);
+			voice.fade_gain[v+l] = rnd(ADSR_GMAX + 1);
+		}
+
+		synth_voice_on(v+l);
+	}
+}
+
+static int same_voices(int g)
+{
+	int v = g * SYNTH_LANES;
+
+	if ( voice.lanes[g] != saved.lanes[g] )
+		return 0;
+
+	for ( int l = 0; l < SYNTH_LANES; l++ )
+	{
+		int i = v + l;
+
+		if ( voice.env_pos[i] != saved.env_pos[i] || voice.age[i] != saved.age[i] ||
+			 voice.fade[i] != saved.fade[i] )
+			return 0;
+
+		/* The gain and phase of a silent voice are don't-cares, but they aren't changed either
+		*/
+		if ( voice.gain[i] != saved.gain[i] || voice.phase[i] != saved.phase[i] ||
+			 voice.amp[i] != saved.amp[i] )
+			return 0;
+	}
+	return 1;
+}
+
+/* random_unison() - put group g into a random state as a unison note of part 0
+ *
+ * The envelope is set up as for a voice of an ordinary group and the oscillators get random
+ * phases and detuned increments.
+*/
+static void random_unison(int g)
+{
+	int v = g * SYNTH_LANES;
+	int n_osc = 2 + rnd(SYNTH_LANES - 1);
+	int wav;
+
+	random_voices(g);
+
+	voice.n_osc[g] = n_osc;
+	voice.part[g] = 0;
+	voice.lanes[g] &= 1;
+
+	for ( int l = 1; l < SYNTH_LANES; l++ )
+	{
+		voice.env_pos[v+l] = -1;
+		voice.midi_note[v+l] = voice.midi_note[v];
+	}
+
+	wav = SAW + rnd(WAVE_N_TYPES);
+	for ( int l = 0; l < n_osc; l++ )
+	{
+		int note = voice.midi_note[v];
+		voice.incr[v+l] = wave_incr[note] - rnd(1 << 16);
+		set_table(v+l, wav);
+		voice.phase[v+l] = rnd_phase();
+	}
+
+	synth_patch[0].spread = rnd(SYNTH_PAN1 + 1);
+}
+
+/* check_unison() - run n_trials random comparisons of unison notes
+*/
+static int check_unison(int n_trials)
+{
+	dv_i64_t mix_ref[2][EFFECT_BLOCK_LEN];
+	dv_i64_t mix[2][EFFECT_BLOCK_LEN];
+	struct synth_voicebank_s start;
+	int fail = 0;
+
+	for ( int t = 0; t < n_trials; t++ )
+	{
+		int n = 1 + rnd(EFFECT_BLOCK_LEN);
+		int g = rnd(SYNTH_N_GROUPS);
+
+		random_unison(g);
+		start = voice;
+
+		memset(mix_ref, 0, sizeof(mix_ref));
+		synth_render_unison_ref(g, mix_ref[0], mix_ref[1], n);
+		saved = voice;
+
+		voice = start;
+		memset(mix, 0, sizeof(mix));
+		synth_render_unison(g, mix[0], mix[1], n);
+
+		if ( memcmp(mix, mix_ref, sizeof(mix)) != 0 || !same_voices(g) )
+		{
+			if ( fail < 10 )
+				printf("unison trial %d: group %d, %d oscillators, %d samples: mismatch\n", t, g,
+							voice.n_osc[g], n);
+			fail++;
+		}
+
+		voice.n_osc[g] = 1;
+	}
+
+	printf("%d unison trials, %d failed\n", n_trials, fail);
+	return fail;
+}
+
+/* check() - run n_trials random comparisons
+*/
+static int check(int n_trials)
+{
+	dv_i64_t mix_ref[EFFECT_BLOCK_LEN];
+	dv_i64_t mix[EFFECT_BLOCK_LEN];
+	struct synth_voicebank_s start;
+	int fail = 0;
+
+	for ( int t = 0; t < n_trials; t++ )
+	{
+		int n = 1 + rnd(EFFECT_BLOCK_LEN);
+		int g = rnd(SYNTH_N_GROUPS);
+		dv_u32_t lanes;
+
+		if ( (t % 100) == 0 )
+		{
+			/* A new ADSR profile. A decay time of zero isn't usable: the release divides by it.
+			*/
+			adsr_set_a(&synth_patch[0].adsr, rnd(128), SAMPLES_PER_SEC);
+			adsr_set_d(&synth_patch[0].adsr, 1 + rnd(127), SAMPLES_PER_SEC);
+			adsr_set_s(&synth_patch[0].adsr, rnd(129), SAMPLES_PER_SEC);
+			adsr_set_r(&synth_patch[0].adsr, rnd(128), SAMPLES_PER_SEC);
+		}
+
+		random_voices(g);
+		lanes = voice.lanes[g] & (dv_u32_t)rnd(1 << SYNTH_LANES);	/* Some voices not rendered */
+		start = voice;
+
+		memset(mix_ref, 0, sizeof(mix_ref));
+		synth_render_group_ref(g, lanes, mix_ref, n);
+		saved = voice;
+
+		voice = start;
+		memset(mix, 0, sizeof(mix));
+		synth_render_group(g, lanes, mix, n);
+
+		if ( memcmp(mix, mix_ref, n * sizeof(mix[0])) != 0 || !same_voices(g) )
+		{
+			if ( fail < 10 )
+				printf("trial %d: group %d, lanes %x, %d samples: mismatch\n", t, g, lanes, n);
+			fail++;
+		}
+	}
+
+	printf("%d trials, %d failed\n", n_trials, fail);
+	return fail;
+}
+
+/* run_block() - run the synth stage for one block at time "now" on the virtual clock
+*/
+static void run_block(dv_u32_t now)
+{
+	static struct effect_block_s blk;
+
+	host_frc = now;
+	effect_synth_frame(&check_stage, &blk, EFFECT_BLOCK_LEN);
+}
+
+/* stamp_offset() - run the synth stage for one block at time "now" and return the sample offset
+ * at which note started, or -1 if it hasn't started
+*/
+static int stamp_offset(dv_u32_t now, int note)
+{
+	run_block(now);
+
+	for ( int v = 0; v < MAX_POLYPHONIC; v++ )
+	{
+		if ( voice.midi_note[v] == note && voice.env_pos[v] >= 0 )
+			return EFFECT_BLOCK_LEN - voice.env_pos[v];
+	}
+
+	return -1;
+}
+
+/* check_stamps() - check that note messages start at the sample given by their time stamps
+ *
+ * The synth stage runs on the virtual clock. A message sent during the previous block starts at
+ * its own offset, a message sent during the current block waits for the next block, and a message
+ * that's older than the previous block starts at offset 0. The old messages include some that are
+ * so old (more than 67 ms) that their time stamps have wrapped and appear to be in the future.
+*/
+static int check_stamps(void)
+{
+	const dv_u32_t blk = EFFECT_BLOCK_LEN * MONITOR_TICKS_PER_SAMPLE;
+	const dv_u32_t ms = SAMPLES_PER_SEC / 1000 * MONITOR_TICKS_PER_SAMPLE;
+	static const struct { char *name; dv_i32_t ago; int expect1; int expect2; } cases[] =
+	{	/* ago is in samples before the start of the block that sees the message */
+		{	"previous block",	EFFECT_BLOCK_LEN - 5,	5,	5	},
+		{	"current block",	-10,					-1,	10	},
+		{	"late",				EFFECT_BLOCK_LEN + 7,	0,	0	},
+	};
+	static const int stale_ms[] = { 40, 70, 100, 120, 133 };
+	int n_cases = sizeof(cases) / sizeof(cases[0]);
+	int n_stale = sizeof(stale_ms) / sizeof(stale_ms[0]);
+	dv_u32_t now = 1000000;
+	int note = 40;
+	int fail = 0;
+
+	host_frc_fixed = 1;
+	host_frc = now;
+	effect_synth_init(&check_stage);
+
+	for ( int i = 0; i < n_cases + n_stale; i++ )
+	{
+		dv_i32_t ago = (i < n_cases) ? cases[i].ago : stale_ms[i - n_cases] * (dv_i32_t)ms / MONITOR_TICKS_PER_SAMPLE;
+		int expect1 = (i < n_cases) ? cases[i].expect1 : 0;
+		int expect2 = (i < n_cases) ? cases[i].expect2 : 0;
+		int o1, o2;
+
+		now += blk;
+		stamp_offset(now, -1);			/* An empty block, so that the previous block is known */
+
+		send_note_at(0, NOTE_START | (100 << 8) | note, now + blk - ago * MONITOR_TICKS_PER_SAMPLE);
+		now += blk;
+		o1 = stamp_offset(now, note);
+		now += blk;
+		o2 = (o1 < 0) ? stamp_offset(now, note) : o1;
+
+		if ( o1 != expect1 || o2 != expect2 )
+		{
+			if ( i < n_cases )
+				printf("time stamp, %s: offset %d then %d, expected %d then %d\n",
+							cases[i].name, o1, o2, expect1, expect2);
+			else
+				printf("time stamp, %d ms old: offset %d then %d, expected %d then %d\n",
+							stale_ms[i - n_cases], o1, o2, expect1, expect2);
+			fail++;
+		}
+
+		send_note_at(0, NOTE_STOP | note, now);
+		note++;
+	}
+
+	host_frc_fixed = 0;
+
+	printf("%d time stamp checks, %d failed\n", n_cases + n_stale, fail);
+	return fail;
+}
+
+/* part_voices() - return the no. of voices of a part that the allocator accounts for: free, on the
+ * steal list or reserved. It's the size of the part's pool unless the allocator has gone wrong.
+*/
+static int part_voices(struct synth_part_s *pt)
+{
+	int n = pt->n_free + pt->n_used;
+
+	for ( int v = pt->first; v < pt->first + pt->n_voices; v++ )
+		n += synth_alloc.reserved[v];
+
+	return n;
+}
+
+/* check_shed() - check a note-on while a voice that the governor has shed is fading out
+ *
+ * The part steals notes until its free stack is empty, so all its fade voices are in use. Then the
+ * governor's limit is lowered by one, so a voice is shed and the part has one note fewer than
+ * n_poly but still no free voice. The limit is raised again (as when another part's voice
+ * finishes), so the part isn't full, and a note-on arrives before the fade has finished.
+ * The note must steal a voice rather than take one from the empty free stack.
+*/
+static int check_shed(void)
+{
+	struct effect_synth_s *sy = (struct effect_synth_s *)check_stage.control;
+	struct synth_part_s *pt = &sy->part[0];
+	const dv_u32_t blk = EFFECT_BLOCK_LEN * MONITOR_TICKS_PER_SAMPLE;
+	dv_u32_t now = 1000000;
+	int note = 20;
+	int fail = 0;
+	int v;
+
+	host_frc_fixed = 1;
+	host_frc = now;
+	effect_synth_init(&check_stage);
+	run_block(now += blk);
+
+	/* Fill the part, a few notes per block, then steal until the free stack is empty
+	*/
+	while ( pt->n_used < pt->n_poly || pt->n_free > 0 )
+	{
+		if ( pt->n_used < pt->n_poly )
+		{
+			for ( int k = 0; k < 4 && pt->n_used + k < pt->n_poly; k++ )
+				send_note_at(0, NOTE_START | (100 << 8) | note++, now);
+		}
+		else
+		{
+			for ( int k = 0; k < pt->n_free; k++ )
+				send_note_at(0, NOTE_START | (100 << 8) | note++, now);
+		}
+		run_block(now += blk);
+	}
+
+	sy->n_limit = pt->n_used - 1;			/* Shed one voice */
+	run_block(now += blk);
+	sy->n_limit = sy->n_polyphonic;
+
+	if ( pt->n_used != pt->n_poly - 1 || pt->n_free != 0 )
+	{
+		printf("shed: setup failed, %d of %d notes, %d free\n", pt->n_used, pt->n_poly, pt->n_free);
+		fail++;
+	}
+
+	send_note_at(0, NOTE_START | (100 << 8) | note, now);
+	run_block(now += blk);
+
+	v = synth_alloc.note_voice[0][note];
+	if ( pt->n_free < 0 || v < pt->first || v >= pt->first + pt->n_voices || part_voices(pt) != pt->n_voices )
+	{
+		printf("shed: note-on while fading: voice %d, %d free, %d of %d voices accounted for\n",
+					v, pt->n_free, part_voices(pt), pt->n_voices);
+		fail++;
+	}
+
+	/* Let the fades finish: every voice must be back in the accounts
+	*/
+	for ( int i = 0; i < 8; i++ )
+		run_block(now += blk);
+
+	if ( part_voices(pt) != pt->n_voices )
+	{
+		printf("shed: after the fades %d of %d voices accounted for\n", part_voices(pt), pt->n_voices);
+		fail++;
+	}
+
+	host_frc_fixed = 0;
+
+	printf("shed voice check: %s\n", fail ? "failed" : "ok");
+	return fail;
+}
+
+/* check_tables() - measure the error of the wave tables
+ *
+ * Each level of each waveform is read with wave_sample() at every sample and at three points
+ * between each pair of samples. The result is compared with the 32-bit table without
+ * interpolation (the tables before WAVE_SAMPLE_BITS, recomputed here) and with the exact
+ * band-limited waveform. The errors are reported in dB relative to full scale.
+ *
+ * At the samples the error must be no more than two steps of a 16-bit sample. Between the samples
+ * the interpolated table must be no further from the exact waveform than the 32-bit table is.
+*/
+#define CHECK_TABLE_POINTS	4
+
+static int check_tables(void)
+{
+	const double full = 2147483648.0;
+	int fail = 0;
+
+	for ( int wav = SAW; wav < SAW + WAVE_N_TYPES; wav++ )
+	{
+		double scale = wavecalc_scale(wav, full - 1.0);
+		double e_sample = 0.0, e_32 = 0.0, e_interp = 0.0, e_step = 0.0;
+
+		for ( int l = 0; l < wavecalc_levels(wav); l++ )
+		{
+			int bits = wavecalc_level_bits(l);
+			int len = 1 << bits;
+			int n_harm = wavecalc_n_harm(wav, l);
+			const wave_sample_t *table = wave_table(wav)->level[l];
+			dv_u32_t shift = 32 - bits;
+
+			for ( int j = 0; j < len; j++ )
+			{
+				double t32 = floor(wavecalc_value(wav, j, len, n_harm) * scale + 0.5);
+
+				for ( int q = 0; q < CHECK_TABLE_POINTS; q++ )
+				{
+					dv_u32_t phase = ((dv_u32_t)j << shift) + ((dv_u32_t)q << (shift - 2));
+					double exact = wavecalc_value_at(wav, j + (double)q / CHECK_TABLE_POINTS, len, n_harm) * scale;
+					double v = wave_sample(table, shift, phase);
+
+					if ( q == 0 )
+						e_sample = fmax(e_sample, fabs(v - t32));
+					e_32 = fmax(e_32, fabs(v - t32));
+					e_interp = fmax(e_interp, fabs(v - exact));
+					e_step = fmax(e_step, fabs(t32 - exact));
+				}
+			}
+		}
+
+		printf("wave table %d (%d-bit): error at the samples %.1f dB; between them %.1f dB from the 32-bit table,"
+				" %.1f dB from exact (32-bit table %.1f dB)\n", wav, WAVE_SAMPLE_BITS,
+				20.0 * log10(fmax(e_sample, 1.0) / full), 20.0 * log10(fmax(e_32, 1.0) / full),
+				20.0 * log10(e_interp / full), 20.0 * log10(e_step / full));
+
+		if ( e_sample > 2.0 * 65536.0 || e_interp > e_step )
+		{
+			printf("wave table %d: error too large\n", wav);
+			fail++;
+		}
+	}
+
+	return fail;
+}
+
+/* bench() - render nsamp samples of all the voices and return the time in ns per voice-sample
+*/
+static double bench(void (*render)(int g, dv_u32_t lanes, dv_i64_t *mix, int n), long nsamp)
+{
+	static dv_i64_t mix[EFFECT_BLOCK_LEN];
+	dv_u64_t t0, t1;
+
+	t0 = host_ns();
+
+	for ( long s = 0; s < nsamp; s += EFFECT_BLOCK_LEN )
+	{
+		for ( int g = 0; g < SYNTH_N_GROUPS; g++ )
+			render(g, voice.lanes[g], mix, EFFECT_BLOCK_LEN);
+	}
+
+	t1 = host_ns();
+
+	return (double)(t1 - t0) / ((double)nsamp * MAX_POLYPHONIC);
+}
+
+/* bench_unison() - render nsamp samples of a unison note on every group and return the time
+ * in ns per note-sample
+*/
+static double bench_unison(void (*render)(int g, dv_i64_t *left, dv_i64_t *right, int n), long nsamp)
+{
+	static dv_i64_t left[EFFECT_BLOCK_LEN];
+	static dv_i64_t right[EFFECT_BLOCK_LEN];
+	dv_u64_t t0, t1;
+
+	t0 = host_ns();
+
+	for ( long s = 0; s < nsamp; s += EFFECT_BLOCK_LEN )
+	{
+		for ( int g = 0; g < SYNTH_N_GROUPS; g++ )
+			render(g, left, right, EFFECT_BLOCK_LEN);
+	}
+
+	t1 = host_ns();
+
+	return (double)(t1 - t0) / ((double)nsamp * SYNTH_N_GROUPS);
+}
+
+int main(int argc, char **argv)
+{
+	int n_trials = (argc > 1) ? atoi(argv[1]) : 100000;
+	int seconds = (argc > 2) ? atoi(argv[2]) : 10;
+	long nsamp = (long)seconds * SAMPLES_PER_SEC;
+	double ns_ref, ns_simd, ns_uref, ns_usimd;
+	int fail;
+
+	notechannels_init();
+	effect_init();
+	effect_synth_init(&check_stage);
+
+	srand(1);
+	fail = check(n_trials);
+	fail += check_unison(n_trials);
+#if SYNTH_VOICE_WORKERS == 0
+	fail += check_stamps();
+	fail += check_shed();
+#endif
+	fail += check_tables();
+
+	/* Sustained notes on all the voices
+	*/
+	effect_synth_init(&check_stage);
+	for ( int v = 0; v < MAX_POLYPHONIC; v++ )
+	{
+		int note = (36 + v * 7) % SYNTH_N_NOTES;
+		voice.midi_note[v] = note;
+		voice.incr[v] = wave_incr[note];
+		set_table(v, SAW + v % WAVE_N_TYPES);
+		voice.phase[v] = 0;
+		voice.env_pos[v] = synth_patch[0].adsr.tSustain;
+		synth_voice_on(v);
+	}
+
+	ns_ref = bench(&synth_render_group_ref, nsamp);
+	ns_simd = bench(&synth_render_group, nsamp);
+
+	/* The same voices as unison notes: lane 0 of each group sounds, with all its oscillators
+	*/
+	synth_patch[0].spread = SYNTH_PAN1 / 2;
+	for ( int g = 0; g < SYNTH_N_GROUPS; g++ )
+	{
+		voice.n_osc[g] = SYNTH_LANES;
+		voice.lanes[g] = 1;
+	}
+
+	ns_uref = bench_unison(&synth_render_unison_ref, nsamp);
+	ns_usimd = bench_unison(&synth_render_unison, nsamp);
+
+	printf("%d voices, %d lanes%s, all waveforms\n", MAX_POLYPHONIC, SYNTH_LANES,
+				SYNTH_SIMD ? "" : " (SYNTH_SIMD == 0)");
+	printf("wave tables: %d-bit samples, %lu bytes (%lu per waveform)\n", WAVE_SAMPLE_BITS,
+				(unsigned long)((WAVE_N_TYPES - 1) * WAVE_TOTAL_SAMPLES + WAVE_LEN + 1) * sizeof(wave_sample_t),
+				(unsigned long)WAVE_TOTAL_SAMPLES * sizeof(wave_sample_t));
+	printf("reference: %.2f ns per voice-sample\n", ns_ref);
+	printf("kernel:    %.2f ns per voice-sample, speed-up %.2f\n", ns_simd, ns_ref / ns_simd);
+	printf("unison x%d reference: %.2f ns per note-sample\n", SYNTH_LANES, ns_uref);
+	printf("unison x%d kernel:    %.2f ns per note-sample, speed-up %.2f (%.2f x the cost of a voice)\n",
+				SYNTH_LANES, ns_usimd, ns_uref / ns_usimd, ns_usimd / ns_simd);
+
+	return fail ? 1 : 0;
+}
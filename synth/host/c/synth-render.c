@@ -0,0 +1,323 @@
+/*	synth-render.c - host offline renderer: plays a list of MIDI events through the synth into a WAV file
+ *
+ *	Copyright 2026 David Haworth
+ *
+ *	This file is part of SynthEffect.
+ *
+ *	SynthEffect is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	SynthEffect is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with SynthEffect.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <dv-config.h>
+#include <davroska.h>
+#include <synth-config.h>
+#include <notequeue.h>
+#include <wave.h>
+#include <effect.h>
+#include <effect-synth.h>
+#include <effect-dac.h>
+#include <host.h>
+
+/* Usage: synth-render [-s] [-t tail] events-file wav-file
+ *
+ * Builds the same synth+dac chain as syntheffect_init() and plays the MIDI events in events-file
+ * through it as fast as possible. The DAC output is written to wav-file (stereo, 32-bit).
+ * The rendering speed is reported in samples per second and as a real-time factor.
+ *
+ *	-s		process one sample at a time with effect_chain() instead of compiled blocks
+ *	-t tail	seconds to render after the last event (default 2)
+ *
+ * Each line of the event file is a time in seconds followed by the bytes of a MIDI message
+ * in hex. Blank lines and everything after a '#' are ignored. For example:
+ *
+ *	0.0		90 3c 64	# Note on, middle C
+ *	1.5		80 3c 00	# Note off
+ *	1.5		b0 14 10	# Controller 20 (no. of notes of part 0) = 16
+ *	1.6		d0 40		# Channel pressure
+ *	2.0		91 40 64	# Note on, channel 1 (part 1; silent until it has notes)
+ *
+ * The messages are handled in the same way as dispatch_midi_command() on the Pi: the channel
+ * of each message selects the part of the synth.
+ *
+ * The synth runs on a virtual clock: the free-running counter advances by MONITOR_TICKS_PER_SAMPLE
+ * per sample, and each note message is stamped with the time of its sample. The synth places a
+ * message at the sample offset given by its stamp, so each note starts on its own sample in
+ * both modes. Controller messages are applied at the start of the block that contains them.
+*/
+struct event_s
+{
+	long sample;
+	int order;
+	dv_u32_t cmd[3];
+};
+
+static struct event_s *events;
+static int n_events;
+
+static dv_i32_t *pcm_out;
+static long pcm_n;
+
+struct effect_s render_stage[2];
+
+static void render_sink(dv_i32_t val)
+{
+	pcm_out[pcm_n++] = val;
+}
+
+static int event_compare(const void *a, const void *b)
+{
+	const struct event_s *ea = a;
+	const struct event_s *eb = b;
+
+	if ( ea->sample != eb->sample )
+		return (ea->sample < eb->sample) ? -1 : 1;
+	return ea->order - eb->order;
+}
+
+/* read_events() - read the event file and sort the events by time
+*/
+static int read_events(const char *name)
+{
+	FILE *f = fopen(name, "r");
+	char line[256];
+	int max = 0;
+	int lineno = 0;
+
+	if ( f == NULL )
+	{
+		perror(name);
+		return -1;
+	}
+
+	while ( fgets(line, sizeof(line), f) != NULL )
+	{
+		char *p = strchr(line, '#');
+		double t;
+		unsigned b[3];
+		int n;
+
+		lineno++;
+		if ( p != NULL )
+			*p = '\0';
+
+		b[0] = b[1] = b[2] = 0;
+		n = sscanf(line, "%lf %x %x %x", &t, &b[0], &b[1], &b[2]);
+		if ( n <= 0 )
+			continue;
+
+		if ( n < 3 || t < 0.0 || (b[0] & 0x80) == 0 )
+		{
+			fprintf(stderr, "%s:%d: bad event\n", name, lineno);
+			fclose(f);
+			return -1;
+		}
+
+		if ( n_events >= max )
+		{
+			max = (max == 0) ? 256 : max * 2;
+			events = realloc(events, max * sizeof(*events));
+			if ( events == NULL )
+				panic("read_events", "out of memory");
+		}
+
+		events[n_events].sample = (long)(t * SAMPLES_PER_SEC + 0.5);
+		events[n_events].order = n_events;
+		events[n_events].cmd[0] = b[0] & 0xff;
+		events[n_events].cmd[1] = b[1] & 0x7f;
+		events[n_events].cmd[2] = b[2] & 0x7f;
+		n_events++;
+	}
+
+	fclose(f);
+	qsort(events, n_events, sizeof(*events), event_compare);
+	return 0;
+}
+
+/* dispatch() - handle a MIDI message as dispatch_midi_command() does, at time frc
+*/
+static void dispatch(dv_u32_t *cmd, dv_u32_t frc)
+{
+	dv_u32_t c = cmd[0] >> 4;
+	dv_u32_t ch = cmd[0] & 0x0f;
+
+	if ( c == 0x9 )
+		send_note_at(ch, NOTE_START | (cmd[2] << 8) | cmd[1], frc);
+	else if ( c == 0x8 )
+		send_note_at(ch, NOTE_STOP | cmd[1], frc);
+	else if ( c == 0xb || c == 0xd )
+	{
+		for ( int p = 0; p < SYNTH_N_PARTS; p++ )
+		{
+			if ( ch == notechannels.nq[p].channel )
+			{
+				if ( c == 0xb )
+					synth_control(p, (dv_i32_t)cmd[1], (dv_i32_t)cmd[2]);
+				else
+					synth_control(p, SYNTH_CTRL_PRESSURE, (dv_i32_t)cmd[1]);
+				break;
+			}
+		}
+	}
+}
+
+static void put_le(FILE *f, dv_u32_t v, int nbytes)
+{
+	for ( int i = 0; i < nbytes; i++ )
+		fputc((v >> (8 * i)) & 0xff, f);
+}
+
+/* write_wav() - write the captured DAC output as a stereo 32-bit WAV file
+*/
+static int write_wav(const char *name)
+{
+	FILE *f = fopen(name, "wb");
+	dv_u32_t data_bytes = (dv_u32_t)(pcm_n * 4);
+
+	if ( f == NULL )
+	{
+		perror(name);
+		return -1;
+	}
+
+	fputs("RIFF", f);
+	put_le(f, 36 + data_bytes, 4);
+	fputs("WAVEfmt ", f);
+	put_le(f, 16, 4);
+	put_le(f, 1, 2);							/* PCM */
+	put_le(f, 2, 2);							/* Channels */
+	put_le(f, SAMPLES_PER_SEC, 4);
+	put_le(f, SAMPLES_PER_SEC * 2 * 4, 4);		/* Bytes per second */
+	put_le(f, 2 * 4, 2);						/* Bytes per frame */
+	put_le(f, 32, 2);							/* Bits per sample */
+	fputs("data", f);
+	put_le(f, data_bytes, 4);
+
+	for ( long i = 0; i < pcm_n; i++ )
+		put_le(f, (dv_u32_t)pcm_out[i], 4);
+
+	if ( fclose(f) != 0 )
+	{
+		perror(name);
+		return -1;
+	}
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	int per_sample = 0;
+	double tail = 2.0;
+	long nsamp;
+	int opt;
+	int ev = 0;
+	dv_u64_t t0, t1;
+	double secs;
+
+	while ( (opt = getopt(argc, argv, "st:")) != -1 )
+	{
+		if ( opt == 's' )
+			per_sample = 1;
+		else if ( opt == 't' )
+			tail = atof(optarg);
+		else
+			break;
+	}
+
+	if ( opt != -1 || argc - optind != 2 )
+	{
+		fprintf(stderr, "Usage: synth-render [-s] [-t tail] events-file wav-file\n");
+		return 1;
+	}
+
+	if ( read_events(argv[optind]) != 0 )
+		return 1;
+
+	nsamp = ((n_events > 0) ? events[n_events-1].sample : 0) + (long)(tail * SAMPLES_PER_SEC);
+
+	pcm_out = malloc(nsamp * 2 * sizeof(*pcm_out));
+	if ( pcm_out == NULL )
+		panic("main", "out of memory");
+	host_pcm_sink = &render_sink;
+	host_frc_fixed = 1;
+	host_frc = 0;
+
+	notechannels_init();
+	effect_init();
+	effect_synth_init(&render_stage[0]);
+	effect_append(&render_stage[0]);
+	effect_dac_init(&render_stage[1]);
+	effect_append(&render_stage[1]);
+	if ( effect_compile() != 0 )
+		panic("effect_compile", "Oops! compile failed");
+
+	t0 = host_ns();
+
+	if ( per_sample )
+	{
+		for ( long s = 0; s < nsamp; s++ )
+		{
+			while ( ev < n_events && events[ev].sample <= s )
+			{
+				dispatch(events[ev].cmd, (dv_u32_t)(events[ev].sample * MONITOR_TICKS_PER_SAMPLE));
+				ev++;
+			}
+
+			host_frc = (dv_u32_t)((s + 1) * MONITOR_TICKS_PER_SAMPLE);
+			(void)effect_chain(effect_list.next, 0);
+		}
+	}
+	else
+	{
+		static struct effect_block_s buf;
+		long s = 0;
+
+		while ( s < nsamp )
+		{
+			long n = EFFECT_BLOCK_LEN;
+
+			if ( nsamp - s < n )
+				n = nsamp - s;
+
+			/* The events of this block are stamped with their own samples. The clock reads
+			 * the end of the block while it is processed, so they all fall due in this block.
+			*/
+			while ( ev < n_events && events[ev].sample < s + n )
+			{
+				dispatch(events[ev].cmd, (dv_u32_t)(events[ev].sample * MONITOR_TICKS_PER_SAMPLE));
+				ev++;
+			}
+
+			host_frc = (dv_u32_t)((s + n) * MONITOR_TICKS_PER_SAMPLE);
+			effect_process_block(EFFECT_FIRST_CORE, &buf, (int)n);
+			s += n;
+		}
+	}
+
+	t1 = host_ns();
+
+	secs = (double)(t1 - t0) / 1e9;
+	printf("%ld samples (%.2f s of audio), %d events, %s, %.3f s\n",
+			nsamp, (double)nsamp / SAMPLES_PER_SEC, n_events,
+			per_sample ? "per-sample" : "compiled blocks", secs);
+	printf("%.0f samples/s, real-time factor %.1f\n",
+			(double)nsamp / secs, ((double)nsamp / SAMPLES_PER_SEC) / secs);
+
+	if ( write_wav(argv[optind+1]) != 0 )
+		return 1;
+
+	return 0;
+}
@@ -0,0 +1,171 @@
+/*	voice-bench.c - host benchmark of the synth's cost per voice
+ *
+ *	Copyright 2026 David Haworth
+ *
+ *	This file is part of SynthEffect.
+ *
+ *	SynthEffect is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	SynthEffect is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with SynthEffect.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <dv-config.h>
+#include <davroska.h>
+#include <synth-config.h>
+#include <notequeue.h>
+#include <wave.h>
+#include <effect.h>
+#include <effect-synth.h>
+#include <effect-dac.h>
+#include <host.h>
+
+/* Usage: voice-bench [max_voices [seconds]]
+ *
+ * Builds the same synth+dac chain as syntheffect_init() and, for N = 0, 1, 2 ... max_voices
+ * (default MAX_POLYPHONIC), sets the polyphony to N, holds N notes until they all sustain and
+ * then times the given number of seconds of audio (default 1) through the compiled chain.
+ * The notes are released and allowed to finish between runs.
+ *
+ * For each N the cost is reported in ns per sample and in ns per voice-sample. The latter leaves
+ * out the cost of the chain with no notes (N = 0), so it shows how the cost of the voices scales.
+ * The last column is the number of voices that one core could render in real time at that cost.
+ *
+ * The synth runs on a virtual clock (host_frc_fixed) that advances one block per block, so
+ * the note messages are taken at the expected time and the governor never sheds a voice.
+*/
+struct effect_s bench_stage[2];
+
+static dv_u32_t bench_frc;
+
+/* bench_block() - process one block and advance the virtual clock
+*/
+static void bench_block(void)
+{
+	static struct effect_block_s buf;
+
+	bench_frc += EFFECT_BLOCK_LEN * MONITOR_TICKS_PER_SAMPLE;
+	host_frc = bench_frc;
+	effect_process_block(EFFECT_FIRST_CORE, &buf, EFFECT_BLOCK_LEN);
+}
+
+/* bench_notes() - start or stop n notes, no more than a queue full per block
+*/
+static void bench_notes(dv_u32_t start, int n)
+{
+	for ( int i = 0; i < n; i++ )
+	{
+		send_note(0, start | (100 << 8) | ((36 + i * 7) % SYNTH_N_NOTES));
+		if ( (i % NQ_LEN) == (NQ_LEN - 1) )
+			bench_block();
+	}
+	bench_block();
+}
+
+/* bench_count() - return the no. of voices that are in the envelope position p
+*/
+static int bench_count(int p)
+{
+	int n = 0;
+
+	for ( int v = 0; v < SYNTH_N_VOICES; v++ )
+	{
+		if ( voice.env_pos[v] == p )
+			n++;
+	}
+	return n;
+}
+
+/* bench_setup() - stop the notes of the previous run and hold n_voices notes until they sustain
+*/
+static void bench_setup(int n_prev, int n_voices)
+{
+	int n_sounding;
+
+	bench_notes(NOTE_STOP, n_prev);
+
+	while ( bench_count(-1) != SYNTH_N_VOICES )
+		bench_block();
+
+	if ( n_voices > 0 )
+		synth_control(0, SYNTH_CTRL_N_POLY, n_voices);
+
+	bench_notes(NOTE_START, n_voices);
+
+	for ( int i = 0; i <= synth_patch[0].adsr.tSustain / EFFECT_BLOCK_LEN; i++ )
+		bench_block();
+
+	n_sounding = bench_count(synth_patch[0].adsr.tSustain);
+	if ( n_sounding != n_voices )
+		printf("warning: %d voices sustaining instead of %d\n", n_sounding, n_voices);
+}
+
+int main(int argc, char **argv)
+{
+	int max_voices = (argc > 1) ? atoi(argv[1]) : MAX_POLYPHONIC;
+	double seconds = (argc > 2) ? atof(argv[2]) : 1.0;
+	long nblk = (long)(seconds * SAMPLES_PER_SEC) / EFFECT_BLOCK_LEN;
+	long nsamp = nblk * EFFECT_BLOCK_LEN;
+	double ns_base = 0.0;
+
+	if ( max_voices < 1 || max_voices > MAX_POLYPHONIC || nblk < 1 )
+	{
+		fprintf(stderr, "Usage: voice-bench [max_voices [seconds]]; max_voices 1 to %d\n", MAX_POLYPHONIC);
+		return 1;
+	}
+
+	host_frc_fixed = 1;
+
+	notechannels_init();
+	effect_init();
+	effect_synth_init(&bench_stage[0]);
+	effect_append(&bench_stage[0]);
+	effect_dac_init(&bench_stage[1]);
+	effect_append(&bench_stage[1]);
+	if ( effect_compile() != 0 )
+		panic("effect_compile", "Oops! compile failed");
+
+	printf("%.2f s of audio per run, EFFECT_BLOCK_LEN = %d, %s kernel\n", (double)nsamp / SAMPLES_PER_SEC,
+				EFFECT_BLOCK_LEN, SYNTH_SIMD ? "SIMD" : "scalar");
+	printf("voices  ns/sample  ns/voice-sample  voices/core\n");
+
+	for ( int n = 0; n <= max_voices; n++ )
+	{
+		dv_u64_t t0, t1;
+		double ns;
+
+		bench_setup(n - 1, n);
+
+		t0 = host_ns();
+		for ( long b = 0; b < nblk; b++ )
+			bench_block();
+		t1 = host_ns();
+
+		ns = (double)(t1 - t0) / (double)nsamp;
+
+		if ( n == 0 )
+		{
+			ns_base = ns;
+			printf("%6d %10.1f\n", n, ns);
+		}
+		else
+		{
+			double per_voice = (ns - ns_base) / n;
+
+			printf("%6d %10.1f %16.2f %12.0f\n", n, ns, per_voice,
+						(per_voice > 0.0) ? (1e9 / SAMPLES_PER_SEC) / per_voice : 0.0);
+		}
+	}
+
+	return 0;
+}
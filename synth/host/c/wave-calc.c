@@ -0,0 +1,167 @@
+/*	wave-calc.c - the band-limited waveforms that the wave tables are made from
+ *
+ *	Copyright 2026 David Haworth
+ *
+ *	This file is part of SynthEffect.
+ *
+ *	SynthEffect is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	SynthEffect is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with SynthEffect.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <math.h>
+
+#include <dv-config.h>
+#include <davroska.h>
+#include <synth-config.h>
+#include <wave.h>
+#include <wave-calc.h>
+
+/* wavecalc_level_bits() - return log2 of the length of a level of the wave tables
+ *
+ * Level 0 is WAVE_LEN samples long. Level 1 is the same length because it has half the
+ * harmonics of level 0, which needs all of them. Each level above that halves the length until
+ * WAVE_MIN_LEN is reached.
+*/
+int wavecalc_level_bits(int l)
+{
+	int bits = WAVE_BITS + 1 - l;
+
+	if ( bits > WAVE_BITS )
+		bits = WAVE_BITS;
+	if ( bits < WAVE_MIN_BITS )
+		bits = WAVE_MIN_BITS;
+	return bits;
+}
+
+/* wavecalc_level_n_harm() - return the no. of harmonics of a level of the wave tables
+ *
+ * The highest increment of level l (l > 0) is just below 2^(WAVE_LEVEL0_BITS + l). A harmonic h
+ * is below the Nyquist frequency (an increment of 2^31) if h is no more than 2^(31 - WAVE_LEVEL0_BITS - l).
+ * The top level has just the fundamental, and a table of len samples can hold up to len/2 - 1.
+*/
+int wavecalc_level_n_harm(int l, int len)
+{
+	int n_harm = (31 - WAVE_LEVEL0_BITS - l >= 0) ? (1 << (31 - WAVE_LEVEL0_BITS - l)) : 1;
+
+	if ( n_harm > len / 2 - 1 )
+		n_harm = len / 2 - 1;
+	return n_harm;
+}
+
+/* wavecalc_levels() - return the no. of levels that are stored for a waveform
+ *
+ * A sine has no harmonics to remove, so its levels would all be the same. It's stored once, at
+ * the full length, and all its levels point to it.
+*/
+int wavecalc_levels(int wav)
+{
+	return (wav == SIN) ? 1 : WAVE_N_LEVELS;
+}
+
+/* wavecalc_n_harm() - return the no. of harmonics of a stored level of a waveform
+*/
+int wavecalc_n_harm(int wav, int l)
+{
+	return (wavecalc_levels(wav) == 1) ? 1 : wavecalc_level_n_harm(l, 1 << wavecalc_level_bits(l));
+}
+
+/* harmonic() - return the amplitude of harmonic k of a waveform
+ *
+ * The waveforms start at their lowest point:
+ *	- sawtooth: rises from -1 to 1 over the cycle, so it's a series of sines
+ *	- triangle: rises from -1 to 1 over the first half and falls back, a series of cosines
+ *	- square: the sign of the triangle, a series of cosines
+ *	- sine: just the fundamental, as a (negative) cosine
+ * *cosine is set to 1 if the harmonic is a cosine.
+*/
+static double harmonic(int wav, int k, int *cosine)
+{
+	*cosine = (wav != SAW);
+
+	if ( wav == SAW )
+		return -2.0 / (M_PI * k);
+
+	if ( wav == SIN )
+		return (k == 1) ? -1.0 : 0.0;
+
+	if ( (k % 2) == 0 )
+		return 0.0;
+
+	if ( wav == TRI )
+		return -8.0 / (M_PI * M_PI * k * k);
+
+	return ((k % 4) == 1 ? -4.0 : 4.0) / (M_PI * k);
+}
+
+/* wavecalc_value() - return sample j of a cycle of len samples of a waveform with n_harm harmonics
+*/
+double wavecalc_value(int wav, int j, int len, int n_harm)
+{
+	double sum = 0.0;
+	int k, cosine;
+
+	for ( k = 1; k <= n_harm; k++ )
+	{
+		double a = harmonic(wav, k, &cosine);
+		double x = (2.0 * M_PI * (double)((k * j) % len)) / len;
+
+		if ( a != 0.0 )
+			sum += a * (cosine ? cos(x) : sin(x));
+	}
+	return sum;
+}
+
+/* wavecalc_value_at() - return the value of a waveform with n_harm harmonics at a position
+ * between the samples of a cycle of len samples
+*/
+double wavecalc_value_at(int wav, double pos, int len, int n_harm)
+{
+	double sum = 0.0;
+	int k, cosine;
+
+	for ( k = 1; k <= n_harm; k++ )
+	{
+		double a = harmonic(wav, k, &cosine);
+		double x = 2.0 * M_PI * fmod(k * pos, (double)len) / len;
+
+		if ( a != 0.0 )
+			sum += a * (cosine ? cos(x) : sin(x));
+	}
+	return sum;
+}
+
+/* wavecalc_scale() - return the factor that scales all the levels of a waveform to full scale
+ *
+ * The band-limited waves overshoot at their steps (the Gibbs effect), so all the levels are scaled
+ * by the same factor to bring the highest peak to full scale (maxi). That keeps the level of the
+ * fundamental the same at every level.
+*/
+double wavecalc_scale(int wav, double maxi)
+{
+	double peak = 0.0;
+
+	for ( int l = 0; l < wavecalc_levels(wav); l++ )
+	{
+		int len = 1 << wavecalc_level_bits(l);
+		int n_harm = wavecalc_n_harm(wav, l);
+
+		for ( int j = 0; j < len; j++ )
+		{
+			double x = fabs(wavecalc_value(wav, j, len, n_harm));
+
+			if ( x > peak )
+				peak = x;
+		}
+	}
+
+	return maxi / peak;
+}
@@ -0,0 +1,173 @@
+/*	wave-gen.c - host program that generates the wave tables as C source
+ *
+ *	Copyright 2026 David Haworth
+ *
+ *	This file is part of SynthEffect.
+ *
+ *	SynthEffect is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	SynthEffect is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with SynthEffect.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include <dv-config.h>
+#include <davroska.h>
+#include <synth-config.h>
+#include <wave.h>
+#include <wave-calc.h>
+
+/* Usage: wave-gen > wave-tables.c
+ *
+ * Writes the wave tables of all the waveforms (see wave.h) and the phase increments of the
+ * midi notes to stdout as const arrays. The Makefile runs it at build time, so the tables are
+ * in read-only memory and the synth doesn't have to compute them at startup.
+*/
+
+const dv_i64_t maxi = (1L << (WAVE_SAMPLE_BITS - 1)) - 1;
+
+const char *const wave_name[WAVE_N_TYPES] = { "saw", "tri", "squ", "sin" };
+
+/* The frequencies of the 12 semitones of the lowest octave. The values in this table were
+ * calculated by the "wave" host program (in the host-calc directory)
+*/
+static const double wave_root_f[12] =
+{	6.875,				/*	A	*/
+	7.28380877372013,	/*	Bb	*/
+	7.71692658212691,	/*	B	*/
+	8.17579891564368,	/*	C	*/
+	8.66195721802722,	/*	C#	*/
+	9.17702399741896,	/*	D	*/
+	9.722718241315,		/*	Eb	*/
+	10.3008611535272,	/*	E	*/
+	10.9133822322813,	/*	F	*/
+	11.5623257097385,	/*	F#	*/
+	12.2498573744296,	/*	G	*/
+	12.9782717993732	/*	Ab	*/
+};
+
+/* table_sample() - return sample j of a level, scaled and rounded to a wave table sample
+*/
+static int table_sample(int wav, int j, int len, int n_harm, double scale)
+{
+	return (int)floor(wavecalc_value(wav, j % len, len, n_harm) * scale + 0.5);
+}
+
+/* gen_wave() - write all the levels of a waveform as one array
+ *
+ * Each level is the sum of the harmonics of the waveform up to the level's limit, scaled by the
+ * same factor as all the other levels (see wavecalc_scale()).
+*/
+static void gen_wave(int wav)
+{
+	double scale = wavecalc_scale(wav, (double)maxi);
+	int n_levels = wavecalc_levels(wav);
+	int l, j, n = 0;
+
+	printf("static const wave_sample_t wave_%s[%s] =\n{", wave_name[wav - SAW],
+			(n_levels == 1) ? "WAVE_LEN + 1" : "WAVE_TOTAL_SAMPLES");
+
+	for ( l = 0; l < n_levels; l++ )
+	{
+		int len = 1 << wavecalc_level_bits(l);
+		int n_harm = wavecalc_n_harm(wav, l);
+
+		if ( n_levels == 1 )
+			printf("\n\t/* All levels: %d samples */\n", len);
+		else
+			printf("\n\t/* Level %d: %d samples, %d harmonics */\n", l, len, n_harm);
+
+		/* The cycle, then the guard sample
+		*/
+		for ( j = 0; j <= len; j++ )
+		{
+			printf("%s%d,", ((j % 8) == 0) ? "\t" : " ", table_sample(wav, j, len, n_harm, scale));
+			if ( (j % 8) == 7 || j == len )
+				printf("\n");
+		}
+		n += len + 1;
+	}
+
+	printf("};\n\n");
+
+	if ( n_levels > 1 && n != WAVE_TOTAL_SAMPLES )
+	{
+		fprintf(stderr, "wave-gen: %d samples, but WAVE_TOTAL_SAMPLES is %d\n", n, WAVE_TOTAL_SAMPLES);
+		exit(1);
+	}
+}
+
+/* gen_wavetable() - write the levels of a waveform as an element of wavetables[]
+*/
+static void gen_wavetable(int wav)
+{
+	int shared = (wavecalc_levels(wav) == 1);
+	int l, j = 0;
+
+	printf("\t{\t/* %s */\n\t\t{", wave_name[wav - SAW]);
+	for ( l = 0; l < WAVE_N_LEVELS; l++ )
+	{
+		printf("%s&wave_%s[%d]", (l == 0) ? "\t" : ((l % 4) == 0) ? ",\n\t\t\t" : ", ",
+				wave_name[wav - SAW], j);
+		if ( !shared )
+			j += (1 << wavecalc_level_bits(l)) + 1;
+	}
+	printf("\t},\n\t\t{");
+	for ( l = 0; l < WAVE_N_LEVELS; l++ )
+		printf("%s%d", (l == 0) ? "\t" : ", ", 32 - (shared ? WAVE_BITS : wavecalc_level_bits(l)));
+	printf("\t}\n\t}%s\n", (wav == SAW + WAVE_N_TYPES - 1) ? "" : ",");
+}
+
+/* gen_incr() - write the phase increments of the 128 midi notes
+ *
+ * Midi note 0 is C @ 8.175 Hz (i.e. the C of the root table, index 3). Each octave doubles the
+ * frequency of the root. The increment is rounded to the nearest step of the 32-bit phase,
+ * which is a pitch error of about a thousandth of a cent at the lowest note and less above it.
+*/
+static void gen_incr(void)
+{
+	int n;
+
+	printf("const dv_u32_t wave_incr[WAVE_N_NOTES] =\n{");
+	for ( n = 0; n < WAVE_N_NOTES; n++ )
+	{
+		double f = wave_root_f[(n+3)%12] * (double)(1 << ((n+3)/12));
+		dv_u32_t incr = (dv_u32_t)(f * 4294967296.0 / SAMPLES_PER_SEC + 0.5);
+
+		printf("%s%uu,", ((n % 8) == 0) ? "\t" : " ", incr);
+		if ( (n % 8) == 7 )
+			printf("\n");
+	}
+	printf("};\n");
+}
+
+int main(int argc, char **argv)
+{
+	int wav;
+
+	printf("/*\twave-tables.c - wave tables for SynthEffect\n *\n");
+	printf(" *\tGenerated by wave-gen (host/c/wave-gen.c). Do not edit.\n*/\n");
+	printf("#include <dv-config.h>\n#include <davroska.h>\n#include <wave.h>\n\n");
+
+	for ( wav = SAW; wav < SAW + WAVE_N_TYPES; wav++ )
+		gen_wave(wav);
+
+	printf("const struct wavetable_s wavetables[WAVE_N_TYPES] =\n{\n");
+	for ( wav = SAW; wav < SAW + WAVE_N_TYPES; wav++ )
+		gen_wavetable(wav);
+	printf("};\n\n");
+
+	gen_incr();
+
+	return 0;
+}
@@ -0,0 +1,173 @@
+/*	xrun-sim.c - host simulation of missed audio deadlines, to check the xrun detector
+ *
+ *	Copyright 2026 David Haworth
+ *
+ *	This file is part of SynthEffect.
+ *
+ *	SynthEffect is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	SynthEffect is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with SynthEffect.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <dv-config.h>
+#include <davroska.h>
+#include <synth-config.h>
+#include <notequeue.h>
+#include <wave.h>
+#include <effect.h>
+#include <effect-synth.h>
+#include <effect-dac.h>
+#include <monitor.h>
+#include <dv-arm-bcm2835-pcm.h>
+#include <host.h>
+
+/* Usage: xrun-sim
+ *
+ * Builds a synth+slow+dac chain and runs it against a simulated PCM FIFO that empties in real
+ * time (host_pcm_paced). Everything runs on the virtual clock (host_frc_fixed), so the results
+ * don't depend on the load of the host: the stages take no time, the writes to a full FIFO advance
+ * the clock, and the "slow" stage advances the clock by a given amount on selected blocks, either
+ * while processing or during the writes of the block (as an interrupt would).
+ * Each scenario compares the counters in dac_xrun with the expected no. of missed deadlines
+ * and xruns, and with the no. of underruns seen by the simulated FIFO.
+ *
+ * Exits with 1 if any scenario fails.
+*/
+#define BUDGET	(EFFECT_BLOCK_LEN * MONITOR_TICKS_PER_SAMPLE)
+
+struct slow_s
+{
+	dv_u32_t delay;		/* Time to waste (FRC ticks) */
+	int every;			/* Waste time on every nth block; 0 ==> never */
+	int count;
+	int in_write;		/* Waste the time during the writes instead of processing */
+};
+
+struct slow_s slow;
+struct effect_s sim_stage[3];
+
+static dv_i64_t slow_passthru(struct effect_s *e, dv_i64_t signal)
+{
+	return signal;
+}
+
+/* slow_frame() - an effect stage that does nothing but take its time
+*/
+static void slow_frame(struct effect_s *e, struct effect_block_s *b, int n)
+{
+	struct slow_s *sl = e->control;
+
+	if ( sl->every > 0 && ++sl->count >= sl->every )
+	{
+		sl->count = 0;
+		if ( sl->in_write )
+			host_pcm_stall = sl->delay;
+		else
+			host_frc += sl->delay;
+	}
+}
+
+/* run() - run a scenario and check the results
+ *
+ * The detector's counts must be exactly as expected, and its xrun count must agree with the
+ * simulated FIFO's underrun count.
+*/
+static int run(char *name, int nblk, dv_u32_t delay, int every, int in_write, dv_u32_t missed, dv_u32_t xruns)
+{
+	static struct effect_block_s buf;
+	struct slow_s *sl = sim_stage[1].control;
+	dv_u32_t missed0 = dac_xrun.missed;
+	dv_u32_t xruns0 = dac_xrun.xruns;
+	dv_u32_t under0 = host_pcm_underruns;
+	dv_u32_t n_missed, n_xruns, n_under;
+	int ok;
+
+	sl->delay = delay;
+	sl->every = every;
+	sl->count = 0;
+	sl->in_write = in_write;
+
+	for ( int i = 0; i < nblk; i++ )
+		effect_process_block(EFFECT_FIRST_CORE, &buf, EFFECT_BLOCK_LEN);
+
+	/* A few normal blocks to let the FIFO catch up again.
+	*/
+	sl->every = 0;
+	for ( int i = 0; i < 50; i++ )
+		effect_process_block(EFFECT_FIRST_CORE, &buf, EFFECT_BLOCK_LEN);
+
+	n_missed = dac_xrun.missed - missed0;
+	n_xruns = dac_xrun.xruns - xruns0;
+	n_under = host_pcm_underruns - under0;
+
+	ok = (n_missed == missed) && (n_xruns == xruns) && (n_under == n_xruns);
+
+	printf("%-17s : missed = %3u (expected %3u), xruns = %3u (expected %3u), fifo underruns = %3u : %s\n",
+				name, n_missed, missed, n_xruns, xruns, n_under, ok ? "ok" : "FAIL");
+
+	return ok ? 0 : 1;
+}
+
+int main(int argc, char **argv)
+{
+	int fail = 0;
+
+	notechannels_init();
+	effect_init();
+	effect_synth_init(&sim_stage[0]);
+	effect_append(&sim_stage[0]);
+
+	sim_stage[1].func = &slow_passthru;
+	sim_stage[1].blockfunc = DV_NULL;
+	sim_stage[1].framefunc = &slow_frame;
+	sim_stage[1].control = &slow;
+	sim_stage[1].control_size = sizeof(slow);
+	sim_stage[1].name = "slow";
+	effect_append(&sim_stage[1]);
+
+	effect_dac_init(&sim_stage[2]);
+	effect_append(&sim_stage[2]);
+	if ( effect_compile() != 0 )
+		panic("effect_compile", "Oops! compile failed");
+
+	for ( int i = 0; i < 10; i++ )
+		send_note(0, NOTE_START | (100 << 8) | (48 + i * 3));
+
+	/* Stuff the FIFO, as run_core1() does on the Pi.
+	*/
+	host_frc_fixed = 1;
+	host_frc = 0;
+	host_pcm_paced = 1;
+	for ( int i = 0; i < 63; i++ )
+		dv_pcm_write(0);
+
+	printf("Block budget = %u ticks, FIFO = %u frames\n", BUDGET, MONITOR_FIFO_FRAMES);
+
+	/* The FIFO holds one block, so any block that overruns its budget causes an underrun.
+	*/
+	fail += run("normal", 500, 0, 0, 0, 0, 0);
+	fail += run("one block 0.8x", 100, BUDGET*4/5, 100, 0, 0, 0);
+	fail += run("one block 1.5x", 100, BUDGET*3/2, 100, 0, 1, 1);
+	fail += run("one block 3x", 100, BUDGET*3, 100, 0, 1, 1);
+	fail += run("sustained 1.5x", 60, BUDGET*3/2, 1, 0, 60, 60);
+
+	/* A stall during the writes of a block: the block was ready in time, but the FIFO runs dry
+	 * if the stall is longer than the FIFO's contents.
+	*/
+	fail += run("write stall 0.5x", 100, BUDGET/2, 100, 1, 0, 0);
+	fail += run("write stall 1.5x", 100, BUDGET*3/2, 100, 1, 0, 1);
+	fail += run("write stalls 1.5x", 60, BUDGET*3/2, 2, 1, 0, 30);
+
+	return fail ? 1 : 0;
+}
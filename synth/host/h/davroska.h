@@ -0,0 +1,64 @@
+/*	davroska.h - host stand-in for the davroska kernel header
+ *
+ *	Copyright 2026 David Haworth
+ *
+ *	This file is part of SynthEffect.
+ *
+ *	SynthEffect is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	SynthEffect is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with SynthEffect.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef DAVROSKA_H
+#define DAVROSKA_H	1
+
+/* This header replaces davroska.h when the synth sources are compiled for a Linux host
+ * (see "make host"). It provides just enough of the davroska types and functions for
+ * the DSP code to compile unchanged. There is only one "core" on the host; it pretends
+ * to be core 1, which is where the effect processor normally runs.
+*/
+#include <stdint.h>
+
+typedef int8_t				dv_i8_t;
+typedef uint8_t				dv_u8_t;
+typedef int16_t				dv_i16_t;
+typedef uint16_t			dv_u16_t;
+typedef int32_t				dv_i32_t;
+typedef uint32_t			dv_u32_t;
+typedef int64_t				dv_i64_t;
+typedef uint64_t			dv_u64_t;
+typedef uintptr_t			dv_address_t;
+typedef dv_u32_t			dv_boolean_t;
+typedef dv_u32_t			dv_intstatus_t;
+
+#define DV_NULL				0
+
+static inline void dv_barrier(void)
+{
+	__sync_synchronize();
+}
+
+static inline dv_intstatus_t dv_disable(void)
+{
+	return 0;
+}
+
+static inline void dv_restore(dv_intstatus_t is)
+{
+	(void)is;
+}
+
+static inline int dv_get_coreidx(void)
+{
+	return 1;
+}
+
+#endif
@@ -0,0 +1,30 @@
+/*	dv-arm-bcm2835-armtimer.h - host stand-in for the bcm2835 ARM timer
+ *
+ *	Copyright 2026 David Haworth
+ *
+ *	This file is part of SynthEffect.
+ *
+ *	SynthEffect is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	SynthEffect is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with SynthEffect.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef DV_ARM_BCM2835_ARMTIMER_H
+#define DV_ARM_BCM2835_ARMTIMER_H	1
+
+#include <davroska.h>
+
+/* The free-running counter on the Pi runs at 250 MHz (prescaler 1). The host version
+ * returns the monotonic clock scaled to the same rate so that monitor values are comparable.
+*/
+extern dv_u32_t dv_arm_bcm2835_armtimer_read_frc(void);
+
+#endif
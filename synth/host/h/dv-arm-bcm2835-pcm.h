@@ -0,0 +1,31 @@
+/*	dv-arm-bcm2835-pcm.h - host stand-in for the bcm2835 PCM/I2S interface
+ *
+ *	Copyright 2026 David Haworth
+ *
+ *	This file is part of SynthEffect.
+ *
+ *	SynthEffect is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	SynthEffect is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with SynthEffect.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef DV_ARM_BCM2835_PCM_H
+#define DV_ARM_BCM2835_PCM_H	1
+
+#include <davroska.h>
+
+/* On the host the PCM "hardware" never blocks. Samples written are passed to the host's
+ * output sink (if any); samples read are always zero.
+*/
+extern void dv_pcm_write(dv_i32_t val);
+extern void dv_pcm_read(dv_i32_t *val);
+
+#endif
@@ -0,0 +1,26 @@
+/*	dv-arm-bcm2835-systimer.h - host stand-in for the bcm2835 system timer
+ *
+ *	Copyright 2026 David Haworth
+ *
+ *	This file is part of SynthEffect.
+ *
+ *	SynthEffect is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	SynthEffect is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with SynthEffect.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef DV_ARM_BCM2835_SYSTIMER_H
+#define DV_ARM_BCM2835_SYSTIMER_H	1
+
+/* Nothing from the system timer is used by the code that's built for the host.
+*/
+
+#endif
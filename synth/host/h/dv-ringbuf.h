@@ -0,0 +1,51 @@
+/*	dv-ringbuf.h - host stand-in for the davroska ring buffer management header
+ *
+ *	Copyright 2026 David Haworth
+ *
+ *	This file is part of SynthEffect.
+ *
+ *	SynthEffect is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	SynthEffect is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with SynthEffect.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef DV_RINGBUF_H
+#define DV_RINGBUF_H	1
+
+#include <davroska.h>
+
+/* Ring buffer management: the buffer itself is held by the user; this structure holds
+ * the indexes. The buffer is empty when head == tail, so one slot is always unused.
+*/
+typedef struct dv_rbm_s
+{
+	volatile dv_i32_t head;
+	volatile dv_i32_t tail;
+	dv_i32_t length;
+} dv_rbm_t;
+
+static inline dv_i32_t dv_rb_add1(dv_rbm_t *rbm, dv_i32_t i)
+{
+	i++;
+	return (i >= rbm->length) ? 0 : i;
+}
+
+static inline dv_boolean_t dv_rb_empty(dv_rbm_t *rbm)
+{
+	return rbm->head == rbm->tail;
+}
+
+static inline dv_boolean_t dv_rb_full(dv_rbm_t *rbm)
+{
+	return dv_rb_add1(rbm, rbm->tail) == rbm->head;
+}
+
+#endif
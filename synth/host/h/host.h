@@ -0,0 +1,61 @@
+/*	host.h - host-only declarations for running SynthEffect code on Linux
+ *
+ *	Copyright 2026 David Haworth
+ *
+ *	This file is part of SynthEffect.
+ *
+ *	SynthEffect is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	SynthEffect is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with SynthEffect.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef HOST_H
+#define HOST_H	1
+
+#include <davroska.h>
+
+/* Samples written with dv_pcm_write() are passed to host_pcm_sink if it is not DV_NULL.
+*/
+extern void (*host_pcm_sink)(dv_i32_t val);
+
+/* If host_pcm_paced is non-zero, dv_pcm_write() behaves like the Pi's PCM transmitter: the words
+ * go into a FIFO of HOST_PCM_FIFO_LEN words that is emptied in real time at SAMPLES_PER_SEC stereo
+ * frames per second. A write to a full FIFO waits. Each time the FIFO runs dry host_pcm_underruns
+ * is incremented.
+ *
+ * With host_frc_fixed the FIFO runs on the virtual clock (host_frc) instead of the real one, and a
+ * write to a full FIFO advances host_frc to the time at which there's space. That makes a
+ * simulation deterministic. host_pcm_stall (ticks) delays the next write by that amount, as an
+ * interrupt would on the Pi, and is cleared.
+*/
+#define HOST_PCM_FIFO_LEN	64
+
+extern int host_pcm_paced;
+extern dv_u32_t host_pcm_underruns;
+extern dv_u32_t host_pcm_stall;
+
+/* If host_frc_fixed is non-zero, the free-running counter reads host_frc instead of the clock.
+ * An offline renderer uses it to run the synth on a virtual clock that advances a sample at a time.
+*/
+extern int host_frc_fixed;
+extern dv_u32_t host_frc;
+
+/* host_ns() - the monotonic clock in nanoseconds
+*/
+extern dv_u64_t host_ns(void);
+
+/* host_cycles() - a cycle counter for benchmarking.
+ *
+ * On x86 this is the time-stamp counter; elsewhere it's the monotonic clock in nanoseconds.
+*/
+extern dv_u64_t host_cycles(void);
+
+#endif
@@ -0,0 +1,35 @@
+/*	wave-calc.h - the band-limited waveforms that the wave tables are made from
+ *
+ *	Copyright 2026 David Haworth
+ *
+ *	This file is part of SynthEffect.
+ *
+ *	SynthEffect is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	SynthEffect is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with SynthEffect.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef WAVE_CALC_H
+#define WAVE_CALC_H	1
+
+/* The waveforms of the wave tables (see wave.h), computed in floating point. wave-gen uses them
+ * to generate the tables; kernel-check uses them to measure the error of the tables.
+ * Link with -lm.
+*/
+extern int wavecalc_level_bits(int l);
+extern int wavecalc_level_n_harm(int l, int len);
+extern int wavecalc_levels(int wav);
+extern int wavecalc_n_harm(int wav, int l);
+extern double wavecalc_value(int wav, int j, int len, int n_harm);
+extern double wavecalc_value_at(int wav, double pos, int len, int n_harm);
+extern double wavecalc_scale(int wav, double maxi);
+
+#endif
@@ -0,0 +1,3313 @@
+/*	wave-tables.c - wave tables for SynthEffect
+ *
+ *	Generated by wave-gen (host/c/wave-gen.c). Do not edit.
+*/
+#include <dv-config.h>
+#include <davroska.h>
+#include <wave.h>
+
+static const wave_sample_t wave_saw[WAVE_TOTAL_SAMPLES] =
+{
+	/* Level 0: 2048 samples, 1023 harmonics */
+	0, -32767, -25058, -29575, -26315, -28798, -26718, -28428,
+	-26896, -28196, -26982, -28028, -27021, -27896, -27033, -27784,
+	-27029, -27685, -27014, -27596, -26991, -27513, -26962, -27436,
+	-26929, -27362, -26893, -27291, -26854, -27222, -26813, -27155,
+	-26771, -27090, -26727, -27026, -26681, -26963, -26635, -26901,
+	-26588, -26839, -26541, -26779, -26493, -26718, -26444, -26659,
+	-26395, -26599, -26345, -26541, -26295, -26482, -26245, -26424,
+	-26194, -26366, -26143, -26308, -26092, -26251, -26041, -26194,
+	-25989, -26136, -25938, -26080, -25886, -26023, -25834, -25966,
+	-25782, -25910, -25730, -25853, -25677, -25797, -25625, -25741,
+	-25573, -25685, -25520, -25629, -25467, -25573, -25414, -25517,
+	-25362, -25461, -25309, -25405, -25256, -25350, -25203, -25294,
+	-25150, -25239, -25097, -25183, -25043, -25128, -24990, -25072,
+	-24937, -25017, -24884, -24961, -24830, -24906, -24777, -24851,
+	-24724, -24796, -24670, -24740, -24617, -24685, -24563, -24630,
+	-24510, -24575, -24456, -24520, -24403, -24465, -24349, -24410,
+	-24295, -24355, -24242, -24300, -24188, -24245, -24134, -24190,
+	-24081, -24135, -24027, -24080, -23973, -24025, -23919, -23970,
+	-23866, -23915, -23812, -23860, -23758, -23805, -23704, -23751,
+	-23650, -23696, -23597, -23641, -23543, -23586, -23489, -23531,
+	-23435, -23477, -23381, -23422, -23327, -23367, -23273, -23312,
+	-23219, -23258, -23165, -23203, -23112, -23148, -23058, -23093,
+	-23004, -23039, -22950, -22984, -22896, -22929, -22842, -22875,
+	-22788, -22820, -22734, -22765, -22680, -22711, -22626, -22656,
+	-22572, -22601, -22518, -22547, -22464, -22492, -22410, -22438,
+	-22356, -22383, -22302, -22328, -22248, -22274, -22194, -22219,
+	-22139, -22165, -22085, -22110, -22031, -22055, -21977, -22001,
+	-21923, -21946, -21869, -21892, -21815, -21837, -21761, -21782,
+	-21707, -21728, -21653, -21673, -21599, -21619, -21545, -21564,
+	-21490, -21510, -21436, -21455, -21382, -21401, -21328, -21346,
+	-21274, -21292, -21220, -21237, -21166, -21183, -21112, -21128,
+	-21057, -21073, -21003, -21019, -20949, -20964, -20895, -20910,
+	-20841, -20855, -20787, -20801, -20733, -20746, -20678, -20692,
+	-20624, -20637, -20570, -20583, -20516, -20528, -20462, -20474,
+	-20408, -20419, -20353, -20365, -20299, -20310, -20245, -20256,
+	-20191, -20201, -20137, -20147, -20083, -20093, -20028, -20038,
+	-19974, -19984, -19920, -19929, -19866, -19875, -19812, -19820,
+	-19758, -19766, -19703, -19711, -19649, -19657, -19595, -19602,
+	-19541, -19548, -19487, -19493, -19432, -19439, -19378, -19385,
+	-19324, -19330, -19270, -19276, -19216, -19221, -19161, -19167,
+	-19107, -19112, -19053, -19058, -18999, -19003, -18944, -18949,
+	-18890, -18894, -18836, -18840, -18782, -18786, -18728, -18731,
+	-18673, -18677, -18619, -18622, -18565, -18568, -18511, -18513,
+	-18457, -18459, -18402, -18405, -18348, -18350, -18294, -18296,
+	-18240, -18241, -18185, -18187, -18131, -18132, -18077, -18078,
+	-18023, -18024, -17968, -17969, -17914, -17915, -17860, -17860,
+	-17806, -17806, -17752, -17751, -17697, -17697, -17643, -17643,
+	-17589, -17588, -17535, -17534, -17480, -17479, -17426, -17425,
+	-17372, -17371, -17318, -17316, -17263, -17262, -17209, -17207,
+	-17155, -17153, -17101, -17099, -17046, -17044, -16992, -16990,
+	-16938, -16935, -16884, -16881, -16829, -16826, -16775, -16772,
+	-16721, -16718, -16667, -16663, -16612, -16609, -16558, -16554,
+	-16504, -16500, -16450, -16446, -16395, -16391, -16341, -16337,
+	-16287, -16282, -16233, -16228, -16178, -16174, -16124, -16119,
+	-16070, -16065, -16016, -16010, -15961, -15956, -15907, -15902,
+	-15853, -15847, -15799, -15793, -15744, -15738, -15690, -15684,
+	-15636, -15630, -15582, -15575, -15527, -15521, -15473, -15467,
+	-15419, -15412, -15364, -15358, -15310, -15303, -15256, -15249,
+	-15202, -15195, -15147, -15140, -15093, -15086, -15039, -15031,
+	-14985, -14977, -14930, -14923, -14876, -14868, -14822, -14814,
+	-14768, -14759, -14713, -14705, -14659, -14651, -14605, -14596,
+	-14550, -14542, -14496, -14488, -14442, -14433, -14388, -14379,
+	-14333, -14324, -14279, -14270, -14225, -14216, -14171, -14161,
+	-14116, -14107, -14062, -14052, -14008, -13998, -13953, -13944,
+	-13899, -13889, -13845, -13835, -13791, -13781, -13736, -13726,
+	-13682, -13672, -13628, -13617, -13574, -13563, -13519, -13509,
+	-13465, -13454, -13411, -13400, -13356, -13346, -13302, -13291,
+	-13248, -13237, -13194, -13182, -13139, -13128, -13085, -13074,
+	-13031, -13019, -12977, -12965, -12922, -12911, -12868, -12856,
+	-12814, -12802, -12759, -12747, -12705, -12693, -12651, -12639,
+	-12597, -12584, -12542, -12530, -12488, -12476, -12434, -12421,
+	-12379, -12367, -12325, -12312, -12271, -12258, -12217, -12204,
+	-12162, -12149, -12108, -12095, -12054, -12041, -11999, -11986,
+	-11945, -11932, -11891, -11877, -11837, -11823, -11782, -11769,
+	-11728, -11714, -11674, -11660, -11619, -11606, -11565, -11551,
+	-11511, -11497, -11457, -11442, -11402, -11388, -11348, -11334,
+	-11294, -11279, -11239, -11225, -11185, -11171, -11131, -11116,
+	-11077, -11062, -11022, -11008, -10968, -10953, -10914, -10899,
+	-10859, -10844, -10805, -10790, -10751, -10736, -10697, -10681,
+	-10642, -10627, -10588, -10573, -10534, -10518, -10479, -10464,
+	-10425, -10409, -10371, -10355, -10317, -10301, -10262, -10246,
+	-10208, -10192, -10154, -10138, -10099, -10083, -10045, -10029,
+	-9991, -9975, -9937, -9920, -9882, -9866, -9828, -9811,
+	-9774, -9757, -9719, -9703, -9665, -9648, -9611, -9594,
+	-9556, -9540, -9502, -9485, -9448, -9431, -9394, -9377,
+	-9339, -9322, -9285, -9268, -9231, -9213, -9176, -9159,
+	-9122, -9105, -9068, -9050, -9014, -8996, -8959, -8942,
+	-8905, -8887, -8851, -8833, -8796, -8779, -8742, -8724,
+	-8688, -8670, -8633, -8615, -8579, -8561, -8525, -8507,
+	-8471, -8452, -8416, -8398, -8362, -8344, -8308, -8289,
+	-8253, -8235, -8199, -8181, -8145, -8126, -8091, -8072,
+	-8036, -8018, -7982, -7963, -7928, -7909, -7873, -7854,
+	-7819, -7800, -7765, -7746, -7710, -7691, -7656, -7637,
+	-7602, -7583, -7548, -7528, -7493, -7474, -7439, -7420,
+	-7385, -7365, -7330, -7311, -7276, -7256, -7222, -7202,
+	-7168, -7148, -7113, -7093, -7059, -7039, -7005, -6985,
+	-6950, -6930, -6896, -6876, -6842, -6822, -6787, -6767,
+	-6733, -6713, -6679, -6659, -6625, -6604, -6570, -6550,
+	-6516, -6495, -6462, -6441, -6407, -6387, -6353, -6332,
+	-6299, -6278, -6244, -6224, -6190, -6169, -6136, -6115,
+	-6082, -6061, -6027, -6006, -5973, -5952, -5919, -5898,
+	-5864, -5843, -5810, -5789, -5756, -5734, -5702, -5680,
+	-5647, -5626, -5593, -5571, -5539, -5517, -5484, -5463,
+	-5430, -5408, -5376, -5354, -5321, -5300, -5267, -5245,
+	-5213, -5191, -5159, -5137, -5104, -5082, -5050, -5028,
+	-4996, -4973, -4941, -4919, -4887, -4865, -4833, -4810,
+	-4778, -4756, -4724, -4702, -4670, -4647, -4616, -4593,
+	-4561, -4539, -4507, -4484, -4453, -4430, -4398, -4376,
+	-4344, -4321, -4290, -4267, -4235, -4212, -4181, -4158,
+	-4127, -4104, -4073, -4049, -4018, -3995, -3964, -3941,
+	-3910, -3886, -3855, -3832, -3801, -3778, -3747, -3723,
+	-3692, -3669, -3638, -3615, -3584, -3560, -3530, -3506,
+	-3475, -3452, -3421, -3397, -3367, -3343, -3312, -3288,
+	-3258, -3234, -3204, -3180, -3149, -3125, -3095, -3071,
+	-3041, -3017, -2987, -2962, -2932, -2908, -2878, -2854,
+	-2824, -2799, -2769, -2745, -2715, -2691, -2661, -2636,
+	-2606, -2582, -2552, -2527, -2498, -2473, -2444, -2419,
+	-2389, -2364, -2335, -2310, -2281, -2256, -2226, -2201,
+	-2172, -2147, -2118, -2093, -2063, -2038, -2009, -1984,
+	-1955, -1930, -1901, -1875, -1846, -1821, -1792, -1767,
+	-1738, -1712, -1683, -1658, -1629, -1603, -1575, -1549,
+	-1520, -1495, -1466, -1440, -1412, -1386, -1358, -1332,
+	-1303, -1277, -1249, -1223, -1195, -1169, -1140, -1114,
+	-1086, -1060, -1032, -1006, -977, -951, -923, -897,
+	-869, -842, -815, -788, -760, -734, -706, -679,
+	-652, -625, -597, -571, -543, -516, -489, -462,
+	-434, -408, -380, -353, -326, -299, -272, -245,
+	-217, -190, -163, -136, -109, -82, -54, -27,
+	0, 27, 54, 82, 109, 136, 163, 190,
+	217, 245, 272, 299, 326, 353, 380, 408,
+	434, 462, 489, 516, 543, 571, 597, 625,
+	652, 679, 706, 734, 760, 788, 815, 842,
+	869, 897, 923, 951, 977, 1006, 1032, 1060,
+	1086, 1114, 1140, 1169, 1195, 1223, 1249, 1277,
+	1303, 1332, 1358, 1386, 1412, 1440, 1466, 1495,
+	1520, 1549, 1575, 1603, 1629, 1658, 1683, 1712,
+	1738, 1767, 1792, 1821, 1846, 1875, 1901, 1930,
+	1955, 1984, 2009, 2038, 2063, 2093, 2118, 2147,
+	2172, 2201, 2226, 2256, 2281, 2310, 2335, 2364,
+	2389, 2419, 2444, 2473, 2498, 2527, 2552, 2582,
+	2606, 2636, 2661, 2691, 2715, 2745, 2769, 2799,
+	2824, 2854, 2878, 2908, 2932, 2962, 2987, 3017,
+	3041, 3071, 3095, 3125, 3149, 3180, 3204, 3234,
+	3258, 3288, 3312, 3343, 3367, 3397, 3421, 3452,
+	3475, 3506, 3530, 3560, 3584, 3615, 3638, 3669,
+	3692, 3723, 3747, 3778, 3801, 3832, 3855, 3886,
+	3910, 3941, 3964, 3995, 4018, 4049, 4073, 4104,
+	4127, 4158, 4181, 4212, 4235, 4267, 4290, 4321,
+	4344, 4376, 4398, 4430, 4453, 4484, 4507, 4539,
+	4561, 4593, 4616, 4647, 4670, 4702, 4724, 4756,
+	4778, 4810, 4833, 4865, 4887, 4919, 4941, 4973,
+	4996, 5028, 5050, 5082, 5104, 5137, 5159, 5191,
+	5213, 5245, 5267, 5300, 5321, 5354, 5376, 5408,
+	5430, 5463, 5484, 5517, 5539, 5571, 5593, 5626,
+	5647, 5680, 5702, 5734, 5756, 5789, 5810, 5843,
+	5864, 5898, 5919, 5952, 5973, 6006, 6027, 6061,
+	6082, 6115, 6136, 6169, 6190, 6224, 6244, 6278,
+	6299, 6332, 6353, 6387, 6407, 6441, 6462, 6495,
+	6516, 6550, 6570, 6604, 6625, 6659, 6679, 6713,
+	6733, 6767, 6787, 6822, 6842, 6876, 6896, 6930,
+	6950, 6985, 7005, 7039, 7059, 7093, 7113, 7148,
+	7168, 7202, 7222, 7256, 7276, 7311, 7330, 7365,
+	7385, 7420, 7439, 7474, 7493, 7528, 7548, 7583,
+	7602, 7637, 7656, 7691, 7710, 7746, 7765, 7800,
+	7819, 7854, 7873, 7909, 7928, 7963, 7982, 8018,
+	8036, 8072, 8091, 8126, 8145, 8181, 8199, 8235,
+	8253, 8289, 8308, 8344, 8362, 8398, 8416, 8452,
+	8471, 8507, 8525, 8561, 8579, 8615, 8633, 8670,
+	8688, 8724, 8742, 8779, 8796, 8833, 8851, 8887,
+	8905, 8942, 8959, 8996, 9014, 9050, 9068, 9105,
+	9122, 9159, 9176, 9213, 9231, 9268, 9285, 9322,
+	9339, 9377, 9394, 9431, 9448, 9485, 9502, 9540,
+	9556, 9594, 9611, 9648, 9665, 9703, 9719, 9757,
+	9774, 9811, 9828, 9866, 9882, 9920, 9937, 9975,
+	9991, 10029, 10045, 10083, 10099, 10138, 10154, 10192,
+	10208, 10246, 10262, 10301, 10317, 10355, 10371, 10409,
+	10425, 10464, 10479, 10518, 10534, 10573, 10588, 10627,
+	10642, 10681, 10697, 10736, 10751, 10790, 10805, 10844,
+	10859, 10899, 10914, 10953, 10968, 11008, 11022, 11062,
+	11077, 11116, 11131, 11171, 11185, 11225, 11239, 11279,
+	11294, 11334, 11348, 11388, 11402, 11442, 11457, 11497,
+	11511, 11551, 11565, 11606, 11619, 11660, 11674, 11714,
+	11728, 11769, 11782, 11823, 11837, 11877, 11891, 11932,
+	11945, 11986, 11999, 12041, 12054, 12095, 12108, 12149,
+	12162, 12204, 12217, 12258, 12271, 12312, 12325, 12367,
+	12379, 12421, 12434, 12476, 12488, 12530, 12542, 12584,
+	12597, 12639, 12651, 12693, 12705, 12747, 12759, 12802,
+	12814, 12856, 12868, 12911, 12922, 12965, 12977, 13019,
+	13031, 13074, 13085, 13128, 13139, 13182, 13194, 13237,
+	13248, 13291, 13302, 13346, 13356, 13400, 13411, 13454,
+	13465, 13509, 13519, 13563, 13574, 13617, 13628, 13672,
+	13682, 13726, 13736, 13781, 13791, 13835, 13845, 13889,
+	13899, 13944, 13953, 13998, 14008, 14052, 14062, 14107,
+	14116, 14161, 14171, 14216, 14225, 14270, 14279, 14324,
+	14333, 14379, 14388, 14433, 14442, 14488, 14496, 14542,
+	14550, 14596, 14605, 14651, 14659, 14705, 14713, 14759,
+	14768, 14814, 14822, 14868, 14876, 14923, 14930, 14977,
+	14985, 15031, 15039, 15086, 15093, 15140, 15147, 15195,
+	15202, 15249, 15256, 15303, 15310, 15358, 15364, 15412,
+	15419, 15467, 15473, 15521, 15527, 15575, 15582, 15630,
+	15636, 15684, 15690, 15738, 15744, 15793, 15799, 15847,
+	15853, 15902, 15907, 15956, 15961, 16010, 16016, 16065,
+	16070, 16119, 16124, 16174, 16178, 16228, 16233, 16282,
+	16287, 16337, 16341, 16391, 16395, 16446, 16450, 16500,
+	16504, 16554, 16558, 16609, 16612, 16663, 16667, 16718,
+	16721, 16772, 16775, 16826, 16829, 16881, 16884, 16935,
+	16938, 16990, 16992, 17044, 17046, 17099, 17101, 17153,
+	17155, 17207, 17209, 17262, 17263, 17316, 17318, 17371,
+	17372, 17425, 17426, 17479, 17480, 17534, 17535, 17588,
+	17589, 17643, 17643, 17697, 17697, 17751, 17752, 17806,
+	17806, 17860, 17860, 17915, 17914, 17969, 17968, 18024,
+	18023, 18078, 18077, 18132, 18131, 18187, 18185, 18241,
+	18240, 18296, 18294, 18350, 18348, 18405, 18402, 18459,
+	18457, 18513, 18511, 18568, 18565, 18622, 18619, 18677,
+	18673, 18731, 18728, 18786, 18782, 18840, 18836, 18894,
+	18890, 18949, 18944, 19003, 18999, 19058, 19053, 19112,
+	19107, 19167, 19161, 19221, 19216, 19276, 19270, 19330,
+	19324, 19385, 19378, 19439, 19432, 19493, 19487, 19548,
+	19541, 19602, 19595, 19657, 19649, 19711, 19703, 19766,
+	19758, 19820, 19812, 19875, 19866, 19929, 19920, 19984,
+	19974, 20038, 20028, 20093, 20083, 20147, 20137, 20201,
+	20191, 20256, 20245, 20310, 20299, 20365, 20353, 20419,
+	20408, 20474, 20462, 20528, 20516, 20583, 20570, 20637,
+	20624, 20692, 20678, 20746, 20733, 20801, 20787, 20855,
+	20841, 20910, 20895, 20964, 20949, 21019, 21003, 21073,
+	21057, 21128, 21112, 21183, 21166, 21237, 21220, 21292,
+	21274, 21346, 21328, 21401, 21382, 21455, 21436, 21510,
+	21490, 21564, 21545, 21619, 21599, 21673, 21653, 21728,
+	21707, 21782, 21761, 21837, 21815, 21892, 21869, 21946,
+	21923, 22001, 21977, 22055, 22031, 22110, 22085, 22165,
+	22139, 22219, 22194, 22274, 22248, 22328, 22302, 22383,
+	22356, 22438, 22410, 22492, 22464, 22547, 22518, 22601,
+	22572, 22656, 22626, 22711, 22680, 22765, 22734, 22820,
+	22788, 22875, 22842, 22929, 22896, 22984, 22950, 23039,
+	23004, 23093, 23058, 23148, 23112, 23203, 23165, 23258,
+	23219, 23312, 23273, 23367, 23327, 23422, 23381, 23477,
+	23435, 23531, 23489, 23586, 23543, 23641, 23597, 23696,
+	23650, 23751, 23704, 23805, 23758, 23860, 23812, 23915,
+	23866, 23970, 23919, 24025, 23973, 24080, 24027, 24135,
+	24081, 24190, 24134, 24245, 24188, 24300, 24242, 24355,
+	24295, 24410, 24349, 24465, 24403, 24520, 24456, 24575,
+	24510, 24630, 24563, 24685, 24617, 24740, 24670, 24796,
+	24724, 24851, 24777, 24906, 24830, 24961, 24884, 25017,
+	24937, 25072, 24990, 25128, 25043, 25183, 25097, 25239,
+	25150, 25294, 25203, 25350, 25256, 25405, 25309, 25461,
+	25362, 25517, 25414, 25573, 25467, 25629, 25520, 25685,
+	25573, 25741, 25625, 25797, 25677, 25853, 25730, 25910,
+	25782, 25966, 25834, 26023, 25886, 26080, 25938, 26136,
+	25989, 26194, 26041, 26251, 26092, 26308, 26143, 26366,
+	26194, 26424, 26245, 26482, 26295, 26541, 26345, 26599,
+	26395, 26659, 26444, 26718, 26493, 26779, 26541, 26839,
+	26588, 26901, 26635, 26963, 26681, 27026, 26727, 27090,
+	26771, 27155, 26813, 27222, 26854, 27291, 26893, 27362,
+	26929, 27436, 26962, 27513, 26991, 27596, 27014, 27685,
+	27029, 27784, 27033, 27896, 27021, 28028, 26982, 28196,
+	26896, 28428, 26718, 28798, 26315, 29575, 25058, 32767,
+	0,
+
+	/* Level 1: 2048 samples, 512 harmonics */
+	0, -24264, -32740, -28382, -25004, -27432, -29494, -27748,
+	-26206, -27502, -28663, -27558, -26556, -27438, -28237, -27423,
+	-26679, -27347, -27951, -27302, -26710, -27246, -27729, -27187,
+	-26695, -27142, -27542, -27075, -26653, -27037, -27376, -26964,
+	-26595, -26930, -27223, -26854, -26525, -26823, -27080, -26744,
+	-26448, -26715, -26943, -26634, -26365, -26607, -26811, -26525,
+	-26278, -26499, -26682, -26416, -26187, -26391, -26557, -26307,
+	-26094, -26282, -26434, -26198, -25999, -26174, -26313, -26089,
+	-25902, -26066, -26193, -25980, -25803, -25957, -26075, -25871,
+	-25704, -25849, -25957, -25762, -25604, -25740, -25841, -25654,
+	-25502, -25632, -25725, -25545, -25401, -25523, -25610, -25436,
+	-25298, -25415, -25495, -25327, -25195, -25306, -25381, -25219,
+	-25091, -25197, -25268, -25110, -24988, -25089, -25155, -25001,
+	-24883, -24980, -25042, -24893, -24779, -24872, -24929, -24784,
+	-24674, -24763, -24817, -24675, -24569, -24654, -24705, -24566,
+	-24463, -24546, -24593, -24458, -24358, -24437, -24481, -24349,
+	-24252, -24328, -24370, -24240, -24146, -24220, -24259, -24132,
+	-24040, -24111, -24148, -24023, -23934, -24003, -24037, -23914,
+	-23827, -23894, -23926, -23806, -23721, -23785, -23815, -23697,
+	-23614, -23677, -23704, -23588, -23507, -23568, -23594, -23480,
+	-23400, -23459, -23483, -23371, -23294, -23351, -23373, -23262,
+	-23187, -23242, -23263, -23154, -23080, -23133, -23152, -23045,
+	-22972, -23025, -23042, -22936, -22865, -22916, -22932, -22828,
+	-22758, -22807, -22822, -22719, -22651, -22699, -22712, -22610,
+	-22543, -22590, -22602, -22502, -22436, -22482, -22492, -22393,
+	-22328, -22373, -22383, -22284, -22221, -22264, -22273, -22176,
+	-22113, -22156, -22163, -22067, -22006, -22047, -22053, -21958,
+	-21898, -21938, -21944, -21850, -21790, -21830, -21834, -21741,
+	-21683, -21721, -21725, -21632, -21575, -21612, -21615, -21524,
+	-21467, -21504, -21505, -21415, -21359, -21395, -21396, -21306,
+	-21252, -21286, -21287, -21198, -21144, -21178, -21177, -21089,
+	-21036, -21069, -21068, -20980, -20928, -20960, -20958, -20872,
+	-20820, -20852, -20849, -20763, -20712, -20743, -20739, -20654,
+	-20604, -20634, -20630, -20546, -20496, -20526, -20521, -20437,
+	-20388, -20417, -20412, -20328, -20280, -20309, -20302, -20220,
+	-20172, -20200, -20193, -20111, -20064, -20091, -20084, -20003,
+	-19956, -19983, -19974, -19894, -19848, -19874, -19865, -19785,
+	-19740, -19765, -19756, -19677, -19632, -19657, -19647, -19568,
+	-19524, -19548, -19538, -19459, -19415, -19439, -19429, -19351,
+	-19307, -19331, -19319, -19242, -19199, -19222, -19210, -19133,
+	-19091, -19113, -19101, -19025, -18983, -19005, -18992, -18916,
+	-18875, -18896, -18883, -18807, -18766, -18787, -18774, -18699,
+	-18658, -18679, -18665, -18590, -18550, -18570, -18556, -18481,
+	-18442, -18461, -18447, -18373, -18333, -18353, -18337, -18264,
+	-18225, -18244, -18228, -18155, -18117, -18135, -18119, -18047,
+	-18009, -18027, -18010, -17938, -17900, -17918, -17901, -17829,
+	-17792, -17810, -17792, -17721, -17684, -17701, -17683, -17612,
+	-17576, -17592, -17574, -17503, -17467, -17484, -17465, -17395,
+	-17359, -17375, -17356, -17286, -17251, -17266, -17247, -17177,
+	-17142, -17158, -17138, -17069, -17034, -17049, -17029, -16960,
+	-16926, -16940, -16920, -16851, -16817, -16832, -16811, -16743,
+	-16709, -16723, -16702, -16634, -16601, -16614, -16593, -16526,
+	-16492, -16506, -16484, -16417, -16384, -16397, -16375, -16308,
+	-16276, -16288, -16267, -16200, -16167, -16180, -16158, -16091,
+	-16059, -16071, -16049, -15982, -15950, -15962, -15940, -15874,
+	-15842, -15854, -15831, -15765, -15734, -15745, -15722, -15656,
+	-15625, -15636, -15613, -15548, -15517, -15528, -15504, -15439,
+	-15408, -15419, -15395, -15330, -15300, -15310, -15286, -15222,
+	-15192, -15202, -15177, -15113, -15083, -15093, -15068, -15004,
+	-14975, -14985, -14960, -14896, -14866, -14876, -14851, -14787,
+	-14758, -14767, -14742, -14678, -14650, -14659, -14633, -14570,
+	-14541, -14550, -14524, -14461, -14433, -14441, -14415, -14352,
+	-14324, -14333, -14306, -14244, -14216, -14224, -14197, -14135,
+	-14107, -14115, -14088, -14026, -13999, -14007, -13980, -13918,
+	-13891, -13898, -13871, -13809, -13782, -13789, -13762, -13700,
+	-13674, -13681, -13653, -13592, -13565, -13572, -13544, -13483,
+	-13457, -13463, -13435, -13374, -13348, -13355, -13326, -13266,
+	-13240, -13246, -13218, -13157, -13131, -13137, -13109, -13049,
+	-13023, -13029, -13000, -12940, -12914, -12920, -12891, -12831,
+	-12806, -12811, -12782, -12723, -12698, -12703, -12673, -12614,
+	-12589, -12594, -12564, -12505, -12481, -12485, -12456, -12397,
+	-12372, -12377, -12347, -12288, -12264, -12268, -12238, -12179,
+	-12155, -12159, -12129, -12071, -12047, -12051, -12020, -11962,
+	-11938, -11942, -11911, -11853, -11830, -11834, -11803, -11745,
+	-11721, -11725, -11694, -11636, -11613, -11616, -11585, -11527,
+	-11504, -11508, -11476, -11419, -11396, -11399, -11367, -11310,
+	-11287, -11290, -11259, -11201, -11179, -11182, -11150, -11093,
+	-11070, -11073, -11041, -10984, -10962, -10964, -10932, -10875,
+	-10853, -10856, -10823, -10767, -10745, -10747, -10714, -10658,
+	-10636, -10638, -10606, -10549, -10528, -10530, -10497, -10441,
+	-10419, -10421, -10388, -10332, -10311, -10312, -10279, -10223,
+	-10202, -10204, -10170, -10115, -10094, -10095, -10062, -10006,
+	-9985, -9986, -9953, -9898, -9877, -9878, -9844, -9789,
+	-9768, -9769, -9735, -9680, -9660, -9660, -9626, -9572,
+	-9551, -9552, -9518, -9463, -9443, -9443, -9409, -9354,
+	-9334, -9334, -9300, -9246, -9226, -9226, -9191, -9137,
+	-9117, -9117, -9082, -9028, -9009, -9008, -8974, -8920,
+	-8900, -8900, -8865, -8811, -8792, -8791, -8756, -8702,
+	-8683, -8683, -8647, -8594, -8575, -8574, -8538, -8485,
+	-8466, -8465, -8430, -8376, -8358, -8357, -8321, -8268,
+	-8249, -8248, -8212, -8159, -8141, -8139, -8103, -8050,
+	-8032, -8031, -7995, -7942, -7924, -7922, -7886, -7833,
+	-7815, -7813, -7777, -7724, -7706, -7705, -7668, -7616,
+	-7598, -7596, -7559, -7507, -7489, -7487, -7451, -7398,
+	-7381, -7379, -7342, -7290, -7272, -7270, -7233, -7181,
+	-7164, -7161, -7124, -7072, -7055, -7053, -7015, -6964,
+	-6947, -6944, -6907, -6855, -6838, -6835, -6798, -6747,
+	-6730, -6727, -6689, -6638, -6621, -6618, -6580, -6529,
+	-6513, -6509, -6472, -6421, -6404, -6401, -6363, -6312,
+	-6296, -6292, -6254, -6203, -6187, -6183, -6145, -6095,
+	-6079, -6075, -6036, -5986, -5970, -5966, -5928, -5877,
+	-5861, -5857, -5819, -5769, -5753, -5749, -5710, -5660,
+	-5644, -5640, -5601, -5551, -5536, -5532, -5493, -5443,
+	-5427, -5423, -5384, -5334, -5319, -5314, -5275, -5225,
+	-5210, -5206, -5166, -5117, -5102, -5097, -5058, -5008,
+	-4993, -4988, -4949, -4899, -4885, -4880, -4840, -4791,
+	-4776, -4771, -4731, -4682, -4667, -4662, -4622, -4573,
+	-4559, -4554, -4514, -4465, -4450, -4445, -4405, -4356,
+	-4342, -4336, -4296, -4247, -4233, -4228, -4187, -4139,
+	-4125, -4119, -4079, -4030, -4016, -4010, -3970, -3921,
+	-3908, -3902, -3861, -3813, -3799, -3793, -3752, -3704,
+	-3691, -3684, -3644, -3596, -3582, -3576, -3535, -3487,
+	-3474, -3467, -3426, -3378, -3365, -3358, -3317, -3270,
+	-3256, -3250, -3208, -3161, -3148, -3141, -3100, -3052,
+	-3039, -3032, -2991, -2944, -2931, -2924, -2882, -2835,
+	-2822, -2815, -2773, -2726, -2714, -2706, -2665, -2618,
+	-2605, -2598, -2556, -2509, -2497, -2489, -2447, -2400,
+	-2388, -2381, -2338, -2292, -2280, -2272, -2230, -2183,
+	-2171, -2163, -2121, -2074, -2062, -2055, -2012, -1966,
+	-1954, -1946, -1903, -1857, -1845, -1837, -1795, -1748,
+	-1737, -1729, -1686, -1640, -1628, -1620, -1577, -1531,
+	-1520, -1511, -1468, -1422, -1411, -1403, -1360, -1314,
+	-1303, -1294, -1251, -1205, -1194, -1185, -1142, -1096,
+	-1085, -1077, -1033, -988, -977, -968, -924, -879,
+	-868, -859, -816, -770, -760, -751, -707, -662,
+	-651, -642, -598, -553, -543, -533, -489, -445,
+	-434, -425, -381, -336, -326, -316, -272, -227,
+	-217, -207, -163, -119, -109, -99, -54, -10,
+	0, 10, 54, 99, 109, 119, 163, 207,
+	217, 227, 272, 316, 326, 336, 381, 425,
+	434, 445, 489, 533, 543, 553, 598, 642,
+	651, 662, 707, 751, 760, 770, 816, 859,
+	868, 879, 924, 968, 977, 988, 1033, 1077,
+	1085, 1096, 1142, 1185, 1194, 1205, 1251, 1294,
+	1303, 1314, 1360, 1403, 1411, 1422, 1468, 1511,
+	1520, 1531, 1577, 1620, 1628, 1640, 1686, 1729,
+	1737, 1748, 1795, 1837, 1845, 1857, 1903, 1946,
+	1954, 1966, 2012, 2055, 2062, 2074, 2121, 2163,
+	2171, 2183, 2230, 2272, 2280, 2292, 2338, 2381,
+	2388, 2400, 2447, 2489, 2497, 2509, 2556, 2598,
+	2605, 2618, 2665, 2706, 2714, 2726, 2773, 2815,
+	2822, 2835, 2882, 2924, 2931, 2944, 2991, 3032,
+	3039, 3052, 3100, 3141, 3148, 3161, 3208, 3250,
+	3256, 3270, 3317, 3358, 3365, 3378, 3426, 3467,
+	3474, 3487, 3535, 3576, 3582, 3596, 3644, 3684,
+	3691, 3704, 3752, 3793, 3799, 3813, 3861, 3902,
+	3908, 3921, 3970, 4010, 4016, 4030, 4079, 4119,
+	4125, 4139, 4187, 4228, 4233, 4247, 4296, 4336,
+	4342, 4356, 4405, 4445, 4450, 4465, 4514, 4554,
+	4559, 4573, 4622, 4662, 4667, 4682, 4731, 4771,
+	4776, 4791, 4840, 4880, 4885, 4899, 4949, 4988,
+	4993, 5008, 5058, 5097, 5102, 5117, 5166, 5206,
+	5210, 5225, 5275, 5314, 5319, 5334, 5384, 5423,
+	5427, 5443, 5493, 5532, 5536, 5551, 5601, 5640,
+	5644, 5660, 5710, 5749, 5753, 5769, 5819, 5857,
+	5861, 5877, 5928, 5966, 5970, 5986, 6036, 6075,
+	6079, 6095, 6145, 6183, 6187, 6203, 6254, 6292,
+	6296, 6312, 6363, 6401, 6404, 6421, 6472, 6509,
+	6513, 6529, 6580, 6618, 6621, 6638, 6689, 6727,
+	6730, 6747, 6798, 6835, 6838, 6855, 6907, 6944,
+	6947, 6964, 7015, 7053, 7055, 7072, 7124, 7161,
+	7164, 7181, 7233, 7270, 7272, 7290, 7342, 7379,
+	7381, 7398, 7451, 7487, 7489, 7507, 7559, 7596,
+	7598, 7616, 7668, 7705, 7706, 7724, 7777, 7813,
+	7815, 7833, 7886, 7922, 7924, 7942, 7995, 8031,
+	8032, 8050, 8103, 8139, 8141, 8159, 8212, 8248,
+	8249, 8268, 8321, 8357, 8358, 8376, 8430, 8465,
+	8466, 8485, 8538, 8574, 8575, 8594, 8647, 8683,
+	8683, 8702, 8756, 8791, 8792, 8811, 8865, 8900,
+	8900, 8920, 8974, 9008, 9009, 9028, 9082, 9117,
+	9117, 9137, 9191, 9226, 9226, 9246, 9300, 9334,
+	9334, 9354, 9409, 9443, 9443, 9463, 9518, 9552,
+	9551, 9572, 9626, 9660, 9660, 9680, 9735, 9769,
+	9768, 9789, 9844, 9878, 9877, 9898, 9953, 9986,
+	9985, 10006, 10062, 10095, 10094, 10115, 10170, 10204,
+	10202, 10223, 10279, 10312, 10311, 10332, 10388, 10421,
+	10419, 10441, 10497, 10530, 10528, 10549, 10606, 10638,
+	10636, 10658, 10714, 10747, 10745, 10767, 10823, 10856,
+	10853, 10875, 10932, 10964, 10962, 10984, 11041, 11073,
+	11070, 11093, 11150, 11182, 11179, 11201, 11259, 11290,
+	11287, 11310, 11367, 11399, 11396, 11419, 11476, 11508,
+	11504, 11527, 11585, 11616, 11613, 11636, 11694, 11725,
+	11721, 11745, 11803, 11834, 11830, 11853, 11911, 11942,
+	11938, 11962, 12020, 12051, 12047, 12071, 12129, 12159,
+	12155, 12179, 12238, 12268, 12264, 12288, 12347, 12377,
+	12372, 12397, 12456, 12485, 12481, 12505, 12564, 12594,
+	12589, 12614, 12673, 12703, 12698, 12723, 12782, 12811,
+	12806, 12831, 12891, 12920, 12914, 12940, 13000, 13029,
+	13023, 13049, 13109, 13137, 13131, 13157, 13218, 13246,
+	13240, 13266, 13326, 13355, 13348, 13374, 13435, 13463,
+	13457, 13483, 13544, 13572, 13565, 13592, 13653, 13681,
+	13674, 13700, 13762, 13789, 13782, 13809, 13871, 13898,
+	13891, 13918, 13980, 14007, 13999, 14026, 14088, 14115,
+	14107, 14135, 14197, 14224, 14216, 14244, 14306, 14333,
+	14324, 14352, 14415, 14441, 14433, 14461, 14524, 14550,
+	14541, 14570, 14633, 14659, 14650, 14678, 14742, 14767,
+	14758, 14787, 14851, 14876, 14866, 14896, 14960, 14985,
+	14975, 15004, 15068, 15093, 15083, 15113, 15177, 15202,
+	15192, 15222, 15286, 15310, 15300, 15330, 15395, 15419,
+	15408, 15439, 15504, 15528, 15517, 15548, 15613, 15636,
+	15625, 15656, 15722, 15745, 15734, 15765, 15831, 15854,
+	15842, 15874, 15940, 15962, 15950, 15982, 16049, 16071,
+	16059, 16091, 16158, 16180, 16167, 16200, 16267, 16288,
+	16276, 16308, 16375, 16397, 16384, 16417, 16484, 16506,
+	16492, 16526, 16593, 16614, 16601, 16634, 16702, 16723,
+	16709, 16743, 16811, 16832, 16817, 16851, 16920, 16940,
+	16926, 16960, 17029, 17049, 17034, 17069, 17138, 17158,
+	17142, 17177, 17247, 17266, 17251, 17286, 17356, 17375,
+	17359, 17395, 17465, 17484, 17467, 17503, 17574, 17592,
+	17576, 17612, 17683, 17701, 17684, 17721, 17792, 17810,
+	17792, 17829, 17901, 17918, 17900, 17938, 18010, 18027,
+	18009, 18047, 18119, 18135, 18117, 18155, 18228, 18244,
+	18225, 18264, 18337, 18353, 18333, 18373, 18447, 18461,
+	18442, 18481, 18556, 18570, 18550, 18590, 18665, 18679,
+	18658, 18699, 18774, 18787, 18766, 18807, 18883, 18896,
+	18875, 18916, 18992, 19005, 18983, 19025, 19101, 19113,
+	19091, 19133, 19210, 19222, 19199, 19242, 19319, 19331,
+	19307, 19351, 19429, 19439, 19415, 19459, 19538, 19548,
+	19524, 19568, 19647, 19657, 19632, 19677, 19756, 19765,
+	19740, 19785, 19865, 19874, 19848, 19894, 19974, 19983,
+	19956, 20003, 20084, 20091, 20064, 20111, 20193, 20200,
+	20172, 20220, 20302, 20309, 20280, 20328, 20412, 20417,
+	20388, 20437, 20521, 20526, 20496, 20546, 20630, 20634,
+	20604, 20654, 20739, 20743, 20712, 20763, 20849, 20852,
+	20820, 20872, 20958, 20960, 20928, 20980, 21068, 21069,
+	21036, 21089, 21177, 21178, 21144, 21198, 21287, 21286,
+	21252, 21306, 21396, 21395, 21359, 21415, 21505, 21504,
+	21467, 21524, 21615, 21612, 21575, 21632, 21725, 21721,
+	21683, 21741, 21834, 21830, 21790, 21850, 21944, 21938,
+	21898, 21958, 22053, 22047, 22006, 22067, 22163, 22156,
+	22113, 22176, 22273, 22264, 22221, 22284, 22383, 22373,
+	22328, 22393, 22492, 22482, 22436, 22502, 22602, 22590,
+	22543, 22610, 22712, 22699, 22651, 22719, 22822, 22807,
+	22758, 22828, 22932, 22916, 22865, 22936, 23042, 23025,
+	22972, 23045, 23152, 23133, 23080, 23154, 23263, 23242,
+	23187, 23262, 23373, 23351, 23294, 23371, 23483, 23459,
+	23400, 23480, 23594, 23568, 23507, 23588, 23704, 23677,
+	23614, 23697, 23815, 23785, 23721, 23806, 23926, 23894,
+	23827, 23914, 24037, 24003, 23934, 24023, 24148, 24111,
+	24040, 24132, 24259, 24220, 24146, 24240, 24370, 24328,
+	24252, 24349, 24481, 24437, 24358, 24458, 24593, 24546,
+	24463, 24566, 24705, 24654, 24569, 24675, 24817, 24763,
+	24674, 24784, 24929, 24872, 24779, 24893, 25042, 24980,
+	24883, 25001, 25155, 25089, 24988, 25110, 25268, 25197,
+	25091, 25219, 25381, 25306, 25195, 25327, 25495, 25415,
+	25298, 25436, 25610, 25523, 25401, 25545, 25725, 25632,
+	25502, 25654, 25841, 25740, 25604, 25762, 25957, 25849,
+	25704, 25871, 26075, 25957, 25803, 25980, 26193, 26066,
+	25902, 26089, 26313, 26174, 25999, 26198, 26434, 26282,
+	26094, 26307, 26557, 26391, 26187, 26416, 26682, 26499,
+	26278, 26525, 26811, 26607, 26365, 26634, 26943, 26715,
+	26448, 26744, 27080, 26823, 26525, 26854, 27223, 26930,
+	26595, 26964, 27376, 27037, 26653, 27075, 27542, 27142,
+	26695, 27187, 27729, 27246, 26710, 27302, 27951, 27347,
+	26679, 27423, 28237, 27438, 26556, 27558, 28663, 27502,
+	26206, 27748, 29494, 27432, 25004, 28382, 32740, 24264,
+	0,
+
+	/* Level 2: 1024 samples, 256 harmonics */
+	0, -24254, -32685, -28284, -24896, -27314, -29331, -27541,
+	-25989, -27275, -28391, -27242, -26230, -27102, -27857, -26998,
+	-26245, -26902, -27462, -26769, -26167, -26693, -27131, -26545,
+	-26044, -26481, -26835, -26324, -25893, -26266, -26560, -26104,
+	-25726, -26051, -26299, -25886, -25548, -25835, -26046, -25667,
+	-25362, -25619, -25801, -25449, -25171, -25402, -25560, -25231,
+	-24975, -25185, -25323, -25013, -24776, -24968, -25089, -24796,
+	-24574, -24751, -24857, -24578, -24370, -24534, -24627, -24360,
+	-24165, -24317, -24399, -24143, -23958, -24100, -24171, -23925,
+	-23750, -23883, -23945, -23708, -23541, -23666, -23720, -23490,
+	-23331, -23449, -23495, -23273, -23121, -23231, -23272, -23056,
+	-22910, -23014, -23048, -22838, -22698, -22797, -22826, -22621,
+	-22486, -22580, -22603, -22403, -22274, -22362, -22381, -22186,
+	-22061, -22145, -22160, -21969, -21848, -21928, -21938, -21751,
+	-21634, -21711, -21717, -21534, -21421, -21493, -21496, -21317,
+	-21207, -21276, -21276, -21099, -20993, -21059, -21055, -20882,
+	-20778, -20842, -20835, -20665, -20564, -20624, -20615, -20447,
+	-20349, -20407, -20395, -20230, -20134, -20190, -20176, -20013,
+	-19919, -19972, -19956, -19795, -19704, -19755, -19736, -19578,
+	-19489, -19538, -19517, -19361, -19274, -19321, -19298, -19143,
+	-19059, -19103, -19078, -18926, -18843, -18886, -18859, -18709,
+	-18628, -18669, -18640, -18491, -18412, -18451, -18421, -18274,
+	-18196, -18234, -18202, -18057, -17981, -18017, -17983, -17839,
+	-17765, -17799, -17765, -17622, -17549, -17582, -17546, -17405,
+	-17333, -17365, -17327, -17187, -17117, -17148, -17109, -16970,
+	-16901, -16930, -16890, -16753, -16685, -16713, -16671, -16536,
+	-16469, -16496, -16453, -16318, -16253, -16278, -16234, -16101,
+	-16037, -16061, -16016, -15884, -15820, -15844, -15798, -15666,
+	-15604, -15626, -15579, -15449, -15388, -15409, -15361, -15232,
+	-15172, -15192, -15143, -15014, -14955, -14975, -14924, -14797,
+	-14739, -14757, -14706, -14580, -14523, -14540, -14488, -14362,
+	-14306, -14323, -14270, -14145, -14090, -14105, -14052, -13928,
+	-13873, -13888, -13833, -13710, -13657, -13671, -13615, -13493,
+	-13440, -13453, -13397, -13276, -13224, -13236, -13179, -13058,
+	-13007, -13019, -12961, -12841, -12791, -12801, -12743, -12624,
+	-12574, -12584, -12525, -12407, -12358, -12367, -12307, -12189,
+	-12141, -12150, -12089, -11972, -11924, -11932, -11871, -11755,
+	-11708, -11715, -11653, -11537, -11491, -11498, -11435, -11320,
+	-11274, -11280, -11217, -11103, -11058, -11063, -10999, -10885,
+	-10841, -10846, -10781, -10668, -10624, -10628, -10563, -10451,
+	-10408, -10411, -10345, -10233, -10191, -10194, -10127, -10016,
+	-9974, -9976, -9909, -9799, -9758, -9759, -9691, -9581,
+	-9541, -9542, -9473, -9364, -9324, -9325, -9256, -9147,
+	-9107, -9107, -9038, -8930, -8891, -8890, -8820, -8712,
+	-8674, -8673, -8602, -8495, -8457, -8455, -8384, -8278,
+	-8240, -8238, -8166, -8060, -8024, -8021, -7948, -7843,
+	-7807, -7803, -7731, -7626, -7590, -7586, -7513, -7408,
+	-7373, -7369, -7295, -7191, -7156, -7151, -7077, -6974,
+	-6940, -6934, -6859, -6756, -6723, -6717, -6642, -6539,
+	-6506, -6499, -6424, -6322, -6289, -6282, -6206, -6105,
+	-6072, -6065, -5988, -5887, -5855, -5848, -5770, -5670,
+	-5639, -5630, -5553, -5453, -5422, -5413, -5335, -5235,
+	-5205, -5196, -5117, -5018, -4988, -4978, -4899, -4801,
+	-4771, -4761, -4682, -4583, -4554, -4544, -4464, -4366,
+	-4338, -4326, -4246, -4149, -4121, -4109, -4028, -3931,
+	-3904, -3892, -3810, -3714, -3687, -3674, -3593, -3497,
+	-3470, -3457, -3375, -3279, -3253, -3240, -3157, -3062,
+	-3036, -3023, -2939, -2845, -2819, -2805, -2722, -2628,
+	-2603, -2588, -2504, -2410, -2386, -2371, -2286, -2193,
+	-2169, -2153, -2068, -1976, -1952, -1936, -1851, -1758,
+	-1735, -1719, -1633, -1541, -1518, -1501, -1415, -1324,
+	-1301, -1284, -1198, -1106, -1084, -1067, -980, -889,
+	-868, -849, -762, -672, -651, -632, -544, -454,
+	-434, -415, -327, -237, -217, -198, -109, -20,
+	0, 20, 109, 198, 217, 237, 327, 415,
+	434, 454, 544, 632, 651, 672, 762, 849,
+	868, 889, 980, 1067, 1084, 1106, 1198, 1284,
+	1301, 1324, 1415, 1501, 1518, 1541, 1633, 1719,
+	1735, 1758, 1851, 1936, 1952, 1976, 2068, 2153,
+	2169, 2193, 2286, 2371, 2386, 2410, 2504, 2588,
+	2603, 2628, 2722, 2805, 2819, 2845, 2939, 3023,
+	3036, 3062, 3157, 3240, 3253, 3279, 3375, 3457,
+	3470, 3497, 3593, 3674, 3687, 3714, 3810, 3892,
+	3904, 3931, 4028, 4109, 4121, 4149, 4246, 4326,
+	4338, 4366, 4464, 4544, 4554, 4583, 4682, 4761,
+	4771, 4801, 4899, 4978, 4988, 5018, 5117, 5196,
+	5205, 5235, 5335, 5413, 5422, 5453, 5553, 5630,
+	5639, 5670, 5770, 5848, 5855, 5887, 5988, 6065,
+	6072, 6105, 6206, 6282, 6289, 6322, 6424, 6499,
+	6506, 6539, 6642, 6717, 6723, 6756, 6859, 6934,
+	6940, 6974, 7077, 7151, 7156, 7191, 7295, 7369,
+	7373, 7408, 7513, 7586, 7590, 7626, 7731, 7803,
+	7807, 7843, 7948, 8021, 8024, 8060, 8166, 8238,
+	8240, 8278, 8384, 8455, 8457, 8495, 8602, 8673,
+	8674, 8712, 8820, 8890, 8891, 8930, 9038, 9107,
+	9107, 9147, 9256, 9325, 9324, 9364, 9473, 9542,
+	9541, 9581, 9691, 9759, 9758, 9799, 9909, 9976,
+	9974, 10016, 10127, 10194, 10191, 10233, 10345, 10411,
+	10408, 10451, 10563, 10628, 10624, 10668, 10781, 10846,
+	10841, 10885, 10999, 11063, 11058, 11103, 11217, 11280,
+	11274, 11320, 11435, 11498, 11491, 11537, 11653, 11715,
+	11708, 11755, 11871, 11932, 11924, 11972, 12089, 12150,
+	12141, 12189, 12307, 12367, 12358, 12407, 12525, 12584,
+	12574, 12624, 12743, 12801, 12791, 12841, 12961, 13019,
+	13007, 13058, 13179, 13236, 13224, 13276, 13397, 13453,
+	13440, 13493, 13615, 13671, 13657, 13710, 13833, 13888,
+	13873, 13928, 14052, 14105, 14090, 14145, 14270, 14323,
+	14306, 14362, 14488, 14540, 14523, 14580, 14706, 14757,
+	14739, 14797, 14924, 14975, 14955, 15014, 15143, 15192,
+	15172, 15232, 15361, 15409, 15388, 15449, 15579, 15626,
+	15604, 15666, 15798, 15844, 15820, 15884, 16016, 16061,
+	16037, 16101, 16234, 16278, 16253, 16318, 16453, 16496,
+	16469, 16536, 16671, 16713, 16685, 16753, 16890, 16930,
+	16901, 16970, 17109, 17148, 17117, 17187, 17327, 17365,
+	17333, 17405, 17546, 17582, 17549, 17622, 17765, 17799,
+	17765, 17839, 17983, 18017, 17981, 18057, 18202, 18234,
+	18196, 18274, 18421, 18451, 18412, 18491, 18640, 18669,
+	18628, 18709, 18859, 18886, 18843, 18926, 19078, 19103,
+	19059, 19143, 19298, 19321, 19274, 19361, 19517, 19538,
+	19489, 19578, 19736, 19755, 19704, 19795, 19956, 19972,
+	19919, 20013, 20176, 20190, 20134, 20230, 20395, 20407,
+	20349, 20447, 20615, 20624, 20564, 20665, 20835, 20842,
+	20778, 20882, 21055, 21059, 20993, 21099, 21276, 21276,
+	21207, 21317, 21496, 21493, 21421, 21534, 21717, 21711,
+	21634, 21751, 21938, 21928, 21848, 21969, 22160, 22145,
+	22061, 22186, 22381, 22362, 22274, 22403, 22603, 22580,
+	22486, 22621, 22826, 22797, 22698, 22838, 23048, 23014,
+	22910, 23056, 23272, 23231, 23121, 23273, 23495, 23449,
+	23331, 23490, 23720, 23666, 23541, 23708, 23945, 23883,
+	23750, 23925, 24171, 24100, 23958, 24143, 24399, 24317,
+	24165, 24360, 24627, 24534, 24370, 24578, 24857, 24751,
+	24574, 24796, 25089, 24968, 24776, 25013, 25323, 25185,
+	24975, 25231, 25560, 25402, 25171, 25449, 25801, 25619,
+	25362, 25667, 26046, 25835, 25548, 25886, 26299, 26051,
+	25726, 26104, 26560, 26266, 25893, 26324, 26835, 26481,
+	26044, 26545, 27131, 26693, 26167, 26769, 27462, 26902,
+	26245, 26998, 27857, 27102, 26230, 27242, 28391, 27275,
+	25989, 27541, 29331, 27314, 24896, 28284, 32685, 24254,
+	0,
+
+	/* Level 3: 512 samples, 128 harmonics */
+	0, -24234, -32577, -28086, -24679, -27077, -29004, -27126,
+	-25555, -26821, -27846, -26610, -25579, -26430, -27095, -26148,
+	-25377, -26013, -26482, -25702, -25083, -25587, -25934, -25261,
+	-24742, -25157, -25420, -24823, -24375, -24725, -24927, -24386,
+	-23991, -24293, -24448, -23950, -23596, -23859, -23978, -23514,
+	-23194, -23426, -23515, -23078, -22785, -22992, -23056, -22643,
+	-22372, -22558, -22601, -22208, -21956, -22124, -22149, -21773,
+	-21538, -21689, -21700, -21338, -21117, -21255, -21252, -20903,
+	-20695, -20821, -20806, -20468, -20271, -20386, -20361, -20034,
+	-19846, -19952, -19917, -19599, -19421, -19517, -19474, -19164,
+	-18994, -19083, -19032, -18729, -18567, -18648, -18590, -18295,
+	-18139, -18214, -18149, -17860, -17710, -17779, -17708, -17425,
+	-17281, -17344, -17268, -16991, -16852, -16910, -16829, -16556,
+	-16422, -16475, -16389, -16121, -15992, -16041, -15950, -15687,
+	-15562, -15606, -15511, -15252, -15132, -15172, -15073, -14817,
+	-14701, -14737, -14634, -14383, -14270, -14302, -14196, -13948,
+	-13839, -13868, -13758, -13513, -13407, -13433, -13320, -13079,
+	-12976, -12999, -12882, -12644, -12544, -12564, -12445, -12209,
+	-12113, -12129, -12007, -11775, -11681, -11695, -11570, -11340,
+	-11249, -11260, -11133, -10905, -10817, -10826, -10696, -10471,
+	-10385, -10391, -10259, -10036, -9952, -9956, -9822, -9602,
+	-9520, -9522, -9385, -9167, -9088, -9087, -8948, -8732,
+	-8655, -8653, -8511, -8298, -8223, -8218, -8074, -7863,
+	-7790, -7783, -7638, -7428, -7358, -7349, -7201, -6994,
+	-6925, -6914, -6764, -6559, -6493, -6480, -6328, -6124,
+	-6060, -6045, -5891, -5690, -5627, -5610, -5455, -5255,
+	-5194, -5176, -5018, -4821, -4762, -4741, -4582, -4386,
+	-4329, -4306, -4145, -3951, -3896, -3872, -3709, -3517,
+	-3463, -3437, -3273, -3082, -3030, -3003, -2836, -2647,
+	-2597, -2568, -2400, -2213, -2165, -2133, -1963, -1778,
+	-1732, -1699, -1527, -1344, -1299, -1264, -1091, -909,
+	-866, -829, -654, -474, -433, -395, -218, -40,
+	0, 40, 218, 395, 433, 474, 654, 829,
+	866, 909, 1091, 1264, 1299, 1344, 1527, 1699,
+	1732, 1778, 1963, 2133, 2165, 2213, 2400, 2568,
+	2597, 2647, 2836, 3003, 3030, 3082, 3273, 3437,
+	3463, 3517, 3709, 3872, 3896, 3951, 4145, 4306,
+	4329, 4386, 4582, 4741, 4762, 4821, 5018, 5176,
+	5194, 5255, 5455, 5610, 5627, 5690, 5891, 6045,
+	6060, 6124, 6328, 6480, 6493, 6559, 6764, 6914,
+	6925, 6994, 7201, 7349, 7358, 7428, 7638, 7783,
+	7790, 7863, 8074, 8218, 8223, 8298, 8511, 8653,
+	8655, 8732, 8948, 9087, 9088, 9167, 9385, 9522,
+	9520, 9602, 9822, 9956, 9952, 10036, 10259, 10391,
+	10385, 10471, 10696, 10826, 10817, 10905, 11133, 11260,
+	11249, 11340, 11570, 11695, 11681, 11775, 12007, 12129,
+	12113, 12209, 12445, 12564, 12544, 12644, 12882, 12999,
+	12976, 13079, 13320, 13433, 13407, 13513, 13758, 13868,
+	13839, 13948, 14196, 14302, 14270, 14383, 14634, 14737,
+	14701, 14817, 15073, 15172, 15132, 15252, 15511, 15606,
+	15562, 15687, 15950, 16041, 15992, 16121, 16389, 16475,
+	16422, 16556, 16829, 16910, 16852, 16991, 17268, 17344,
+	17281, 17425, 17708, 17779, 17710, 17860, 18149, 18214,
+	18139, 18295, 18590, 18648, 18567, 18729, 19032, 19083,
+	18994, 19164, 19474, 19517, 19421, 19599, 19917, 19952,
+	19846, 20034, 20361, 20386, 20271, 20468, 20806, 20821,
+	20695, 20903, 21252, 21255, 21117, 21338, 21700, 21689,
+	21538, 21773, 22149, 22124, 21956, 22208, 22601, 22558,
+	22372, 22643, 23056, 22992, 22785, 23078, 23515, 23426,
+	23194, 23514, 23978, 23859, 23596, 23950, 24448, 24293,
+	23991, 24386, 24927, 24725, 24375, 24823, 25420, 25157,
+	24742, 25261, 25934, 25587, 25083, 25702, 26482, 26013,
+	25377, 26148, 27095, 26430, 25579, 26610, 27846, 26821,
+	25555, 27126, 29004, 27077, 24679, 28086, 32577, 24234,
+	0,
+
+	/* Level 4: 256 samples, 64 harmonics */
+	0, -24194, -32358, -27691, -24246, -26602, -28349, -26297,
+	-24689, -25912, -26756, -25346, -24280, -25087, -25567, -24450,
+	-23645, -24235, -24519, -23569, -22918, -23374, -23534, -22693,
+	-22145, -22509, -22584, -21820, -21345, -21643, -21655, -20949,
+	-20528, -20776, -20739, -20078, -19700, -19908, -19833, -19207,
+	-18865, -19040, -18933, -18337, -18023, -18171, -18038, -17467,
+	-17178, -17302, -17147, -16598, -16329, -16434, -16258, -15728,
+	-15478, -15565, -15372, -14859, -14625, -14696, -14488, -13989,
+	-13770, -13827, -13605, -13120, -12913, -12958, -12723, -12250,
+	-12056, -12089, -11843, -11381, -11198, -11220, -10963, -10511,
+	-10338, -10350, -10084, -9642, -9479, -9481, -9205, -8773,
+	-8618, -8612, -8327, -7903, -7758, -7743, -7450, -7034,
+	-6897, -6874, -6573, -6165, -6035, -6005, -5696, -5296,
+	-5173, -5135, -4819, -4426, -4312, -4266, -3943, -3557,
+	-3449, -3397, -3066, -2688, -2587, -2528, -2190, -1819,
+	-1725, -1658, -1314, -949, -862, -789, -438, -80,
+	0, 80, 438, 789, 862, 949, 1314, 1658,
+	1725, 1819, 2190, 2528, 2587, 2688, 3066, 3397,
+	3449, 3557, 3943, 4266, 4312, 4426, 4819, 5135,
+	5173, 5296, 5696, 6005, 6035, 6165, 6573, 6874,
+	6897, 7034, 7450, 7743, 7758, 7903, 8327, 8612,
+	8618, 8773, 9205, 9481, 9479, 9642, 10084, 10350,
+	10338, 10511, 10963, 11220, 11198, 11381, 11843, 12089,
+	12056, 12250, 12723, 12958, 12913, 13120, 13605, 13827,
+	13770, 13989, 14488, 14696, 14625, 14859, 15372, 15565,
+	15478, 15728, 16258, 16434, 16329, 16598, 17147, 17302,
+	17178, 17467, 18038, 18171, 18023, 18337, 18933, 19040,
+	18865, 19207, 19833, 19908, 19700, 20078, 20739, 20776,
+	20528, 20949, 21655, 21643, 21345, 21820, 22584, 22509,
+	22145, 22693, 23534, 23374, 22918, 23569, 24519, 24235,
+	23645, 24450, 25567, 25087, 24280, 25346, 26756, 25912,
+	24689, 26297, 28349, 26602, 24246, 27691, 32358, 24194,
+	0,
+
+	/* Level 5: 256 samples, 32 harmonics */
+	0, -13418, -24114, -30348, -31920, -30088, -26902, -24303,
+	-23383, -24122, -25653, -26870, -27035, -26105, -24638, -23412,
+	-22964, -23334, -24093, -24643, -24565, -23840, -22818, -21990,
+	-21693, -21931, -22399, -22682, -22501, -21867, -21053, -20418,
+	-20196, -20366, -20678, -20814, -20576, -19995, -19302, -18783,
+	-18607, -18734, -18948, -18990, -18715, -18169, -17558, -17116,
+	-16971, -17069, -17214, -17190, -16888, -16368, -15816, -15432,
+	-15310, -15385, -15478, -15404, -15082, -14581, -14075, -13735,
+	-13631, -13690, -13742, -13627, -13289, -12804, -12335, -12032,
+	-11942, -11986, -12004, -11857, -11505, -11033, -10595, -10323,
+	-10246, -10278, -10267, -10091, -9727, -9267, -8856, -8610,
+	-8545, -8565, -8529, -8328, -7954, -7503, -7117, -6895,
+	-6839, -6851, -6791, -6567, -6184, -5742, -5378, -5179,
+	-5132, -5134, -5053, -4807, -4415, -3983, -3639, -3460,
+	-3422, -3416, -3315, -3049, -2649, -2224, -1901, -1742,
+	-1711, -1697, -1576, -1291, -883, -467, -162, -22,
+	0, 22, 162, 467, 883, 1291, 1576, 1697,
+	1711, 1742, 1901, 2224, 2649, 3049, 3315, 3416,
+	3422, 3460, 3639, 3983, 4415, 4807, 5053, 5134,
+	5132, 5179, 5378, 5742, 6184, 6567, 6791, 6851,
+	6839, 6895, 7117, 7503, 7954, 8328, 8529, 8565,
+	8545, 8610, 8856, 9267, 9727, 10091, 10267, 10278,
+	10246, 10323, 10595, 11033, 11505, 11857, 12004, 11986,
+	11942, 12032, 12335, 12804, 13289, 13627, 13742, 13690,
+	13631, 13735, 14075, 14581, 15082, 15404, 15478, 15385,
+	15310, 15432, 15816, 16368, 16888, 17190, 17214, 17069,
+	16971, 17116, 17558, 18169, 18715, 18990, 18948, 18734,
+	18607, 18783, 19302, 19995, 20576, 20814, 20678, 20366,
+	20196, 20418, 21053, 21867, 22501, 22682, 22399, 21931,
+	21693, 21990, 22818, 23840, 24565, 24643, 24093, 23334,
+	22964, 23412, 24638, 26105, 27035, 26870, 25653, 24122,
+	23383, 24303, 26902, 30088, 31920, 30348, 24114, 13418,
+	0,
+
+	/* Level 6: 256 samples, 16 harmonics */
+	0, -6889, -13396, -19175, -23952, -27545, -29881, -30999,
+	-31038, -30214, -28797, -27076, -25326, -23779, -22606, -21899,
+	-21672, -21870, -22380, -23059, -23752, -24317, -24645, -24673,
+	-24387, -23823, -23056, -22187, -21324, -20568, -19996, -19652,
+	-19542, -19636, -19873, -20174, -20454, -20635, -20660, -20499,
+	-20150, -19644, -19032, -18383, -17765, -17241, -16856, -16631,
+	-16562, -16618, -16753, -16907, -17021, -17043, -16939, -16694,
+	-16317, -15838, -15300, -14758, -14262, -13856, -13567, -13405,
+	-13357, -13393, -13470, -13542, -13561, -13491, -13311, -13016,
+	-12622, -12159, -11667, -11192, -10773, -10443, -10218, -10096,
+	-10062, -10084, -10123, -10138, -10092, -9957, -9723, -9394,
+	-8987, -8536, -8078, -7652, -7291, -7017, -6839, -6749,
+	-6725, -6737, -6746, -6717, -6619, -6434, -6157, -5799,
+	-5383, -4941, -4511, -4125, -3811, -3584, -3445, -3381,
+	-3367, -3370, -3353, -3286, -3143, -2914, -2600, -2217,
+	-1793, -1360, -954, -604, -333, -149, -46, -6,
+	0, 6, 46, 149, 333, 604, 954, 1360,
+	1793, 2217, 2600, 2914, 3143, 3286, 3353, 3370,
+	3367, 3381, 3445, 3584, 3811, 4125, 4511, 4941,
+	5383, 5799, 6157, 6434, 6619, 6717, 6746, 6737,
+	6725, 6749, 6839, 7017, 7291, 7652, 8078, 8536,
+	8987, 9394, 9723, 9957, 10092, 10138, 10123, 10084,
+	10062, 10096, 10218, 10443, 10773, 11192, 11667, 12159,
+	12622, 13016, 13311, 13491, 13561, 13542, 13470, 13393,
+	13357, 13405, 13567, 13856, 14262, 14758, 15300, 15838,
+	16317, 16694, 16939, 17043, 17021, 16907, 16753, 16618,
+	16562, 16631, 16856, 17241, 17765, 18383, 19032, 19644,
+	20150, 20499, 20660, 20635, 20454, 20174, 19873, 19636,
+	19542, 19652, 19996, 20568, 21324, 22187, 23056, 23823,
+	24387, 24673, 24645, 24317, 23752, 23059, 22380, 21870,
+	21672, 21899, 22606, 23779, 25326, 27076, 28797, 30214,
+	31038, 30999, 29881, 27545, 23952, 19175, 13396, 6889,
+	0,
+
+	/* Level 7: 256 samples, 8 harmonics */
+	0, -3468, -6883, -10193, -13350, -16307, -19026, -21472,
+	-23619, -25445, -26940, -28100, -28928, -29435, -29639, -29566,
+	-29245, -28709, -27996, -27145, -26197, -25189, -24162, -23149,
+	-22182, -21290, -20494, -19811, -19253, -18826, -18529, -18359,
+	-18305, -18354, -18488, -18689, -18935, -19204, -19475, -19727,
+	-19941, -20100, -20192, -20205, -20134, -19976, -19731, -19405,
+	-19004, -18539, -18024, -17472, -16899, -16321, -15753, -15210,
+	-14705, -14249, -13851, -13517, -13250, -13050, -12915, -12840,
+	-12817, -12837, -12888, -12958, -13034, -13105, -13157, -13179,
+	-13163, -13099, -12983, -12811, -12582, -12298, -11962, -11581,
+	-11162, -10715, -10250, -9777, -9309, -8855, -8425, -8029,
+	-7673, -7364, -7103, -6893, -6733, -6619, -6547, -6510,
+	-6500, -6507, -6522, -6534, -6535, -6514, -6464, -6376,
+	-6247, -6073, -5851, -5584, -5272, -4920, -4535, -4124,
+	-3695, -3258, -2822, -2396, -1990, -1611, -1267, -962,
+	-701, -485, -314, -186, -97, -42, -12, -2,
+	0, 2, 12, 42, 97, 186, 314, 485,
+	701, 962, 1267, 1611, 1990, 2396, 2822, 3258,
+	3695, 4124, 4535, 4920, 5272, 5584, 5851, 6073,
+	6247, 6376, 6464, 6514, 6535, 6534, 6522, 6507,
+	6500, 6510, 6547, 6619, 6733, 6893, 7103, 7364,
+	7673, 8029, 8425, 8855, 9309, 9777, 10250, 10715,
+	11162, 11581, 11962, 12298, 12582, 12811, 12983, 13099,
+	13163, 13179, 13157, 13105, 13034, 12958, 12888, 12837,
+	12817, 12840, 12915, 13050, 13250, 13517, 13851, 14249,
+	14705, 15210, 15753, 16321, 16899, 17472, 18024, 18539,
+	19004, 19405, 19731, 19976, 20134, 20205, 20192, 20100,
+	19941, 19727, 19475, 19204, 18935, 18689, 18488, 18354,
+	18305, 18359, 18529, 18826, 19253, 19811, 20494, 21290,
+	22182, 23149, 24162, 25189, 26197, 27145, 27996, 28709,
+	29245, 29566, 29639, 29435, 28928, 28100, 26940, 25445,
+	23619, 21472, 19026, 16307, 13350, 10193, 6883, 3468,
+	0,
+
+	/* Level 8: 256 samples, 4 harmonics */
+	0, -1737, -3467, -5180, -6871, -8530, -10152, -11728,
+	-13253, -14719, -16121, -17454, -18712, -19891, -20987, -21997,
+	-22918, -23747, -24483, -25126, -25674, -26128, -26489, -26758,
+	-26938, -27030, -27039, -26966, -26818, -26597, -26308, -25957,
+	-25549, -25090, -24585, -24040, -23461, -22854, -22225, -21580,
+	-20925, -20265, -19606, -18953, -18310, -17683, -17076, -16492,
+	-15935, -15408, -14913, -14453, -14030, -13644, -13297, -12988,
+	-12718, -12486, -12291, -12132, -12007, -11915, -11852, -11817,
+	-11805, -11815, -11844, -11887, -11941, -12003, -12070, -12137,
+	-12202, -12261, -12311, -12349, -12372, -12378, -12363, -12327,
+	-12268, -12183, -12071, -11933, -11767, -11573, -11351, -11101,
+	-10826, -10524, -10199, -9850, -9481, -9094, -8689, -8271,
+	-7841, -7403, -6958, -6510, -6062, -5615, -5174, -4740,
+	-4317, -3906, -3510, -3131, -2770, -2430, -2111, -1815,
+	-1542, -1294, -1070, -870, -694, -542, -412, -304,
+	-215, -146, -92, -54, -28, -12, -3, 0,
+	0, 0, 3, 12, 28, 54, 92, 146,
+	215, 304, 412, 542, 694, 870, 1070, 1294,
+	1542, 1815, 2111, 2430, 2770, 3131, 3510, 3906,
+	4317, 4740, 5174, 5615, 6062, 6510, 6958, 7403,
+	7841, 8271, 8689, 9094, 9481, 9850, 10199, 10524,
+	10826, 11101, 11351, 11573, 11767, 11933, 12071, 12183,
+	12268, 12327, 12363, 12378, 12372, 12349, 12311, 12261,
+	12202, 12137, 12070, 12003, 11941, 11887, 11844, 11815,
+	11805, 11817, 11852, 11915, 12007, 12132, 12291, 12486,
+	12718, 12988, 13297, 13644, 14030, 14453, 14913, 15408,
+	15935, 16492, 17076, 17683, 18310, 18953, 19606, 20265,
+	20925, 21580, 22225, 22854, 23461, 24040, 24585, 25090,
+	25549, 25957, 26308, 26597, 26818, 26966, 27039, 27030,
+	26938, 26758, 26489, 26128, 25674, 25126, 24483, 23747,
+	22918, 21997, 20987, 19891, 18712, 17454, 16121, 14719,
+	13253, 11728, 10152, 8530, 6871, 5180, 3467, 1737,
+	0,
+
+	/* Level 9: 256 samples, 2 harmonics */
+	0, -869, -1737, -2602, -3463, -4319, -5168, -6010,
+	-6843, -7665, -8476, -9275, -10059, -10829, -11583, -12319,
+	-13037, -13736, -14415, -15073, -15709, -16323, -16912, -17478,
+	-18018, -18533, -19021, -19483, -19918, -20325, -20703, -21054,
+	-21375, -21668, -21932, -22167, -22372, -22549, -22696, -22814,
+	-22904, -22965, -22997, -23002, -22979, -22929, -22852, -22749,
+	-22621, -22467, -22290, -22089, -21865, -21618, -21351, -21063,
+	-20756, -20430, -20087, -19726, -19350, -18959, -18555, -18137,
+	-17708, -17268, -16819, -16361, -15895, -15424, -14946, -14465,
+	-13979, -13492, -13004, -12515, -12027, -11540, -11056, -10575,
+	-10099, -9628, -9164, -8706, -8255, -7813, -7380, -6957,
+	-6544, -6141, -5750, -5371, -5005, -4650, -4309, -3982,
+	-3667, -3367, -3081, -2808, -2550, -2306, -2076, -1860,
+	-1658, -1470, -1295, -1134, -986, -850, -727, -616,
+	-516, -427, -349, -280, -221, -171, -129, -94,
+	-66, -45, -28, -16, -8, -4, -1, 0,
+	0, 0, 1, 4, 8, 16, 28, 45,
+	66, 94, 129, 171, 221, 280, 349, 427,
+	516, 616, 727, 850, 986, 1134, 1295, 1470,
+	1658, 1860, 2076, 2306, 2550, 2808, 3081, 3367,
+	3667, 3982, 4309, 4650, 5005, 5371, 5750, 6141,
+	6544, 6957, 7380, 7813, 8255, 8706, 9164, 9628,
+	10099, 10575, 11056, 11540, 12027, 12515, 13004, 13492,
+	13979, 14465, 14946, 15424, 15895, 16361, 16819, 17268,
+	17708, 18137, 18555, 18959, 19350, 19726, 20087, 20430,
+	20756, 21063, 21351, 21618, 21865, 22089, 22290, 22467,
+	22621, 22749, 22852, 22929, 22979, 23002, 22997, 22965,
+	22904, 22814, 22696, 22549, 22372, 22167, 21932, 21668,
+	21375, 21054, 20703, 20325, 19918, 19483, 19021, 18533,
+	18018, 17478, 16912, 16323, 15709, 15073, 14415, 13736,
+	13037, 12319, 11583, 10829, 10059, 9275, 8476, 7665,
+	6843, 6010, 5168, 4319, 3463, 2602, 1737, 869,
+	0,
+
+	/* Level 10: 256 samples, 1 harmonics */
+	0, -435, -869, -1303, -1736, -2168, -2598, -3027,
+	-3455, -3880, -4303, -4723, -5140, -5555, -5966, -6373,
+	-6777, -7176, -7571, -7962, -8348, -8728, -9104, -9474,
+	-9838, -10196, -10549, -10895, -11234, -11566, -11892, -12210,
+	-12521, -12825, -13121, -13409, -13688, -13960, -14223, -14478,
+	-14724, -14961, -15189, -15408, -15617, -15817, -16008, -16189,
+	-16360, -16521, -16673, -16814, -16946, -17067, -17177, -17278,
+	-17368, -17447, -17516, -17575, -17623, -17660, -17687, -17703,
+	-17708, -17703, -17687, -17660, -17623, -17575, -17516, -17447,
+	-17368, -17278, -17177, -17067, -16946, -16814, -16673, -16521,
+	-16360, -16189, -16008, -15817, -15617, -15408, -15189, -14961,
+	-14724, -14478, -14223, -13960, -13688, -13409, -13121, -12825,
+	-12521, -12210, -11892, -11566, -11234, -10895, -10549, -10196,
+	-9838, -9474, -9104, -8728, -8348, -7962, -7571, -7176,
+	-6777, -6373, -5966, -5555, -5140, -4723, -4303, -3880,
+	-3455, -3027, -2598, -2168, -1736, -1303, -869, -435,
+	0, 435, 869, 1303, 1736, 2168, 2598, 3027,
+	3455, 3880, 4303, 4723, 5140, 5555, 5966, 6373,
+	6777, 7176, 7571, 7962, 8348, 8728, 9104, 9474,
+	9838, 10196, 10549, 10895, 11234, 11566, 11892, 12210,
+	12521, 12825, 13121, 13409, 13688, 13960, 14223, 14478,
+	14724, 14961, 15189, 15408, 15617, 15817, 16008, 16189,
+	16360, 16521, 16673, 16814, 16946, 17067, 17177, 17278,
+	17368, 17447, 17516, 17575, 17623, 17660, 17687, 17703,
+	17708, 17703, 17687, 17660, 17623, 17575, 17516, 17447,
+	17368, 17278, 17177, 17067, 16946, 16814, 16673, 16521,
+	16360, 16189, 16008, 15817, 15617, 15408, 15189, 14961,
+	14724, 14478, 14223, 13960, 13688, 13409, 13121, 12825,
+	12521, 12210, 11892, 11566, 11234, 10895, 10549, 10196,
+	9838, 9474, 9104, 8728, 8348, 7962, 7571, 7176,
+	6777, 6373, 5966, 5555, 5140, 4723, 4303, 3880,
+	3455, 3027, 2598, 2168, 1736, 1303, 869, 435,
+	0,
+
+	/* Level 11: 256 samples, 1 harmonics */
+	0, -435, -869, -1303, -1736, -2168, -2598, -3027,
+	-3455, -3880, -4303, -4723, -5140, -5555, -5966, -6373,
+	-6777, -7176, -7571, -7962, -8348, -8728, -9104, -9474,
+	-9838, -10196, -10549, -10895, -11234, -11566, -11892, -12210,
+	-12521, -12825, -13121, -13409, -13688, -13960, -14223, -14478,
+	-14724, -14961, -15189, -15408, -15617, -15817, -16008, -16189,
+	-16360, -16521, -16673, -16814, -16946, -17067, -17177, -17278,
+	-17368, -17447, -17516, -17575, -17623, -17660, -17687, -17703,
+	-17708, -17703, -17687, -17660, -17623, -17575, -17516, -17447,
+	-17368, -17278, -17177, -17067, -16946, -16814, -16673, -16521,
+	-16360, -16189, -16008, -15817, -15617, -15408, -15189, -14961,
+	-14724, -14478, -14223, -13960, -13688, -13409, -13121, -12825,
+	-12521, -12210, -11892, -11566, -11234, -10895, -10549, -10196,
+	-9838, -9474, -9104, -8728, -8348, -7962, -7571, -7176,
+	-6777, -6373, -5966, -5555, -5140, -4723, -4303, -3880,
+	-3455, -3027, -2598, -2168, -1736, -1303, -869, -435,
+	0, 435, 869, 1303, 1736, 2168, 2598, 3027,
+	3455, 3880, 4303, 4723, 5140, 5555, 5966, 6373,
+	6777, 7176, 7571, 7962, 8348, 8728, 9104, 9474,
+	9838, 10196, 10549, 10895, 11234, 11566, 11892, 12210,
+	12521, 12825, 13121, 13409, 13688, 13960, 14223, 14478,
+	14724, 14961, 15189, 15408, 15617, 15817, 16008, 16189,
+	16360, 16521, 16673, 16814, 16946, 17067, 17177, 17278,
+	17368, 17447, 17516, 17575, 17623, 17660, 17687, 17703,
+	17708, 17703, 17687, 17660, 17623, 17575, 17516, 17447,
+	17368, 17278, 17177, 17067, 16946, 16814, 16673, 16521,
+	16360, 16189, 16008, 15817, 15617, 15408, 15189, 14961,
+	14724, 14478, 14223, 13960, 13688, 13409, 13121, 12825,
+	12521, 12210, 11892, 11566, 11234, 10895, 10549, 10196,
+	9838, 9474, 9104, 8728, 8348, 7962, 7571, 7176,
+	6777, 6373, 5966, 5555, 5140, 4723, 4303, 3880,
+	3455, 3027, 2598, 2168, 1736, 1303, 869, 435,
+	0,
+};
+
+static const wave_sample_t wave_tri[WAVE_TOTAL_SAMPLES] =
+{
+	/* Level 0: 2048 samples, 1023 harmonics */
+	-32767, -32717, -32651, -32588, -32524, -32460, -32396, -32332,
+	-32268, -32204, -32140, -32076, -32012, -31948, -31884, -31820,
+	-31756, -31692, -31628, -31564, -31499, -31435, -31371, -31307,
+	-31243, -31179, -31115, -31051, -30987, -30923, -30859, -30795,
+	-30731, -30667, -30603, -30539, -30475, -30411, -30347, -30283,
+	-30219, -30155, -30091, -30027, -29963, -29899, -29835, -29771,
+	-29707, -29643, -29579, -29515, -29451, -29387, -29323, -29259,
+	-29195, -29131, -29067, -29003, -28939, -28875, -28811, -28747,
+	-28682, -28618, -28554, -28490, -28426, -28362, -28298, -28234,
+	-28170, -28106, -28042, -27978, -27914, -27850, -27786, -27722,
+	-27658, -27594, -27530, -27466, -27402, -27338, -27274, -27210,
+	-27146, -27082, -27018, -26954, -26890, -26826, -26762, -26698,
+	-26634, -26570, -26506, -26442, -26378, -26314, -26250, -26186,
+	-26122, -26058, -25993, -25929, -25865, -25801, -25737, -25673,
+	-25609, -25545, -25481, -25417, -25353, -25289, -25225, -25161,
+	-25097, -25033, -24969, -24905, -24841, -24777, -24713, -24649,
+	-24585, -24521, -24457, -24393, -24329, -24265, -24201, -24137,
+	-24073, -24009, -23945, -23881, -23817, -23753, -23689, -23625,
+	-23561, -23497, -23433, -23369, -23305, -23240, -23176, -23112,
+	-23048, -22984, -22920, -22856, -22792, -22728, -22664, -22600,
+	-22536, -22472, -22408, -22344, -22280, -22216, -22152, -22088,
+	-22024, -21960, -21896, -21832, -21768, -21704, -21640, -21576,
+	-21512, -21448, -21384, -21320, -21256, -21192, -21128, -21064,
+	-21000, -20936, -20872, -20808, -20744, -20680, -20616, -20552,
+	-20487, -20423, -20359, -20295, -20231, -20167, -20103, -20039,
+	-19975, -19911, -19847, -19783, -19719, -19655, -19591, -19527,
+	-19463, -19399, -19335, -19271, -19207, -19143, -19079, -19015,
+	-18951, -18887, -18823, -18759, -18695, -18631, -18567, -18503,
+	-18439, -18375, -18311, -18247, -18183, -18119, -18055, -17991,
+	-17927, -17863, -17799, -17734, -17670, -17606, -17542, -17478,
+	-17414, -17350, -17286, -17222, -17158, -17094, -17030, -16966,
+	-16902, -16838, -16774, -16710, -16646, -16582, -16518, -16454,
+	-16390, -16326, -16262, -16198, -16134, -16070, -16006, -15942,
+	-15878, -15814, -15750, -15686, -15622, -15558, -15494, -15430,
+	-15366, -15302, -15238, -15174, -15110, -15045, -14981, -14917,
+	-14853, -14789, -14725, -14661, -14597, -14533, -14469, -14405,
+	-14341, -14277, -14213, -14149, -14085, -14021, -13957, -13893,
+	-13829, -13765, -13701, -13637, -13573, -13509, -13445, -13381,
+	-13317, -13253, -13189, -13125, -13061, -12997, -12933, -12869,
+	-12805, -12741, -12677, -12613, -12549, -12485, -12421, -12357,
+	-12292, -12228, -12164, -12100, -12036, -11972, -11908, -11844,
+	-11780, -11716, -11652, -11588, -11524, -11460, -11396, -11332,
+	-11268, -11204, -11140, -11076, -11012, -10948, -10884, -10820,
+	-10756, -10692, -10628, -10564, -10500, -10436, -10372, -10308,
+	-10244, -10180, -10116, -10052, -9988, -9924, -9860, -9796,
+	-9732, -9668, -9604, -9539, -9475, -9411, -9347, -9283,
+	-9219, -9155, -9091, -9027, -8963, -8899, -8835, -8771,
+	-8707, -8643, -8579, -8515, -8451, -8387, -8323, -8259,
+	-8195, -8131, -8067, -8003, -7939, -7875, -7811, -7747,
+	-7683, -7619, -7555, -7491, -7427, -7363, -7299, -7235,
+	-7171, -7107, -7043, -6979, -6915, -6851, -6786, -6722,
+	-6658, -6594, -6530, -6466, -6402, -6338, -6274, -6210,
+	-6146, -6082, -6018, -5954, -5890, -5826, -5762, -5698,
+	-5634, -5570, -5506, -5442, -5378, -5314, -5250, -5186,
+	-5122, -5058, -4994, -4930, -4866, -4802, -4738, -4674,
+	-4610, -4546, -4482, -4418, -4354, -4290, -4226, -4162,
+	-4097, -4033, -3969, -3905, -3841, -3777, -3713, -3649,
+	-3585, -3521, -3457, -3393, -3329, -3265, -3201, -3137,
+	-3073, -3009, -2945, -2881, -2817, -2753, -2689, -2625,
+	-2561, -2497, -2433, -2369, -2305, -2241, -2177, -2113,
+	-2049, -1985, -1921, -1857, -1793, -1729, -1665, -1601,
+	-1537, -1473, -1409, -1344, -1280, -1216, -1152, -1088,
+	-1024, -960, -896, -832, -768, -704, -640, -576,
+	-512, -448, -384, -320, -256, -192, -128, -64,
+	0, 64, 128, 192, 256, 320, 384, 448,
+	512, 576, 640, 704, 768, 832, 896, 960,
+	1024, 1088, 1152, 1216, 1280, 1344, 1409, 1473,
+	1537, 1601, 1665, 1729, 1793, 1857, 1921, 1985,
+	2049, 2113, 2177, 2241, 2305, 2369, 2433, 2497,
+	2561, 2625, 2689, 2753, 2817, 2881, 2945, 3009,
+	3073, 3137, 3201, 3265, 3329, 3393, 3457, 3521,
+	3585, 3649, 3713, 3777, 3841, 3905, 3969, 4033,
+	4097, 4162, 4226, 4290, 4354, 4418, 4482, 4546,
+	4610, 4674, 4738, 4802, 4866, 4930, 4994, 5058,
+	5122, 5186, 5250, 5314, 5378, 5442, 5506, 5570,
+	5634, 5698, 5762, 5826, 5890, 5954, 6018, 6082,
+	6146, 6210, 6274, 6338, 6402, 6466, 6530, 6594,
+	6658, 6722, 6786, 6851, 6915, 6979, 7043, 7107,
+	7171, 7235, 7299, 7363, 7427, 7491, 7555, 7619,
+	7683, 7747, 7811, 7875, 7939, 8003, 8067, 8131,
+	8195, 8259, 8323, 8387, 8451, 8515, 8579, 8643,
+	8707, 8771, 8835, 8899, 8963, 9027, 9091, 9155,
+	9219, 9283, 9347, 9411, 9475, 9539, 9604, 9668,
+	9732, 9796, 9860, 9924, 9988, 10052, 10116, 10180,
+	10244, 10308, 10372, 10436, 10500, 10564, 10628, 10692,
+	10756, 10820, 10884, 10948, 11012, 11076, 11140, 11204,
+	11268, 11332, 11396, 11460, 11524, 11588, 11652, 11716,
+	11780, 11844, 11908, 11972, 12036, 12100, 12164, 12228,
+	12292, 12357, 12421, 12485, 12549, 12613, 12677, 12741,
+	12805, 12869, 12933, 12997, 13061, 13125, 13189, 13253,
+	13317, 13381, 13445, 13509, 13573, 13637, 13701, 13765,
+	13829, 13893, 13957, 14021, 14085, 14149, 14213, 14277,
+	14341, 14405, 14469, 14533, 14597, 14661, 14725, 14789,
+	14853, 14917, 14981, 15045, 15110, 15174, 15238, 15302,
+	15366, 15430, 15494, 15558, 15622, 15686, 15750, 15814,
+	15878, 15942, 16006, 16070, 16134, 16198, 16262, 16326,
+	16390, 16454, 16518, 16582, 16646, 16710, 16774, 16838,
+	16902, 16966, 17030, 17094, 17158, 17222, 17286, 17350,
+	17414, 17478, 17542, 17606, 17670, 17734, 17799, 17863,
+	17927, 17991, 18055, 18119, 18183, 18247, 18311, 18375,
+	18439, 18503, 18567, 18631, 18695, 18759, 18823, 18887,
+	18951, 19015, 19079, 19143, 19207, 19271, 19335, 19399,
+	19463, 19527, 19591, 19655, 19719, 19783, 19847, 19911,
+	19975, 20039, 20103, 20167, 20231, 20295, 20359, 20423,
+	20487, 20552, 20616, 20680, 20744, 20808, 20872, 20936,
+	21000, 21064, 21128, 21192, 21256, 21320, 21384, 21448,
+	21512, 21576, 21640, 21704, 21768, 21832, 21896, 21960,
+	22024, 22088, 22152, 22216, 22280, 22344, 22408, 22472,
+	22536, 22600, 22664, 22728, 22792, 22856, 22920, 22984,
+	23048, 23112, 23176, 23240, 23305, 23369, 23433, 23497,
+	23561, 23625, 23689, 23753, 23817, 23881, 23945, 24009,
+	24073, 24137, 24201, 24265, 24329, 24393, 24457, 24521,
+	24585, 24649, 24713, 24777, 24841, 24905, 24969, 25033,
+	25097, 25161, 25225, 25289, 25353, 25417, 25481, 25545,
+	25609, 25673, 25737, 25801, 25865, 25929, 25993, 26058,
+	26122, 26186, 26250, 26314, 26378, 26442, 26506, 26570,
+	26634, 26698, 26762, 26826, 26890, 26954, 27018, 27082,
+	27146, 27210, 27274, 27338, 27402, 27466, 27530, 27594,
+	27658, 27722, 27786, 27850, 27914, 27978, 28042, 28106,
+	28170, 28234, 28298, 28362, 28426, 28490, 28554, 28618,
+	28682, 28747, 28811, 28875, 28939, 29003, 29067, 29131,
+	29195, 29259, 29323, 29387, 29451, 29515, 29579, 29643,
+	29707, 29771, 29835, 29899, 29963, 30027, 30091, 30155,
+	30219, 30283, 30347, 30411, 30475, 30539, 30603, 30667,
+	30731, 30795, 30859, 30923, 30987, 31051, 31115, 31179,
+	31243, 31307, 31371, 31435, 31499, 31564, 31628, 31692,
+	31756, 31820, 31884, 31948, 32012, 32076, 32140, 32204,
+	32268, 32332, 32396, 32460, 32524, 32588, 32651, 32717,
+	32767, 32717, 32651, 32588, 32524, 32460, 32396, 32332,
+	32268, 32204, 32140, 32076, 32012, 31948, 31884, 31820,
+	31756, 31692, 31628, 31564, 31499, 31435, 31371, 31307,
+	31243, 31179, 31115, 31051, 30987, 30923, 30859, 30795,
+	30731, 30667, 30603, 30539, 30475, 30411, 30347, 30283,
+	30219, 30155, 30091, 30027, 29963, 29899, 29835, 29771,
+	29707, 29643, 29579, 29515, 29451, 29387, 29323, 29259,
+	29195, 29131, 29067, 29003, 28939, 28875, 28811, 28747,
+	28682, 28618, 28554, 28490, 28426, 28362, 28298, 28234,
+	28170, 28106, 28042, 27978, 27914, 27850, 27786, 27722,
+	27658, 27594, 27530, 27466, 27402, 27338, 27274, 27210,
+	27146, 27082, 27018, 26954, 26890, 26826, 26762, 26698,
+	26634, 26570, 26506, 26442, 26378, 26314, 26250, 26186,
+	26122, 26058, 25993, 25929, 25865, 25801, 25737, 25673,
+	25609, 25545, 25481, 25417, 25353, 25289, 25225, 25161,
+	25097, 25033, 24969, 24905, 24841, 24777, 24713, 24649,
+	24585, 24521, 24457, 24393, 24329, 24265, 24201, 24137,
+	24073, 24009, 23945, 23881, 23817, 23753, 23689, 23625,
+	23561, 23497, 23433, 23369, 23305, 23240, 23176, 23112,
+	23048, 22984, 22920, 22856, 22792, 22728, 22664, 22600,
+	22536, 22472, 22408, 22344, 22280, 22216, 22152, 22088,
+	22024, 21960, 21896, 21832, 21768, 21704, 21640, 21576,
+	21512, 21448, 21384, 21320, 21256, 21192, 21128, 21064,
+	21000, 20936, 20872, 20808, 20744, 20680, 20616, 20552,
+	20487, 20423, 20359, 20295, 20231, 20167, 20103, 20039,
+	19975, 19911, 19847, 19783, 19719, 19655, 19591, 19527,
+	19463, 19399, 19335, 19271, 19207, 19143, 19079, 19015,
+	18951, 18887, 18823, 18759, 18695, 18631, 18567, 18503,
+	18439, 18375, 18311, 18247, 18183, 18119, 18055, 17991,
+	17927, 17863, 17799, 17734, 17670, 17606, 17542, 17478,
+	17414, 17350, 17286, 17222, 17158, 17094, 17030, 16966,
+	16902, 16838, 16774, 16710, 16646, 16582, 16518, 16454,
+	16390, 16326, 16262, 16198, 16134, 16070, 16006, 15942,
+	15878, 15814, 15750, 15686, 15622, 15558, 15494, 15430,
+	15366, 15302, 15238, 15174, 15110, 15045, 14981, 14917,
+	14853, 14789, 14725, 14661, 14597, 14533, 14469, 14405,
+	14341, 14277, 14213, 14149, 14085, 14021, 13957, 13893,
+	13829, 13765, 13701, 13637, 13573, 13509, 13445, 13381,
+	13317, 13253, 13189, 13125, 13061, 12997, 12933, 12869,
+	12805, 12741, 12677, 12613, 12549, 12485, 12421, 12357,
+	12292, 12228, 12164, 12100, 12036, 11972, 11908, 11844,
+	11780, 11716, 11652, 11588, 11524, 11460, 11396, 11332,
+	11268, 11204, 11140, 11076, 11012, 10948, 10884, 10820,
+	10756, 10692, 10628, 10564, 10500, 10436, 10372, 10308,
+	10244, 10180, 10116, 10052, 9988, 9924, 9860, 9796,
+	9732, 9668, 9604, 9539, 9475, 9411, 9347, 9283,
+	9219, 9155, 9091, 9027, 8963, 8899, 8835, 8771,
+	8707, 8643, 8579, 8515, 8451, 8387, 8323, 8259,
+	8195, 8131, 8067, 8003, 7939, 7875, 7811, 7747,
+	7683, 7619, 7555, 7491, 7427, 7363, 7299, 7235,
+	7171, 7107, 7043, 6979, 6915, 6851, 6786, 6722,
+	6658, 6594, 6530, 6466, 6402, 6338, 6274, 6210,
+	6146, 6082, 6018, 5954, 5890, 5826, 5762, 5698,
+	5634, 5570, 5506, 5442, 5378, 5314, 5250, 5186,
+	5122, 5058, 4994, 4930, 4866, 4802, 4738, 4674,
+	4610, 4546, 4482, 4418, 4354, 4290, 4226, 4162,
+	4097, 4033, 3969, 3905, 3841, 3777, 3713, 3649,
+	3585, 3521, 3457, 3393, 3329, 3265, 3201, 3137,
+	3073, 3009, 2945, 2881, 2817, 2753, 2689, 2625,
+	2561, 2497, 2433, 2369, 2305, 2241, 2177, 2113,
+	2049, 1985, 1921, 1857, 1793, 1729, 1665, 1601,
+	1537, 1473, 1409, 1344, 1280, 1216, 1152, 1088,
+	1024, 960, 896, 832, 768, 704, 640, 576,
+	512, 448, 384, 320, 256, 192, 128, 64,
+	0, -64, -128, -192, -256, -320, -384, -448,
+	-512, -576, -640, -704, -768, -832, -896, -960,
+	-1024, -1088, -1152, -1216, -1280, -1344, -1409, -1473,
+	-1537, -1601, -1665, -1729, -1793, -1857, -1921, -1985,
+	-2049, -2113, -2177, -2241, -2305, -2369, -2433, -2497,
+	-2561, -2625, -2689, -2753, -2817, -2881, -2945, -3009,
+	-3073, -3137, -3201, -3265, -3329, -3393, -3457, -3521,
+	-3585, -3649, -3713, -3777, -3841, -3905, -3969, -4033,
+	-4097, -4162, -4226, -4290, -4354, -4418, -4482, -4546,
+	-4610, -4674, -4738, -4802, -4866, -4930, -4994, -5058,
+	-5122, -5186, -5250, -5314, -5378, -5442, -5506, -5570,
+	-5634, -5698, -5762, -5826, -5890, -5954, -6018, -6082,
+	-6146, -6210, -6274, -6338, -6402, -6466, -6530, -6594,
+	-6658, -6722, -6786, -6851, -6915, -6979, -7043, -7107,
+	-7171, -7235, -7299, -7363, -7427, -7491, -7555, -7619,
+	-7683, -7747, -7811, -7875, -7939, -8003, -8067, -8131,
+	-8195, -8259, -8323, -8387, -8451, -8515, -8579, -8643,
+	-8707, -8771, -8835, -8899, -8963, -9027, -9091, -9155,
+	-9219, -9283, -9347, -9411, -9475, -9539, -9604, -9668,
+	-9732, -9796, -9860, -9924, -9988, -10052, -10116, -10180,
+	-10244, -10308, -10372, -10436, -10500, -10564, -10628, -10692,
+	-10756, -10820, -10884, -10948, -11012, -11076, -11140, -11204,
+	-11268, -11332, -11396, -11460, -11524, -11588, -11652, -11716,
+	-11780, -11844, -11908, -11972, -12036, -12100, -12164, -12228,
+	-12292, -12357, -12421, -12485, -12549, -12613, -12677, -12741,
+	-12805, -12869, -12933, -12997, -13061, -13125, -13189, -13253,
+	-13317, -13381, -13445, -13509, -13573, -13637, -13701, -13765,
+	-13829, -13893, -13957, -14021, -14085, -14149, -14213, -14277,
+	-14341, -14405, -14469, -14533, -14597, -14661, -14725, -14789,
+	-14853, -14917, -14981, -15045, -15110, -15174, -15238, -15302,
+	-15366, -15430, -15494, -15558, -15622, -15686, -15750, -15814,
+	-15878, -15942, -16006, -16070, -16134, -16198, -16262, -16326,
+	-16390, -16454, -16518, -16582, -16646, -16710, -16774, -16838,
+	-16902, -16966, -17030, -17094, -17158, -17222, -17286, -17350,
+	-17414, -17478, -17542, -17606, -17670, -17734, -17799, -17863,
+	-17927, -17991, -18055, -18119, -18183, -18247, -18311, -18375,
+	-18439, -18503, -18567, -18631, -18695, -18759, -18823, -18887,
+	-18951, -19015, -19079, -19143, -19207, -19271, -19335, -19399,
+	-19463, -19527, -19591, -19655, -19719, -19783, -19847, -19911,
+	-19975, -20039, -20103, -20167, -20231, -20295, -20359, -20423,
+	-20487, -20552, -20616, -20680, -20744, -20808, -20872, -20936,
+	-21000, -21064, -21128, -21192, -21256, -21320, -21384, -21448,
+	-21512, -21576, -21640, -21704, -21768, -21832, -21896, -21960,
+	-22024, -22088, -22152, -22216, -22280, -22344, -22408, -22472,
+	-22536, -22600, -22664, -22728, -22792, -22856, -22920, -22984,
+	-23048, -23112, -23176, -23240, -23305, -23369, -23433, -23497,
+	-23561, -23625, -23689, -23753, -23817, -23881, -23945, -24009,
+	-24073, -24137, -24201, -24265, -24329, -24393, -24457, -24521,
+	-24585, -24649, -24713, -24777, -24841, -24905, -24969, -25033,
+	-25097, -25161, -25225, -25289, -25353, -25417, -25481, -25545,
+	-25609, -25673, -25737, -25801, -25865, -25929, -25993, -26058,
+	-26122, -26186, -26250, -26314, -26378, -26442, -26506, -26570,
+	-26634, -26698, -26762, -26826, -26890, -26954, -27018, -27082,
+	-27146, -27210, -27274, -27338, -27402, -27466, -27530, -27594,
+	-27658, -27722, -27786, -27850, -27914, -27978, -28042, -28106,
+	-28170, -28234, -28298, -28362, -28426, -28490, -28554, -28618,
+	-28682, -28747, -28811, -28875, -28939, -29003, -29067, -29131,
+	-29195, -29259, -29323, -29387, -29451, -29515, -29579, -29643,
+	-29707, -29771, -29835, -29899, -29963, -30027, -30091, -30155,
+	-30219, -30283, -30347, -30411, -30475, -30539, -30603, -30667,
+	-30731, -30795, -30859, -30923, -30987, -31051, -31115, -31179,
+	-31243, -31307, -31371, -31435, -31499, -31564, -31628, -31692,
+	-31756, -31820, -31884, -31948, -32012, -32076, -32140, -32204,
+	-32268, -32332, -32396, -32460, -32524, -32588, -32651, -32717,
+	-32767,
+
+	/* Level 1: 2048 samples, 512 harmonics */
+	-32754, -32724, -32655, -32583, -32523, -32463, -32396, -32330,
+	-32267, -32206, -32140, -32074, -32012, -31949, -31884, -31819,
+	-31756, -31693, -31628, -31563, -31499, -31436, -31372, -31307,
+	-31243, -31180, -31115, -31051, -30987, -30924, -30859, -30795,
+	-30731, -30668, -30603, -30539, -30475, -30412, -30347, -30283,
+	-30219, -30155, -30091, -30027, -29963, -29899, -29835, -29771,
+	-29707, -29643, -29579, -29514, -29451, -29387, -29323, -29258,
+	-29195, -29131, -29067, -29002, -28939, -28875, -28811, -28746,
+	-28682, -28619, -28554, -28490, -28426, -28363, -28298, -28234,
+	-28170, -28106, -28042, -27978, -27914, -27850, -27786, -27722,
+	-27658, -27594, -27530, -27466, -27402, -27338, -27274, -27210,
+	-27146, -27082, -27018, -26954, -26890, -26826, -26762, -26698,
+	-26634, -26570, -26506, -26441, -26378, -26314, -26250, -26185,
+	-26122, -26058, -25993, -25929, -25865, -25802, -25737, -25673,
+	-25609, -25545, -25481, -25417, -25353, -25289, -25225, -25161,
+	-25097, -25033, -24969, -24905, -24841, -24777, -24713, -24649,
+	-24585, -24521, -24457, -24393, -24329, -24265, -24201, -24137,
+	-24073, -24009, -23945, -23881, -23817, -23753, -23689, -23625,
+	-23561, -23497, -23433, -23368, -23305, -23241, -23176, -23112,
+	-23048, -22985, -22920, -22856, -22792, -22728, -22664, -22600,
+	-22536, -22472, -22408, -22344, -22280, -22216, -22152, -22088,
+	-22024, -21960, -21896, -21832, -21768, -21704, -21640, -21576,
+	-21512, -21448, -21384, -21320, -21256, -21192, -21128, -21064,
+	-21000, -20936, -20872, -20808, -20744, -20680, -20616, -20551,
+	-20487, -20424, -20359, -20295, -20231, -20167, -20103, -20039,
+	-19975, -19911, -19847, -19783, -19719, -19655, -19591, -19527,
+	-19463, -19399, -19335, -19271, -19207, -19143, -19079, -19015,
+	-18951, -18887, -18823, -18759, -18695, -18631, -18567, -18503,
+	-18439, -18375, -18311, -18247, -18183, -18119, -18055, -17990,
+	-17927, -17863, -17799, -17734, -17670, -17607, -17542, -17478,
+	-17414, -17350, -17286, -17222, -17158, -17094, -17030, -16966,
+	-16902, -16838, -16774, -16710, -16646, -16582, -16518, -16454,
+	-16390, -16326, -16262, -16198, -16134, -16070, -16006, -15942,
+	-15878, -15814, -15750, -15686, -15622, -15558, -15494, -15430,
+	-15366, -15302, -15238, -15173, -15110, -15046, -14981, -14917,
+	-14853, -14789, -14725, -14661, -14597, -14533, -14469, -14405,
+	-14341, -14277, -14213, -14149, -14085, -14021, -13957, -13893,
+	-13829, -13765, -13701, -13637, -13573, -13509, -13445, -13381,
+	-13317, -13253, -13189, -13125, -13061, -12997, -12933, -12869,
+	-12805, -12741, -12677, -12613, -12549, -12485, -12421, -12356,
+	-12292, -12229, -12164, -12100, -12036, -11972, -11908, -11844,
+	-11780, -11716, -11652, -11588, -11524, -11460, -11396, -11332,
+	-11268, -11204, -11140, -11076, -11012, -10948, -10884, -10820,
+	-10756, -10692, -10628, -10564, -10500, -10436, -10372, -10308,
+	-10244, -10180, -10116, -10052, -9988, -9924, -9860, -9796,
+	-9732, -9668, -9604, -9539, -9475, -9411, -9347, -9283,
+	-9219, -9155, -9091, -9027, -8963, -8899, -8835, -8771,
+	-8707, -8643, -8579, -8515, -8451, -8387, -8323, -8259,
+	-8195, -8131, -8067, -8003, -7939, -7875, -7811, -7747,
+	-7683, -7619, -7555, -7491, -7427, -7363, -7299, -7235,
+	-7171, -7107, -7043, -6978, -6915, -6851, -6786, -6722,
+	-6658, -6594, -6530, -6466, -6402, -6338, -6274, -6210,
+	-6146, -6082, -6018, -5954, -5890, -5826, -5762, -5698,
+	-5634, -5570, -5506, -5442, -5378, -5314, -5250, -5186,
+	-5122, -5058, -4994, -4930, -4866, -4802, -4738, -4674,
+	-4610, -4546, -4482, -4418, -4354, -4290, -4226, -4161,
+	-4097, -4034, -3969, -3905, -3841, -3777, -3713, -3649,
+	-3585, -3521, -3457, -3393, -3329, -3265, -3201, -3137,
+	-3073, -3009, -2945, -2881, -2817, -2753, -2689, -2625,
+	-2561, -2497, -2433, -2369, -2305, -2241, -2177, -2113,
+	-2049, -1985, -1921, -1857, -1793, -1729, -1665, -1601,
+	-1537, -1473, -1409, -1344, -1280, -1216, -1152, -1088,
+	-1024, -960, -896, -832, -768, -704, -640, -576,
+	-512, -448, -384, -320, -256, -192, -128, -64,
+	0, 64, 128, 192, 256, 320, 384, 448,
+	512, 576, 640, 704, 768, 832, 896, 960,
+	1024, 1088, 1152, 1216, 1280, 1344, 1409, 1473,
+	1537, 1601, 1665, 1729, 1793, 1857, 1921, 1985,
+	2049, 2113, 2177, 2241, 2305, 2369, 2433, 2497,
+	2561, 2625, 2689, 2753, 2817, 2881, 2945, 3009,
+	3073, 3137, 3201, 3265, 3329, 3393, 3457, 3521,
+	3585, 3649, 3713, 3777, 3841, 3905, 3969, 4034,
+	4097, 4161, 4226, 4290, 4354, 4418, 4482, 4546,
+	4610, 4674, 4738, 4802, 4866, 4930, 4994, 5058,
+	5122, 5186, 5250, 5314, 5378, 5442, 5506, 5570,
+	5634, 5698, 5762, 5826, 5890, 5954, 6018, 6082,
+	6146, 6210, 6274, 6338, 6402, 6466, 6530, 6594,
+	6658, 6722, 6786, 6851, 6915, 6978, 7043, 7107,
+	7171, 7235, 7299, 7363, 7427, 7491, 7555, 7619,
+	7683, 7747, 7811, 7875, 7939, 8003, 8067, 8131,
+	8195, 8259, 8323, 8387, 8451, 8515, 8579, 8643,
+	8707, 8771, 8835, 8899, 8963, 9027, 9091, 9155,
+	9219, 9283, 9347, 9411, 9475, 9539, 9604, 9668,
+	9732, 9796, 9860, 9924, 9988, 10052, 10116, 10180,
+	10244, 10308, 10372, 10436, 10500, 10564, 10628, 10692,
+	10756, 10820, 10884, 10948, 11012, 11076, 11140, 11204,
+	11268, 11332, 11396, 11460, 11524, 11588, 11652, 11716,
+	11780, 11844, 11908, 11972, 12036, 12100, 12164, 12229,
+	12292, 12356, 12421, 12485, 12549, 12613, 12677, 12741,
+	12805, 12869, 12933, 12997, 13061, 13125, 13189, 13253,
+	13317, 13381, 13445, 13509, 13573, 13637, 13701, 13765,
+	13829, 13893, 13957, 14021, 14085, 14149, 14213, 14277,
+	14341, 14405, 14469, 14533, 14597, 14661, 14725, 14789,
+	14853, 14917, 14981, 15046, 15110, 15173, 15238, 15302,
+	15366, 15430, 15494, 15558, 15622, 15686, 15750, 15814,
+	15878, 15942, 16006, 16070, 16134, 16198, 16262, 16326,
+	16390, 16454, 16518, 16582, 16646, 16710, 16774, 16838,
+	16902, 16966, 17030, 17094, 17158, 17222, 17286, 17350,
+	17414, 17478, 17542, 17607, 17670, 17734, 17799, 17863,
+	17927, 17990, 18055, 18119, 18183, 18247, 18311, 18375,
+	18439, 18503, 18567, 18631, 18695, 18759, 18823, 18887,
+	18951, 19015, 19079, 19143, 19207, 19271, 19335, 19399,
+	19463, 19527, 19591, 19655, 19719, 19783, 19847, 19911,
+	19975, 20039, 20103, 20167, 20231, 20295, 20359, 20424,
+	20487, 20551, 20616, 20680, 20744, 20808, 20872, 20936,
+	21000, 21064, 21128, 21192, 21256, 21320, 21384, 21448,
+	21512, 21576, 21640, 21704, 21768, 21832, 21896, 21960,
+	22024, 22088, 22152, 22216, 22280, 22344, 22408, 22472,
+	22536, 22600, 22664, 22728, 22792, 22856, 22920, 22985,
+	23048, 23112, 23176, 23241, 23305, 23368, 23433, 23497,
+	23561, 23625, 23689, 23753, 23817, 23881, 23945, 24009,
+	24073, 24137, 24201, 24265, 24329, 24393, 24457, 24521,
+	24585, 24649, 24713, 24777, 24841, 24905, 24969, 25033,
+	25097, 25161, 25225, 25289, 25353, 25417, 25481, 25545,
+	25609, 25673, 25737, 25802, 25865, 25929, 25993, 26058,
+	26122, 26185, 26250, 26314, 26378, 26441, 26506, 26570,
+	26634, 26698, 26762, 26826, 26890, 26954, 27018, 27082,
+	27146, 27210, 27274, 27338, 27402, 27466, 27530, 27594,
+	27658, 27722, 27786, 27850, 27914, 27978, 28042, 28106,
+	28170, 28234, 28298, 28363, 28426, 28490, 28554, 28619,
+	28682, 28746, 28811, 28875, 28939, 29002, 29067, 29131,
+	29195, 29258, 29323, 29387, 29451, 29514, 29579, 29643,
+	29707, 29771, 29835, 29899, 29963, 30027, 30091, 30155,
+	30219, 30283, 30347, 30412, 30475, 30539, 30603, 30668,
+	30731, 30795, 30859, 30924, 30987, 31051, 31115, 31180,
+	31243, 31307, 31372, 31436, 31499, 31563, 31628, 31693,
+	31756, 31819, 31884, 31949, 32012, 32074, 32140, 32206,
+	32267, 32330, 32396, 32463, 32523, 32583, 32655, 32724,
+	32754, 32724, 32655, 32583, 32523, 32463, 32396, 32330,
+	32267, 32206, 32140, 32074, 32012, 31949, 31884, 31819,
+	31756, 31693, 31628, 31563, 31499, 31436, 31372, 31307,
+	31243, 31180, 31115, 31051, 30987, 30924, 30859, 30795,
+	30731, 30668, 30603, 30539, 30475, 30412, 30347, 30283,
+	30219, 30155, 30091, 30027, 29963, 29899, 29835, 29771,
+	29707, 29643, 29579, 29514, 29451, 29387, 29323, 29258,
+	29195, 29131, 29067, 29002, 28939, 28875, 28811, 28746,
+	28682, 28619, 28554, 28490, 28426, 28363, 28298, 28234,
+	28170, 28106, 28042, 27978, 27914, 27850, 27786, 27722,
+	27658, 27594, 27530, 27466, 27402, 27338, 27274, 27210,
+	27146, 27082, 27018, 26954, 26890, 26826, 26762, 26698,
+	26634, 26570, 26506, 26441, 26378, 26314, 26250, 26185,
+	26122, 26058, 25993, 25929, 25865, 25802, 25737, 25673,
+	25609, 25545, 25481, 25417, 25353, 25289, 25225, 25161,
+	25097, 25033, 24969, 24905, 24841, 24777, 24713, 24649,
+	24585, 24521, 24457, 24393, 24329, 24265, 24201, 24137,
+	24073, 24009, 23945, 23881, 23817, 23753, 23689, 23625,
+	23561, 23497, 23433, 23368, 23305, 23241, 23176, 23112,
+	23048, 22985, 22920, 22856, 22792, 22728, 22664, 22600,
+	22536, 22472, 22408, 22344, 22280, 22216, 22152, 22088,
+	22024, 21960, 21896, 21832, 21768, 21704, 21640, 21576,
+	21512, 21448, 21384, 21320, 21256, 21192, 21128, 21064,
+	21000, 20936, 20872, 20808, 20744, 20680, 20616, 20551,
+	20487, 20424, 20359, 20295, 20231, 20167, 20103, 20039,
+	19975, 19911, 19847, 19783, 19719, 19655, 19591, 19527,
+	19463, 19399, 19335, 19271, 19207, 19143, 19079, 19015,
+	18951, 18887, 18823, 18759, 18695, 18631, 18567, 18503,
+	18439, 18375, 18311, 18247, 18183, 18119, 18055, 17990,
+	17927, 17863, 17799, 17734, 17670, 17607, 17542, 17478,
+	17414, 17350, 17286, 17222, 17158, 17094, 17030, 16966,
+	16902, 16838, 16774, 16710, 16646, 16582, 16518, 16454,
+	16390, 16326, 16262, 16198, 16134, 16070, 16006, 15942,
+	15878, 15814, 15750, 15686, 15622, 15558, 15494, 15430,
+	15366, 15302, 15238, 15173, 15110, 15046, 14981, 14917,
+	14853, 14789, 14725, 14661, 14597, 14533, 14469, 14405,
+	14341, 14277, 14213, 14149, 14085, 14021, 13957, 13893,
+	13829, 13765, 13701, 13637, 13573, 13509, 13445, 13381,
+	13317, 13253, 13189, 13125, 13061, 12997, 12933, 12869,
+	12805, 12741, 12677, 12613, 12549, 12485, 12421, 12356,
+	12292, 12229, 12164, 12100, 12036, 11972, 11908, 11844,
+	11780, 11716, 11652, 11588, 11524, 11460, 11396, 11332,
+	11268, 11204, 11140, 11076, 11012, 10948, 10884, 10820,
+	10756, 10692, 10628, 10564, 10500, 10436, 10372, 10308,
+	10244, 10180, 10116, 10052, 9988, 9924, 9860, 9796,
+	9732, 9668, 9604, 9539, 9475, 9411, 9347, 9283,
+	9219, 9155, 9091, 9027, 8963, 8899, 8835, 8771,
+	8707, 8643, 8579, 8515, 8451, 8387, 8323, 8259,
+	8195, 8131, 8067, 8003, 7939, 7875, 7811, 7747,
+	7683, 7619, 7555, 7491, 7427, 7363, 7299, 7235,
+	7171, 7107, 7043, 6978, 6915, 6851, 6786, 6722,
+	6658, 6594, 6530, 6466, 6402, 6338, 6274, 6210,
+	6146, 6082, 6018, 5954, 5890, 5826, 5762, 5698,
+	5634, 5570, 5506, 5442, 5378, 5314, 5250, 5186,
+	5122, 5058, 4994, 4930, 4866, 4802, 4738, 4674,
+	4610, 4546, 4482, 4418, 4354, 4290, 4226, 4161,
+	4097, 4034, 3969, 3905, 3841, 3777, 3713, 3649,
+	3585, 3521, 3457, 3393, 3329, 3265, 3201, 3137,
+	3073, 3009, 2945, 2881, 2817, 2753, 2689, 2625,
+	2561, 2497, 2433, 2369, 2305, 2241, 2177, 2113,
+	2049, 1985, 1921, 1857, 1793, 1729, 1665, 1601,
+	1537, 1473, 1409, 1344, 1280, 1216, 1152, 1088,
+	1024, 960, 896, 832, 768, 704, 640, 576,
+	512, 448, 384, 320, 256, 192, 128, 64,
+	0, -64, -128, -192, -256, -320, -384, -448,
+	-512, -576, -640, -704, -768, -832, -896, -960,
+	-1024, -1088, -1152, -1216, -1280, -1344, -1409, -1473,
+	-1537, -1601, -1665, -1729, -1793, -1857, -1921, -1985,
+	-2049, -2113, -2177, -2241, -2305, -2369, -2433, -2497,
+	-2561, -2625, -2689, -2753, -2817, -2881, -2945, -3009,
+	-3073, -3137, -3201, -3265, -3329, -3393, -3457, -3521,
+	-3585, -3649, -3713, -3777, -3841, -3905, -3969, -4034,
+	-4097, -4161, -4226, -4290, -4354, -4418, -4482, -4546,
+	-4610, -4674, -4738, -4802, -4866, -4930, -4994, -5058,
+	-5122, -5186, -5250, -5314, -5378, -5442, -5506, -5570,
+	-5634, -5698, -5762, -5826, -5890, -5954, -6018, -6082,
+	-6146, -6210, -6274, -6338, -6402, -6466, -6530, -6594,
+	-6658, -6722, -6786, -6851, -6915, -6978, -7043, -7107,
+	-7171, -7235, -7299, -7363, -7427, -7491, -7555, -7619,
+	-7683, -7747, -7811, -7875, -7939, -8003, -8067, -8131,
+	-8195, -8259, -8323, -8387, -8451, -8515, -8579, -8643,
+	-8707, -8771, -8835, -8899, -8963, -9027, -9091, -9155,
+	-9219, -9283, -9347, -9411, -9475, -9539, -9604, -9668,
+	-9732, -9796, -9860, -9924, -9988, -10052, -10116, -10180,
+	-10244, -10308, -10372, -10436, -10500, -10564, -10628, -10692,
+	-10756, -10820, -10884, -10948, -11012, -11076, -11140, -11204,
+	-11268, -11332, -11396, -11460, -11524, -11588, -11652, -11716,
+	-11780, -11844, -11908, -11972, -12036, -12100, -12164, -12229,
+	-12292, -12356, -12421, -12485, -12549, -12613, -12677, -12741,
+	-12805, -12869, -12933, -12997, -13061, -13125, -13189, -13253,
+	-13317, -13381, -13445, -13509, -13573, -13637, -13701, -13765,
+	-13829, -13893, -13957, -14021, -14085, -14149, -14213, -14277,
+	-14341, -14405, -14469, -14533, -14597, -14661, -14725, -14789,
+	-14853, -14917, -14981, -15046, -15110, -15173, -15238, -15302,
+	-15366, -15430, -15494, -15558, -15622, -15686, -15750, -15814,
+	-15878, -15942, -16006, -16070, -16134, -16198, -16262, -16326,
+	-16390, -16454, -16518, -16582, -16646, -16710, -16774, -16838,
+	-16902, -16966, -17030, -17094, -17158, -17222, -17286, -17350,
+	-17414, -17478, -17542, -17607, -17670, -17734, -17799, -17863,
+	-17927, -17990, -18055, -18119, -18183, -18247, -18311, -18375,
+	-18439, -18503, -18567, -18631, -18695, -18759, -18823, -18887,
+	-18951, -19015, -19079, -19143, -19207, -19271, -19335, -19399,
+	-19463, -19527, -19591, -19655, -19719, -19783, -19847, -19911,
+	-19975, -20039, -20103, -20167, -20231, -20295, -20359, -20424,
+	-20487, -20551, -20616, -20680, -20744, -20808, -20872, -20936,
+	-21000, -21064, -21128, -21192, -21256, -21320, -21384, -21448,
+	-21512, -21576, -21640, -21704, -21768, -21832, -21896, -21960,
+	-22024, -22088, -22152, -22216, -22280, -22344, -22408, -22472,
+	-22536, -22600, -22664, -22728, -22792, -22856, -22920, -22985,
+	-23048, -23112, -23176, -23241, -23305, -23368, -23433, -23497,
+	-23561, -23625, -23689, -23753, -23817, -23881, -23945, -24009,
+	-24073, -24137, -24201, -24265, -24329, -24393, -24457, -24521,
+	-24585, -24649, -24713, -24777, -24841, -24905, -24969, -25033,
+	-25097, -25161, -25225, -25289, -25353, -25417, -25481, -25545,
+	-25609, -25673, -25737, -25802, -25865, -25929, -25993, -26058,
+	-26122, -26185, -26250, -26314, -26378, -26441, -26506, -26570,
+	-26634, -26698, -26762, -26826, -26890, -26954, -27018, -27082,
+	-27146, -27210, -27274, -27338, -27402, -27466, -27530, -27594,
+	-27658, -27722, -27786, -27850, -27914, -27978, -28042, -28106,
+	-28170, -28234, -28298, -28363, -28426, -28490, -28554, -28619,
+	-28682, -28746, -28811, -28875, -28939, -29002, -29067, -29131,
+	-29195, -29258, -29323, -29387, -29451, -29514, -29579, -29643,
+	-29707, -29771, -29835, -29899, -29963, -30027, -30091, -30155,
+	-30219, -30283, -30347, -30412, -30475, -30539, -30603, -30668,
+	-30731, -30795, -30859, -30924, -30987, -31051, -31115, -31180,
+	-31243, -31307, -31372, -31436, -31499, -31563, -31628, -31693,
+	-31756, -31819, -31884, -31949, -32012, -32074, -32140, -32206,
+	-32267, -32330, -32396, -32463, -32523, -32583, -32655, -32724,
+	-32754,
+
+	/* Level 2: 1024 samples, 256 harmonics */
+	-32728, -32668, -32530, -32387, -32266, -32146, -32013, -31879,
+	-31755, -31631, -31500, -31369, -31243, -31118, -30988, -30857,
+	-30731, -30605, -30475, -30345, -30219, -30093, -29963, -29833,
+	-29707, -29580, -29451, -29321, -29195, -29068, -28939, -28809,
+	-28682, -28555, -28426, -28297, -28170, -28043, -27914, -27785,
+	-27658, -27531, -27402, -27273, -27146, -27019, -26890, -26761,
+	-26634, -26506, -26378, -26249, -26122, -25994, -25865, -25737,
+	-25609, -25482, -25353, -25225, -25097, -24970, -24841, -24712,
+	-24585, -24457, -24329, -24200, -24073, -23945, -23817, -23688,
+	-23561, -23433, -23305, -23176, -23048, -22921, -22792, -22664,
+	-22536, -22409, -22280, -22152, -22024, -21896, -21768, -21640,
+	-21512, -21384, -21256, -21127, -21000, -20872, -20744, -20615,
+	-20487, -20360, -20231, -20103, -19975, -19848, -19719, -19591,
+	-19463, -19335, -19207, -19079, -18951, -18823, -18695, -18566,
+	-18439, -18311, -18183, -18054, -17927, -17799, -17670, -17542,
+	-17414, -17287, -17158, -17030, -16902, -16774, -16646, -16518,
+	-16390, -16262, -16134, -16006, -15878, -15750, -15622, -15493,
+	-15366, -15238, -15110, -14981, -14853, -14726, -14597, -14469,
+	-14341, -14213, -14085, -13957, -13829, -13701, -13573, -13445,
+	-13317, -13189, -13061, -12932, -12805, -12677, -12549, -12420,
+	-12292, -12165, -12036, -11908, -11780, -11652, -11524, -11396,
+	-11268, -11140, -11012, -10884, -10756, -10628, -10500, -10372,
+	-10244, -10116, -9988, -9859, -9732, -9604, -9475, -9347,
+	-9219, -9092, -8963, -8835, -8707, -8579, -8451, -8323,
+	-8195, -8067, -7939, -7811, -7683, -7555, -7427, -7298,
+	-7171, -7043, -6915, -6786, -6658, -6531, -6402, -6274,
+	-6146, -6018, -5890, -5762, -5634, -5506, -5378, -5250,
+	-5122, -4994, -4866, -4738, -4610, -4482, -4354, -4225,
+	-4097, -3970, -3841, -3713, -3585, -3457, -3329, -3201,
+	-3073, -2945, -2817, -2689, -2561, -2433, -2305, -2177,
+	-2049, -1921, -1793, -1664, -1537, -1409, -1280, -1152,
+	-1024, -897, -768, -640, -512, -384, -256, -128,
+	0, 128, 256, 384, 512, 640, 768, 897,
+	1024, 1152, 1280, 1409, 1537, 1664, 1793, 1921,
+	2049, 2177, 2305, 2433, 2561, 2689, 2817, 2945,
+	3073, 3201, 3329, 3457, 3585, 3713, 3841, 3970,
+	4097, 4225, 4354, 4482, 4610, 4738, 4866, 4994,
+	5122, 5250, 5378, 5506, 5634, 5762, 5890, 6018,
+	6146, 6274, 6402, 6531, 6658, 6786, 6915, 7043,
+	7171, 7298, 7427, 7555, 7683, 7811, 7939, 8067,
+	8195, 8323, 8451, 8579, 8707, 8835, 8963, 9092,
+	9219, 9347, 9475, 9604, 9732, 9859, 9988, 10116,
+	10244, 10372, 10500, 10628, 10756, 10884, 11012, 11140,
+	11268, 11396, 11524, 11652, 11780, 11908, 12036, 12165,
+	12292, 12420, 12549, 12677, 12805, 12932, 13061, 13189,
+	13317, 13445, 13573, 13701, 13829, 13957, 14085, 14213,
+	14341, 14469, 14597, 14726, 14853, 14981, 15110, 15238,
+	15366, 15493, 15622, 15750, 15878, 16006, 16134, 16262,
+	16390, 16518, 16646, 16774, 16902, 17030, 17158, 17287,
+	17414, 17542, 17670, 17799, 17927, 18054, 18183, 18311,
+	18439, 18566, 18695, 18823, 18951, 19079, 19207, 19335,
+	19463, 19591, 19719, 19848, 19975, 20103, 20231, 20360,
+	20487, 20615, 20744, 20872, 21000, 21127, 21256, 21384,
+	21512, 21640, 21768, 21896, 22024, 22152, 22280, 22409,
+	22536, 22664, 22792, 22921, 23048, 23176, 23305, 23433,
+	23561, 23688, 23817, 23945, 24073, 24200, 24329, 24457,
+	24585, 24712, 24841, 24970, 25097, 25225, 25353, 25482,
+	25609, 25737, 25865, 25994, 26122, 26249, 26378, 26506,
+	26634, 26761, 26890, 27019, 27146, 27273, 27402, 27531,
+	27658, 27785, 27914, 28043, 28170, 28297, 28426, 28555,
+	28682, 28809, 28939, 29068, 29195, 29321, 29451, 29580,
+	29707, 29833, 29963, 30093, 30219, 30345, 30475, 30605,
+	30731, 30857, 30988, 31118, 31243, 31369, 31500, 31631,
+	31755, 31879, 32013, 32146, 32266, 32387, 32530, 32668,
+	32728, 32668, 32530, 32387, 32266, 32146, 32013, 31879,
+	31755, 31631, 31500, 31369, 31243, 31118, 30988, 30857,
+	30731, 30605, 30475, 30345, 30219, 30093, 29963, 29833,
+	29707, 29580, 29451, 29321, 29195, 29068, 28939, 28809,
+	28682, 28555, 28426, 28297, 28170, 28043, 27914, 27785,
+	27658, 27531, 27402, 27273, 27146, 27019, 26890, 26761,
+	26634, 26506, 26378, 26249, 26122, 25994, 25865, 25737,
+	25609, 25482, 25353, 25225, 25097, 24970, 24841, 24712,
+	24585, 24457, 24329, 24200, 24073, 23945, 23817, 23688,
+	23561, 23433, 23305, 23176, 23048, 22921, 22792, 22664,
+	22536, 22409, 22280, 22152, 22024, 21896, 21768, 21640,
+	21512, 21384, 21256, 21127, 21000, 20872, 20744, 20615,
+	20487, 20360, 20231, 20103, 19975, 19848, 19719, 19591,
+	19463, 19335, 19207, 19079, 18951, 18823, 18695, 18566,
+	18439, 18311, 18183, 18054, 17927, 17799, 17670, 17542,
+	17414, 17287, 17158, 17030, 16902, 16774, 16646, 16518,
+	16390, 16262, 16134, 16006, 15878, 15750, 15622, 15493,
+	15366, 15238, 15110, 14981, 14853, 14726, 14597, 14469,
+	14341, 14213, 14085, 13957, 13829, 13701, 13573, 13445,
+	13317, 13189, 13061, 12932, 12805, 12677, 12549, 12420,
+	12292, 12165, 12036, 11908, 11780, 11652, 11524, 11396,
+	11268, 11140, 11012, 10884, 10756, 10628, 10500, 10372,
+	10244, 10116, 9988, 9859, 9732, 9604, 9475, 9347,
+	9219, 9092, 8963, 8835, 8707, 8579, 8451, 8323,
+	8195, 8067, 7939, 7811, 7683, 7555, 7427, 7298,
+	7171, 7043, 6915, 6786, 6658, 6531, 6402, 6274,
+	6146, 6018, 5890, 5762, 5634, 5506, 5378, 5250,
+	5122, 4994, 4866, 4738, 4610, 4482, 4354, 4225,
+	4097, 3970, 3841, 3713, 3585, 3457, 3329, 3201,
+	3073, 2945, 2817, 2689, 2561, 2433, 2305, 2177,
+	2049, 1921, 1793, 1664, 1537, 1409, 1280, 1152,
+	1024, 897, 768, 640, 512, 384, 256, 128,
+	0, -128, -256, -384, -512, -640, -768, -897,
+	-1024, -1152, -1280, -1409, -1537, -1664, -1793, -1921,
+	-2049, -2177, -2305, -2433, -2561, -2689, -2817, -2945,
+	-3073, -3201, -3329, -3457, -3585, -3713, -3841, -3970,
+	-4097, -4225, -4354, -4482, -4610, -4738, -4866, -4994,
+	-5122, -5250, -5378, -5506, -5634, -5762, -5890, -6018,
+	-6146, -6274, -6402, -6531, -6658, -6786, -6915, -7043,
+	-7171, -7298, -7427, -7555, -7683, -7811, -7939, -8067,
+	-8195, -8323, -8451, -8579, -8707, -8835, -8963, -9092,
+	-9219, -9347, -9475, -9604, -9732, -9859, -9988, -10116,
+	-10244, -10372, -10500, -10628, -10756, -10884, -11012, -11140,
+	-11268, -11396, -11524, -11652, -11780, -11908, -12036, -12165,
+	-12292, -12420, -12549, -12677, -12805, -12932, -13061, -13189,
+	-13317, -13445, -13573, -13701, -13829, -13957, -14085, -14213,
+	-14341, -14469, -14597, -14726, -14853, -14981, -15110, -15238,
+	-15366, -15493, -15622, -15750, -15878, -16006, -16134, -16262,
+	-16390, -16518, -16646, -16774, -16902, -17030, -17158, -17287,
+	-17414, -17542, -17670, -17799, -17927, -18054, -18183, -18311,
+	-18439, -18566, -18695, -18823, -18951, -19079, -19207, -19335,
+	-19463, -19591, -19719, -19848, -19975, -20103, -20231, -20360,
+	-20487, -20615, -20744, -20872, -21000, -21127, -21256, -21384,
+	-21512, -21640, -21768, -21896, -22024, -22152, -22280, -22409,
+	-22536, -22664, -22792, -22921, -23048, -23176, -23305, -23433,
+	-23561, -23688, -23817, -23945, -24073, -24200, -24329, -24457,
+	-24585, -24712, -24841, -24970, -25097, -25225, -25353, -25482,
+	-25609, -25737, -25865, -25994, -26122, -26249, -26378, -26506,
+	-26634, -26761, -26890, -27019, -27146, -27273, -27402, -27531,
+	-27658, -27785, -27914, -28043, -28170, -28297, -28426, -28555,
+	-28682, -28809, -28939, -29068, -29195, -29321, -29451, -29580,
+	-29707, -29833, -29963, -30093, -30219, -30345, -30475, -30605,
+	-30731, -30857, -30988, -31118, -31243, -31369, -31500, -31631,
+	-31755, -31879, -32013, -32146, -32266, -32387, -32530, -32668,
+	-32728,
+
+	/* Level 3: 512 samples, 128 harmonics */
+	-32676, -32556, -32280, -31993, -31751, -31512, -31246, -30978,
+	-30730, -30482, -30220, -29957, -29706, -29456, -29195, -28934,
+	-28682, -28430, -28171, -27911, -27658, -27405, -27146, -26887,
+	-26634, -26380, -26122, -25863, -25609, -25356, -25097, -24839,
+	-24585, -24331, -24073, -23815, -23561, -23306, -23048, -22791,
+	-22536, -22282, -22024, -21766, -21512, -21257, -21000, -20742,
+	-20487, -20233, -19975, -19718, -19463, -19208, -18951, -18694,
+	-18439, -18184, -17927, -17669, -17414, -17159, -16902, -16645,
+	-16390, -16135, -15878, -15621, -15366, -15111, -14853, -14596,
+	-14341, -14086, -13829, -13572, -13317, -13062, -12805, -12548,
+	-12292, -12037, -11780, -11523, -11268, -11013, -10756, -10499,
+	-10244, -9989, -9732, -9475, -9219, -8964, -8707, -8450,
+	-8195, -7940, -7683, -7426, -7171, -6915, -6658, -6401,
+	-6146, -5891, -5634, -5377, -5122, -4867, -4610, -4353,
+	-4097, -3842, -3585, -3328, -3073, -2818, -2561, -2304,
+	-2049, -1793, -1537, -1280, -1024, -769, -512, -255,
+	0, 255, 512, 769, 1024, 1280, 1537, 1793,
+	2049, 2304, 2561, 2818, 3073, 3328, 3585, 3842,
+	4097, 4353, 4610, 4867, 5122, 5377, 5634, 5891,
+	6146, 6401, 6658, 6915, 7171, 7426, 7683, 7940,
+	8195, 8450, 8707, 8964, 9219, 9475, 9732, 9989,
+	10244, 10499, 10756, 11013, 11268, 11523, 11780, 12037,
+	12292, 12548, 12805, 13062, 13317, 13572, 13829, 14086,
+	14341, 14596, 14853, 15111, 15366, 15621, 15878, 16135,
+	16390, 16645, 16902, 17159, 17414, 17669, 17927, 18184,
+	18439, 18694, 18951, 19208, 19463, 19718, 19975, 20233,
+	20487, 20742, 21000, 21257, 21512, 21766, 22024, 22282,
+	22536, 22791, 23048, 23306, 23561, 23815, 24073, 24331,
+	24585, 24839, 25097, 25356, 25609, 25863, 26122, 26380,
+	26634, 26887, 27146, 27405, 27658, 27911, 28171, 28430,
+	28682, 28934, 29195, 29456, 29706, 29957, 30220, 30482,
+	30730, 30978, 31246, 31512, 31751, 31993, 32280, 32556,
+	32676, 32556, 32280, 31993, 31751, 31512, 31246, 30978,
+	30730, 30482, 30220, 29957, 29706, 29456, 29195, 28934,
+	28682, 28430, 28171, 27911, 27658, 27405, 27146, 26887,
+	26634, 26380, 26122, 25863, 25609, 25356, 25097, 24839,
+	24585, 24331, 24073, 23815, 23561, 23306, 23048, 22791,
+	22536, 22282, 22024, 21766, 21512, 21257, 21000, 20742,
+	20487, 20233, 19975, 19718, 19463, 19208, 18951, 18694,
+	18439, 18184, 17927, 17669, 17414, 17159, 16902, 16645,
+	16390, 16135, 15878, 15621, 15366, 15111, 14853, 14596,
+	14341, 14086, 13829, 13572, 13317, 13062, 12805, 12548,
+	12292, 12037, 11780, 11523, 11268, 11013, 10756, 10499,
+	10244, 9989, 9732, 9475, 9219, 8964, 8707, 8450,
+	8195, 7940, 7683, 7426, 7171, 6915, 6658, 6401,
+	6146, 5891, 5634, 5377, 5122, 4867, 4610, 4353,
+	4097, 3842, 3585, 3328, 3073, 2818, 2561, 2304,
+	2049, 1793, 1537, 1280, 1024, 769, 512, 255,
+	0, -255, -512, -769, -1024, -1280, -1537, -1793,
+	-2049, -2304, -2561, -2818, -3073, -3328, -3585, -3842,
+	-4097, -4353, -4610, -4867, -5122, -5377, -5634, -5891,
+	-6146, -6401, -6658, -6915, -7171, -7426, -7683, -7940,
+	-8195, -8450, -8707, -8964, -9219, -9475, -9732, -9989,
+	-10244, -10499, -10756, -11013, -11268, -11523, -11780, -12037,
+	-12292, -12548, -12805, -13062, -13317, -13572, -13829, -14086,
+	-14341, -14596, -14853, -15111, -15366, -15621, -15878, -16135,
+	-16390, -16645, -16902, -17159, -17414, -17669, -17927, -18184,
+	-18439, -18694, -18951, -19208, -19463, -19718, -19975, -20233,
+	-20487, -20742, -21000, -21257, -21512, -21766, -22024, -22282,
+	-22536, -22791, -23048, -23306, -23561, -23815, -24073, -24331,
+	-24585, -24839, -25097, -25356, -25609, -25863, -26122, -26380,
+	-26634, -26887, -27146, -27405, -27658, -27911, -28171, -28430,
+	-28682, -28934, -29195, -29456, -29706, -29957, -30220, -30482,
+	-30730, -30978, -31246, -31512, -31751, -31993, -32280, -32556,
+	-32676,
+
+	/* Level 4: 256 samples, 64 harmonics */
+	-32572, -32333, -31780, -31207, -30723, -30244, -29711, -29177,
+	-28680, -28185, -27660, -27134, -26633, -26132, -25610, -25088,
+	-24584, -24081, -23561, -23041, -22536, -22031, -21512, -20994,
+	-20487, -19981, -19463, -18946, -18439, -17932, -17415, -16897,
+	-16390, -15882, -15366, -14849, -14341, -13833, -13317, -12801,
+	-12292, -11784, -11268, -10752, -10244, -9735, -9219, -8704,
+	-8195, -7686, -7171, -6655, -6146, -5637, -5122, -4606,
+	-4097, -3589, -3073, -2558, -2049, -1540, -1024, -509,
+	0, 509, 1024, 1540, 2049, 2558, 3073, 3589,
+	4097, 4606, 5122, 5637, 6146, 6655, 7171, 7686,
+	8195, 8704, 9219, 9735, 10244, 10752, 11268, 11784,
+	12292, 12801, 13317, 13833, 14341, 14849, 15366, 15882,
+	16390, 16897, 17415, 17932, 18439, 18946, 19463, 19981,
+	20487, 20994, 21512, 22031, 22536, 23041, 23561, 24081,
+	24584, 25088, 25610, 26132, 26633, 27134, 27660, 28185,
+	28680, 29177, 29711, 30244, 30723, 31207, 31780, 32333,
+	32572, 32333, 31780, 31207, 30723, 30244, 29711, 29177,
+	28680, 28185, 27660, 27134, 26633, 26132, 25610, 25088,
+	24584, 24081, 23561, 23041, 22536, 22031, 21512, 20994,
+	20487, 19981, 19463, 18946, 18439, 17932, 17415, 16897,
+	16390, 15882, 15366, 14849, 14341, 13833, 13317, 12801,
+	12292, 11784, 11268, 10752, 10244, 9735, 9219, 8704,
+	8195, 7686, 7171, 6655, 6146, 5637, 5122, 4606,
+	4097, 3589, 3073, 2558, 2049, 1540, 1024, 509,
+	0, -509, -1024, -1540, -2049, -2558, -3073, -3589,
+	-4097, -4606, -5122, -5637, -6146, -6655, -7171, -7686,
+	-8195, -8704, -9219, -9735, -10244, -10752, -11268, -11784,
+	-12292, -12801, -13317, -13833, -14341, -14849, -15366, -15882,
+	-16390, -16897, -17415, -17932, -18439, -18946, -19463, -19981,
+	-20487, -20994, -21512, -22031, -22536, -23041, -23561, -24081,
+	-24584, -25088, -25610, -26132, -26633, -27134, -27660, -28185,
+	-28680, -29177, -29711, -30244, -30723, -31207, -31780, -32333,
+	-32572,
+
+	/* Level 5: 256 samples, 32 harmonics */
+	-32365, -32239, -31886, -31372, -30780, -30185, -29633, -29133,
+	-28666, -28199, -27707, -27185, -26642, -26099, -25572, -25069,
+	-24580, -24092, -23590, -23071, -22539, -22008, -21487, -20981,
+	-20485, -19990, -19485, -18967, -18440, -17914, -17395, -16888,
+	-16389, -15890, -15383, -14866, -14342, -13818, -13301, -12793,
+	-12292, -11791, -11283, -10767, -10244, -9722, -9205, -8697,
+	-8195, -7692, -7184, -6668, -6146, -5625, -5109, -4600,
+	-4097, -3594, -3086, -2570, -2049, -1527, -1011, -503,
+	0, 503, 1011, 1527, 2049, 2570, 3086, 3594,
+	4097, 4600, 5109, 5625, 6146, 6668, 7184, 7692,
+	8195, 8697, 9205, 9722, 10244, 10767, 11283, 11791,
+	12292, 12793, 13301, 13818, 14342, 14866, 15383, 15890,
+	16389, 16888, 17395, 17914, 18440, 18967, 19485, 19990,
+	20485, 20981, 21487, 22008, 22539, 23071, 23590, 24092,
+	24580, 25069, 25572, 26099, 26642, 27185, 27707, 28199,
+	28666, 29133, 29633, 30185, 30780, 31372, 31886, 32239,
+	32365, 32239, 31886, 31372, 30780, 30185, 29633, 29133,
+	28666, 28199, 27707, 27185, 26642, 26099, 25572, 25069,
+	24580, 24092, 23590, 23071, 22539, 22008, 21487, 20981,
+	20485, 19990, 19485, 18967, 18440, 17914, 17395, 16888,
+	16389, 15890, 15383, 14866, 14342, 13818, 13301, 12793,
+	12292, 11791, 11283, 10767, 10244, 9722, 9205, 8697,
+	8195, 7692, 7184, 6668, 6146, 5625, 5109, 4600,
+	4097, 3594, 3086, 2570, 2049, 1527, 1011, 503,
+	0, -503, -1011, -1527, -2049, -2570, -3086, -3594,
+	-4097, -4600, -5109, -5625, -6146, -6668, -7184, -7692,
+	-8195, -8697, -9205, -9722, -10244, -10767, -11283, -11791,
+	-12292, -12793, -13301, -13818, -14342, -14866, -15383, -15890,
+	-16389, -16888, -17395, -17914, -18440, -18967, -19485, -19990,
+	-20485, -20981, -21487, -22008, -22539, -23071, -23590, -24092,
+	-24580, -25069, -25572, -26099, -26642, -27185, -27707, -28199,
+	-28666, -29133, -29633, -30185, -30780, -31372, -31886, -32239,
+	-32365,
+
+	/* Level 6: 256 samples, 16 harmonics */
+	-31951, -31887, -31699, -31396, -30993, -30508, -29964, -29380,
+	-28778, -28176, -27588, -27022, -26484, -25973, -25486, -25015,
+	-24552, -24090, -23620, -23137, -22638, -22122, -21592, -21050,
+	-20503, -19956, -19414, -18881, -18360, -17852, -17355, -16866,
+	-16381, -15897, -15409, -14912, -14407, -13891, -13366, -12833,
+	-12297, -11762, -11229, -10703, -10186, -9677, -9177, -8683,
+	-8192, -7701, -7207, -6707, -6200, -5684, -5160, -4631,
+	-4099, -3566, -3037, -2513, -1997, -1489, -988, -492,
+	0, 492, 988, 1489, 1997, 2513, 3037, 3566,
+	4099, 4631, 5160, 5684, 6200, 6707, 7207, 7701,
+	8192, 8683, 9177, 9677, 10186, 10703, 11229, 11762,
+	12297, 12833, 13366, 13891, 14407, 14912, 15409, 15897,
+	16381, 16866, 17355, 17852, 18360, 18881, 19414, 19956,
+	20503, 21050, 21592, 22122, 22638, 23137, 23620, 24090,
+	24552, 25015, 25486, 25973, 26484, 27022, 27588, 28176,
+	28778, 29380, 29964, 30508, 30993, 31396, 31699, 31887,
+	31951, 31887, 31699, 31396, 30993, 30508, 29964, 29380,
+	28778, 28176, 27588, 27022, 26484, 25973, 25486, 25015,
+	24552, 24090, 23620, 23137, 22638, 22122, 21592, 21050,
+	20503, 19956, 19414, 18881, 18360, 17852, 17355, 16866,
+	16381, 15897, 15409, 14912, 14407, 13891, 13366, 12833,
+	12297, 11762, 11229, 10703, 10186, 9677, 9177, 8683,
+	8192, 7701, 7207, 6707, 6200, 5684, 5160, 4631,
+	4099, 3566, 3037, 2513, 1997, 1489, 988, 492,
+	0, -492, -988, -1489, -1997, -2513, -3037, -3566,
+	-4099, -4631, -5160, -5684, -6200, -6707, -7207, -7701,
+	-8192, -8683, -9177, -9677, -10186, -10703, -11229, -11762,
+	-12297, -12833, -13366, -13891, -14407, -14912, -15409, -15897,
+	-16381, -16866, -17355, -17852, -18360, -18881, -19414, -19956,
+	-20503, -21050, -21592, -22122, -22638, -23137, -23620, -24090,
+	-24552, -25015, -25486, -25973, -26484, -27022, -27588, -28176,
+	-28778, -29380, -29964, -30508, -30993, -31396, -31699, -31887,
+	-31951,
+
+	/* Level 7: 256 samples, 8 harmonics */
+	-31128, -31096, -31000, -30842, -30624, -30348, -30018, -29637,
+	-29211, -28743, -28240, -27706, -27148, -26570, -25977, -25376,
+	-24770, -24164, -23562, -22967, -22382, -21809, -21249, -20704,
+	-20173, -19657, -19154, -18663, -18184, -17713, -17249, -16790,
+	-16332, -15875, -15416, -14953, -14484, -14007, -13522, -13028,
+	-12524, -12011, -11489, -10958, -10419, -9874, -9324, -8770,
+	-8215, -7660, -7106, -6556, -6010, -5471, -4938, -4413,
+	-3895, -3386, -2885, -2391, -1904, -1423, -946, -472,
+	0, 472, 946, 1423, 1904, 2391, 2885, 3386,
+	3895, 4413, 4938, 5471, 6010, 6556, 7106, 7660,
+	8215, 8770, 9324, 9874, 10419, 10958, 11489, 12011,
+	12524, 13028, 13522, 14007, 14484, 14953, 15416, 15875,
+	16332, 16790, 17249, 17713, 18184, 18663, 19154, 19657,
+	20173, 20704, 21249, 21809, 22382, 22967, 23562, 24164,
+	24770, 25376, 25977, 26570, 27148, 27706, 28240, 28743,
+	29211, 29637, 30018, 30348, 30624, 30842, 31000, 31096,
+	31128, 31096, 31000, 30842, 30624, 30348, 30018, 29637,
+	29211, 28743, 28240, 27706, 27148, 26570, 25977, 25376,
+	24770, 24164, 23562, 22967, 22382, 21809, 21249, 20704,
+	20173, 19657, 19154, 18663, 18184, 17713, 17249, 16790,
+	16332, 15875, 15416, 14953, 14484, 14007, 13522, 13028,
+	12524, 12011, 11489, 10958, 10419, 9874, 9324, 8770,
+	8215, 7660, 7106, 6556, 6010, 5471, 4938, 4413,
+	3895, 3386, 2885, 2391, 1904, 1423, 946, 472,
+	0, -472, -946, -1423, -1904, -2391, -2885, -3386,
+	-3895, -4413, -4938, -5471, -6010, -6556, -7106, -7660,
+	-8215, -8770, -9324, -9874, -10419, -10958, -11489, -12011,
+	-12524, -13028, -13522, -14007, -14484, -14953, -15416, -15875,
+	-16332, -16790, -17249, -17713, -18184, -18663, -19154, -19657,
+	-20173, -20704, -21249, -21809, -22382, -22967, -23562, -24164,
+	-24770, -25376, -25977, -26570, -27148, -27706, -28240, -28743,
+	-29211, -29637, -30018, -30348, -30624, -30842, -31000, -31096,
+	-31128,
+
+	/* Level 8: 256 samples, 4 harmonics */
+	-29523, -29507, -29459, -29379, -29268, -29125, -28952, -28748,
+	-28515, -28252, -27962, -27644, -27299, -26929, -26535, -26117,
+	-25678, -25217, -24737, -24238, -23722, -23191, -22645, -22087,
+	-21517, -20936, -20347, -19750, -19148, -18540, -17929, -17315,
+	-16701, -16086, -15472, -14861, -14252, -13648, -13048, -12454,
+	-11866, -11285, -10711, -10145, -9587, -9038, -8497, -7964,
+	-7441, -6926, -6419, -5921, -5431, -4949, -4473, -4005,
+	-3543, -3087, -2636, -2190, -1747, -1308, -871, -435,
+	0, 435, 871, 1308, 1747, 2190, 2636, 3087,
+	3543, 4005, 4473, 4949, 5431, 5921, 6419, 6926,
+	7441, 7964, 8497, 9038, 9587, 10145, 10711, 11285,
+	11866, 12454, 13048, 13648, 14252, 14861, 15472, 16086,
+	16701, 17315, 17929, 18540, 19148, 19750, 20347, 20936,
+	21517, 22087, 22645, 23191, 23722, 24238, 24737, 25217,
+	25678, 26117, 26535, 26929, 27299, 27644, 27962, 28252,
+	28515, 28748, 28952, 29125, 29268, 29379, 29459, 29507,
+	29523, 29507, 29459, 29379, 29268, 29125, 28952, 28748,
+	28515, 28252, 27962, 27644, 27299, 26929, 26535, 26117,
+	25678, 25217, 24737, 24238, 23722, 23191, 22645, 22087,
+	21517, 20936, 20347, 19750, 19148, 18540, 17929, 17315,
+	16701, 16086, 15472, 14861, 14252, 13648, 13048, 12454,
+	11866, 11285, 10711, 10145, 9587, 9038, 8497, 7964,
+	7441, 6926, 6419, 5921, 5431, 4949, 4473, 4005,
+	3543, 3087, 2636, 2190, 1747, 1308, 871, 435,
+	0, -435, -871, -1308, -1747, -2190, -2636, -3087,
+	-3543, -4005, -4473, -4949, -5431, -5921, -6419, -6926,
+	-7441, -7964, -8497, -9038, -9587, -10145, -10711, -11285,
+	-11866, -12454, -13048, -13648, -14252, -14861, -15472, -16086,
+	-16701, -17315, -17929, -18540, -19148, -19750, -20347, -20936,
+	-21517, -22087, -22645, -23191, -23722, -24238, -24737, -25217,
+	-25678, -26117, -26535, -26929, -27299, -27644, -27962, -28252,
+	-28515, -28748, -28952, -29125, -29268, -29379, -29459, -29507,
+	-29523,
+
+	/* Level 9: 256 samples, 2 harmonics */
+	-26570, -26562, -26538, -26498, -26443, -26371, -26283, -26179,
+	-26060, -25925, -25774, -25608, -25426, -25229, -25017, -24790,
+	-24548, -24291, -24019, -23733, -23433, -23119, -22790, -22448,
+	-22093, -21724, -21342, -20947, -20539, -20119, -19687, -19244,
+	-18788, -18321, -17844, -17355, -16856, -16347, -15828, -15299,
+	-14762, -14215, -13660, -13097, -12525, -11946, -11360, -10767,
+	-10168, -9563, -8951, -8335, -7713, -7087, -6456, -5822,
+	-5184, -4543, -3899, -3253, -2604, -1955, -1304, -652,
+	0, 652, 1304, 1955, 2604, 3253, 3899, 4543,
+	5184, 5822, 6456, 7087, 7713, 8335, 8951, 9563,
+	10168, 10767, 11360, 11946, 12525, 13097, 13660, 14215,
+	14762, 15299, 15828, 16347, 16856, 17355, 17844, 18321,
+	18788, 19244, 19687, 20119, 20539, 20947, 21342, 21724,
+	22093, 22448, 22790, 23119, 23433, 23733, 24019, 24291,
+	24548, 24790, 25017, 25229, 25426, 25608, 25774, 25925,
+	26060, 26179, 26283, 26371, 26443, 26498, 26538, 26562,
+	26570, 26562, 26538, 26498, 26443, 26371, 26283, 26179,
+	26060, 25925, 25774, 25608, 25426, 25229, 25017, 24790,
+	24548, 24291, 24019, 23733, 23433, 23119, 22790, 22448,
+	22093, 21724, 21342, 20947, 20539, 20119, 19687, 19244,
+	18788, 18321, 17844, 17355, 16856, 16347, 15828, 15299,
+	14762, 14215, 13660, 13097, 12525, 11946, 11360, 10767,
+	10168, 9563, 8951, 8335, 7713, 7087, 6456, 5822,
+	5184, 4543, 3899, 3253, 2604, 1955, 1304, 652,
+	0, -652, -1304, -1955, -2604, -3253, -3899, -4543,
+	-5184, -5822, -6456, -7087, -7713, -8335, -8951, -9563,
+	-10168, -10767, -11360, -11946, -12525, -13097, -13660, -14215,
+	-14762, -15299, -15828, -16347, -16856, -17355, -17844, -18321,
+	-18788, -19244, -19687, -20119, -20539, -20947, -21342, -21724,
+	-22093, -22448, -22790, -23119, -23433, -23733, -24019, -24291,
+	-24548, -24790, -25017, -25229, -25426, -25608, -25774, -25925,
+	-26060, -26179, -26283, -26371, -26443, -26498, -26538, -26562,
+	-26570,
+
+	/* Level 10: 256 samples, 1 harmonics */
+	-26570, -26562, -26538, -26498, -26443, -26371, -26283, -26179,
+	-26060, -25925, -25774, -25608, -25426, -25229, -25017, -24790,
+	-24548, -24291, -24019, -23733, -23433, -23119, -22790, -22448,
+	-22093, -21724, -21342, -20947, -20539, -20119, -19687, -19244,
+	-18788, -18321, -17844, -17355, -16856, -16347, -15828, -15299,
+	-14762, -14215, -13660, -13097, -12525, -11946, -11360, -10767,
+	-10168, -9563, -8951, -8335, -7713, -7087, -6456, -5822,
+	-5184, -4543, -3899, -3253, -2604, -1955, -1304, -652,
+	0, 652, 1304, 1955, 2604, 3253, 3899, 4543,
+	5184, 5822, 6456, 7087, 7713, 8335, 8951, 9563,
+	10168, 10767, 11360, 11946, 12525, 13097, 13660, 14215,
+	14762, 15299, 15828, 16347, 16856, 17355, 17844, 18321,
+	18788, 19244, 19687, 20119, 20539, 20947, 21342, 21724,
+	22093, 22448, 22790, 23119, 23433, 23733, 24019, 24291,
+	24548, 24790, 25017, 25229, 25426, 25608, 25774, 25925,
+	26060, 26179, 26283, 26371, 26443, 26498, 26538, 26562,
+	26570, 26562, 26538, 26498, 26443, 26371, 26283, 26179,
+	26060, 25925, 25774, 25608, 25426, 25229, 25017, 24790,
+	24548, 24291, 24019, 23733, 23433, 23119, 22790, 22448,
+	22093, 21724, 21342, 20947, 20539, 20119, 19687, 19244,
+	18788, 18321, 17844, 17355, 16856, 16347, 15828, 15299,
+	14762, 14215, 13660, 13097, 12525, 11946, 11360, 10767,
+	10168, 9563, 8951, 8335, 7713, 7087, 6456, 5822,
+	5184, 4543, 3899, 3253, 2604, 1955, 1304, 652,
+	0, -652, -1304, -1955, -2604, -3253, -3899, -4543,
+	-5184, -5822, -6456, -7087, -7713, -8335, -8951, -9563,
+	-10168, -10767, -11360, -11946, -12525, -13097, -13660, -14215,
+	-14762, -15299, -15828, -16347, -16856, -17355, -17844, -18321,
+	-18788, -19244, -19687, -20119, -20539, -20947, -21342, -21724,
+	-22093, -22448, -22790, -23119, -23433, -23733, -24019, -24291,
+	-24548, -24790, -25017, -25229, -25426, -25608, -25774, -25925,
+	-26060, -26179, -26283, -26371, -26443, -26498, -26538, -26562,
+	-26570,
+
+	/* Level 11: 256 samples, 1 harmonics */
+	-26570, -26562, -26538, -26498, -26443, -26371, -26283, -26179,
+	-26060, -25925, -25774, -25608, -25426, -25229, -25017, -24790,
+	-24548, -24291, -24019, -23733, -23433, -23119, -22790, -22448,
+	-22093, -21724, -21342, -20947, -20539, -20119, -19687, -19244,
+	-18788, -18321, -17844, -17355, -16856, -16347, -15828, -15299,
+	-14762, -14215, -13660, -13097, -12525, -11946, -11360, -10767,
+	-10168, -9563, -8951, -8335, -7713, -7087, -6456, -5822,
+	-5184, -4543, -3899, -3253, -2604, -1955, -1304, -652,
+	0, 652, 1304, 1955, 2604, 3253, 3899, 4543,
+	5184, 5822, 6456, 7087, 7713, 8335, 8951, 9563,
+	10168, 10767, 11360, 11946, 12525, 13097, 13660, 14215,
+	14762, 15299, 15828, 16347, 16856, 17355, 17844, 18321,
+	18788, 19244, 19687, 20119, 20539, 20947, 21342, 21724,
+	22093, 22448, 22790, 23119, 23433, 23733, 24019, 24291,
+	24548, 24790, 25017, 25229, 25426, 25608, 25774, 25925,
+	26060, 26179, 26283, 26371, 26443, 26498, 26538, 26562,
+	26570, 26562, 26538, 26498, 26443, 26371, 26283, 26179,
+	26060, 25925, 25774, 25608, 25426, 25229, 25017, 24790,
+	24548, 24291, 24019, 23733, 23433, 23119, 22790, 22448,
+	22093, 21724, 21342, 20947, 20539, 20119, 19687, 19244,
+	18788, 18321, 17844, 17355, 16856, 16347, 15828, 15299,
+	14762, 14215, 13660, 13097, 12525, 11946, 11360, 10767,
+	10168, 9563, 8951, 8335, 7713, 7087, 6456, 5822,
+	5184, 4543, 3899, 3253, 2604, 1955, 1304, 652,
+	0, -652, -1304, -1955, -2604, -3253, -3899, -4543,
+	-5184, -5822, -6456, -7087, -7713, -8335, -8951, -9563,
+	-10168, -10767, -11360, -11946, -12525, -13097, -13660, -14215,
+	-14762, -15299, -15828, -16347, -16856, -17355, -17844, -18321,
+	-18788, -19244, -19687, -20119, -20539, -20947, -21342, -21724,
+	-22093, -22448, -22790, -23119, -23433, -23733, -24019, -24291,
+	-24548, -24790, -25017, -25229, -25426, -25608, -25774, -25925,
+	-26060, -26179, -26283, -26371, -26443, -26498, -26538, -26562,
+	-26570,
+};
+
+static const wave_sample_t wave_squ[WAVE_TOTAL_SAMPLES] =
+{
+	/* Level 0: 2048 samples, 1023 harmonics */
+	-25719, -25751, -25719, -25751, -25719, -25751, -25719, -25751,
+	-25719, -25751, -25719, -25751, -25719, -25751, -25719, -25751,
+	-25719, -25751, -25719, -25751, -25719, -25751, -25719, -25751,
+	-25719, -25751, -25719, -25751, -25719, -25751, -25719, -25751,
+	-25719, -25751, -25719, -25751, -25719, -25751, -25719, -25751,
+	-25719, -25751, -25719, -25751, -25719, -25751, -25719, -25751,
+	-25719, -25751, -25719, -25751, -25719, -25751, -25719, -25751,
+	-25719, -25751, -25719, -25751, -25719, -25751, -25719, -25751,
+	-25719, -25751, -25719, -25751, -25719, -25752, -25719, -25752,
+	-25719, -25752, -25719, -25752, -25719, -25752, -25719, -25752,
+	-25719, -25752, -25719, -25752, -25719, -25752, -25719, -25752,
+	-25719, -25752, -25719, -25752, -25718, -25752, -25718, -25752,
+	-25718, -25752, -25718, -25752, -25718, -25752, -25718, -25752,
+	-25718, -25752, -25718, -25752, -25718, -25752, -25718, -25752,
+	-25718, -25752, -25718, -25752, -25718, -25752, -25718, -25752,
+	-25718, -25752, -25718, -25752, -25718, -25752, -25718, -25752,
+	-25718, -25752, -25718, -25753, -25718, -25753, -25718, -25753,
+	-25718, -25753, -25718, -25753, -25718, -25753, -25717, -25753,
+	-25717, -25753, -25717, -25753, -25717, -25753, -25717, -25753,
+	-25717, -25753, -25717, -25753, -25717, -25753, -25717, -25753,
+	-25717, -25753, -25717, -25753, -25717, -25753, -25717, -25753,
+	-25717, -25754, -25717, -25754, -25717, -25754, -25717, -25754,
+	-25716, -25754, -25716, -25754, -25716, -25754, -25716, -25754,
+	-25716, -25754, -25716, -25754, -25716, -25754, -25716, -25754,
+	-25716, -25754, -25716, -25755, -25716, -25755, -25716, -25755,
+	-25716, -25755, -25715, -25755, -25715, -25755, -25715, -25755,
+	-25715, -25755, -25715, -25755, -25715, -25755, -25715, -25755,
+	-25715, -25755, -25715, -25756, -25715, -25756, -25715, -25756,
+	-25714, -25756, -25714, -25756, -25714, -25756, -25714, -25756,
+	-25714, -25756, -25714, -25756, -25714, -25757, -25714, -25757,
+	-25714, -25757, -25713, -25757, -25713, -25757, -25713, -25757,
+	-25713, -25757, -25713, -25757, -25713, -25758, -25713, -25758,
+	-25713, -25758, -25712, -25758, -25712, -25758, -25712, -25758,
+	-25712, -25758, -25712, -25759, -25712, -25759, -25711, -25759,
+	-25711, -25759, -25711, -25759, -25711, -25759, -25711, -25760,
+	-25711, -25760, -25710, -25760, -25710, -25760, -25710, -25760,
+	-25710, -25760, -25710, -25761, -25710, -25761, -25709, -25761,
+	-25709, -25761, -25709, -25761, -25709, -25762, -25709, -25762,
+	-25708, -25762, -25708, -25762, -25708, -25763, -25708, -25763,
+	-25707, -25763, -25707, -25763, -25707, -25764, -25707, -25764,
+	-25706, -25764, -25706, -25764, -25706, -25765, -25706, -25765,
+	-25705, -25765, -25705, -25765, -25705, -25766, -25704, -25766,
+	-25704, -25766, -25704, -25767, -25703, -25767, -25703, -25767,
+	-25703, -25768, -25702, -25768, -25702, -25769, -25702, -25769,
+	-25701, -25769, -25701, -25770, -25700, -25770, -25700, -25771,
+	-25700, -25771, -25699, -25771, -25699, -25772, -25698, -25772,
+	-25698, -25773, -25697, -25773, -25697, -25774, -25696, -25774,
+	-25696, -25775, -25695, -25775, -25695, -25776, -25694, -25777,
+	-25693, -25777, -25693, -25778, -25692, -25779, -25691, -25779,
+	-25691, -25780, -25690, -25781, -25689, -25781, -25688, -25782,
+	-25688, -25783, -25687, -25784, -25686, -25785, -25685, -25786,
+	-25684, -25787, -25683, -25788, -25682, -25789, -25681, -25790,
+	-25680, -25791, -25679, -25792, -25678, -25793, -25676, -25794,
+	-25675, -25796, -25674, -25797, -25672, -25799, -25671, -25800,
+	-25669, -25802, -25668, -25804, -25666, -25805, -25664, -25807,
+	-25662, -25809, -25660, -25811, -25658, -25814, -25656, -25816,
+	-25653, -25818, -25651, -25821, -25648, -25824, -25645, -25827,
+	-25642, -25830, -25638, -25834, -25634, -25838, -25630, -25842,
+	-25626, -25846, -25621, -25851, -25616, -25857, -25611, -25863,
+	-25604, -25869, -25598, -25876, -25590, -25884, -25582, -25893,
+	-25572, -25904, -25561, -25915, -25549, -25928, -25534, -25944,
+	-25518, -25962, -25498, -25984, -25474, -26010, -25445, -26042,
+	-25409, -26083, -25363, -26136, -25301, -26209, -25215, -26313,
+	-25085, -26477, -24871, -26770, -24447, -27438, -23234, -30341,
+	0, 30341, 23234, 27438, 24447, 26770, 24871, 26477,
+	25085, 26313, 25215, 26209, 25301, 26136, 25363, 26083,
+	25409, 26042, 25445, 26010, 25474, 25984, 25498, 25962,
+	25518, 25944, 25534, 25928, 25549, 25915, 25561, 25904,
+	25572, 25893, 25582, 25884, 25590, 25876, 25598, 25869,
+	25604, 25863, 25611, 25857, 25616, 25851, 25621, 25846,
+	25626, 25842, 25630, 25838, 25634, 25834, 25638, 25830,
+	25642, 25827, 25645, 25824, 25648, 25821, 25651, 25818,
+	25653, 25816, 25656, 25814, 25658, 25811, 25660, 25809,
+	25662, 25807, 25664, 25805, 25666, 25804, 25668, 25802,
+	25669, 25800, 25671, 25799, 25672, 25797, 25674, 25796,
+	25675, 25794, 25676, 25793, 25678, 25792, 25679, 25791,
+	25680, 25790, 25681, 25789, 25682, 25788, 25683, 25787,
+	25684, 25786, 25685, 25785, 25686, 25784, 25687, 25783,
+	25688, 25782, 25688, 25781, 25689, 25781, 25690, 25780,
+	25691, 25779, 25691, 25779, 25692, 25778, 25693, 25777,
+	25693, 25777, 25694, 25776, 25695, 25775, 25695, 25775,
+	25696, 25774, 25696, 25774, 25697, 25773, 25697, 25773,
+	25698, 25772, 25698, 25772, 25699, 25771, 25699, 25771,
+	25700, 25771, 25700, 25770, 25700, 25770, 25701, 25769,
+	25701, 25769, 25702, 25769, 25702, 25768, 25702, 25768,
+	25703, 25767, 25703, 25767, 25703, 25767, 25704, 25766,
+	25704, 25766, 25704, 25766, 25705, 25765, 25705, 25765,
+	25705, 25765, 25706, 25765, 25706, 25764, 25706, 25764,
+	25706, 25764, 25707, 25764, 25707, 25763, 25707, 25763,
+	25707, 25763, 25708, 25763, 25708, 25762, 25708, 25762,
+	25708, 25762, 25709, 25762, 25709, 25761, 25709, 25761,
+	25709, 25761, 25709, 25761, 25710, 25761, 25710, 25760,
+	25710, 25760, 25710, 25760, 25710, 25760, 25710, 25760,
+	25711, 25760, 25711, 25759, 25711, 25759, 25711, 25759,
+	25711, 25759, 25711, 25759, 25712, 25759, 25712, 25758,
+	25712, 25758, 25712, 25758, 25712, 25758, 25712, 25758,
+	25713, 25758, 25713, 25758, 25713, 25757, 25713, 25757,
+	25713, 25757, 25713, 25757, 25713, 25757, 25713, 25757,
+	25714, 25757, 25714, 25757, 25714, 25756, 25714, 25756,
+	25714, 25756, 25714, 25756, 25714, 25756, 25714, 25756,
+	25714, 25756, 25715, 25756, 25715, 25756, 25715, 25755,
+	25715, 25755, 25715, 25755, 25715, 25755, 25715, 25755,
+	25715, 25755, 25715, 25755, 25715, 25755, 25715, 25755,
+	25716, 25755, 25716, 25755, 25716, 25755, 25716, 25754,
+	25716, 25754, 25716, 25754, 25716, 25754, 25716, 25754,
+	25716, 25754, 25716, 25754, 25716, 25754, 25716, 25754,
+	25716, 25754, 25717, 25754, 25717, 25754, 25717, 25754,
+	25717, 25753, 25717, 25753, 25717, 25753, 25717, 25753,
+	25717, 25753, 25717, 25753, 25717, 25753, 25717, 25753,
+	25717, 25753, 25717, 25753, 25717, 25753, 25717, 25753,
+	25717, 25753, 25717, 25753, 25718, 25753, 25718, 25753,
+	25718, 25753, 25718, 25753, 25718, 25753, 25718, 25752,
+	25718, 25752, 25718, 25752, 25718, 25752, 25718, 25752,
+	25718, 25752, 25718, 25752, 25718, 25752, 25718, 25752,
+	25718, 25752, 25718, 25752, 25718, 25752, 25718, 25752,
+	25718, 25752, 25718, 25752, 25718, 25752, 25718, 25752,
+	25718, 25752, 25718, 25752, 25718, 25752, 25719, 25752,
+	25719, 25752, 25719, 25752, 25719, 25752, 25719, 25752,
+	25719, 25752, 25719, 25752, 25719, 25752, 25719, 25752,
+	25719, 25752, 25719, 25752, 25719, 25751, 25719, 25751,
+	25719, 25751, 25719, 25751, 25719, 25751, 25719, 25751,
+	25719, 25751, 25719, 25751, 25719, 25751, 25719, 25751,
+	25719, 25751, 25719, 25751, 25719, 25751, 25719, 25751,
+	25719, 25751, 25719, 25751, 25719, 25751, 25719, 25751,
+	25719, 25751, 25719, 25751, 25719, 25751, 25719, 25751,
+	25719, 25751, 25719, 25751, 25719, 25751, 25719, 25751,
+	25719, 25751, 25719, 25751, 25719, 25751, 25719, 25751,
+	25719, 25751, 25719, 25751, 25719, 25751, 25719, 25751,
+	25719, 25751, 25719, 25751, 25719, 25751, 25719, 25751,
+	25719, 25751, 25719, 25751, 25719, 25751, 25719, 25751,
+	25719, 25751, 25719, 25751, 25719, 25751, 25719, 25751,
+	25719, 25751, 25719, 25751, 25719, 25751, 25719, 25751,
+	25719, 25751, 25719, 25751, 25719, 25751, 25719, 25751,
+	25719, 25751, 25719, 25751, 25719, 25751, 25719, 25751,
+	25719, 25751, 25719, 25751, 25719, 25751, 25719, 25751,
+	25719, 25751, 25719, 25751, 25719, 25751, 25719, 25751,
+	25719, 25751, 25719, 25751, 25719, 25752, 25719, 25752,
+	25719, 25752, 25719, 25752, 25719, 25752, 25719, 25752,
+	25719, 25752, 25719, 25752, 25719, 25752, 25719, 25752,
+	25719, 25752, 25719, 25752, 25718, 25752, 25718, 25752,
+	25718, 25752, 25718, 25752, 25718, 25752, 25718, 25752,
+	25718, 25752, 25718, 25752, 25718, 25752, 25718, 25752,
+	25718, 25752, 25718, 25752, 25718, 25752, 25718, 25752,
+	25718, 25752, 25718, 25752, 25718, 25752, 25718, 25752,
+	25718, 25752, 25718, 25753, 25718, 25753, 25718, 25753,
+	25718, 25753, 25718, 25753, 25718, 25753, 25717, 25753,
+	25717, 25753, 25717, 25753, 25717, 25753, 25717, 25753,
+	25717, 25753, 25717, 25753, 25717, 25753, 25717, 25753,
+	25717, 25753, 25717, 25753, 25717, 25753, 25717, 25753,
+	25717, 25754, 25717, 25754, 25717, 25754, 25717, 25754,
+	25716, 25754, 25716, 25754, 25716, 25754, 25716, 25754,
+	25716, 25754, 25716, 25754, 25716, 25754, 25716, 25754,
+	25716, 25754, 25716, 25755, 25716, 25755, 25716, 25755,
+	25716, 25755, 25715, 25755, 25715, 25755, 25715, 25755,
+	25715, 25755, 25715, 25755, 25715, 25755, 25715, 25755,
+	25715, 25755, 25715, 25756, 25715, 25756, 25715, 25756,
+	25714, 25756, 25714, 25756, 25714, 25756, 25714, 25756,
+	25714, 25756, 25714, 25756, 25714, 25757, 25714, 25757,
+	25714, 25757, 25713, 25757, 25713, 25757, 25713, 25757,
+	25713, 25757, 25713, 25757, 25713, 25758, 25713, 25758,
+	25713, 25758, 25712, 25758, 25712, 25758, 25712, 25758,
+	25712, 25758, 25712, 25759, 25712, 25759, 25711, 25759,
+	25711, 25759, 25711, 25759, 25711, 25759, 25711, 25760,
+	25711, 25760, 25710, 25760, 25710, 25760, 25710, 25760,
+	25710, 25760, 25710, 25761, 25710, 25761, 25709, 25761,
+	25709, 25761, 25709, 25761, 25709, 25762, 25709, 25762,
+	25708, 25762, 25708, 25762, 25708, 25763, 25708, 25763,
+	25707, 25763, 25707, 25763, 25707, 25764, 25707, 25764,
+	25706, 25764, 25706, 25764, 25706, 25765, 25706, 25765,
+	25705, 25765, 25705, 25765, 25705, 25766, 25704, 25766,
+	25704, 25766, 25704, 25767, 25703, 25767, 25703, 25767,
+	25703, 25768, 25702, 25768, 25702, 25769, 25702, 25769,
+	25701, 25769, 25701, 25770, 25700, 25770, 25700, 25771,
+	25700, 25771, 25699, 25771, 25699, 25772, 25698, 25772,
+	25698, 25773, 25697, 25773, 25697, 25774, 25696, 25774,
+	25696, 25775, 25695, 25775, 25695, 25776, 25694, 25777,
+	25693, 25777, 25693, 25778, 25692, 25779, 25691, 25779,
+	25691, 25780, 25690, 25781, 25689, 25781, 25688, 25782,
+	25688, 25783, 25687, 25784, 25686, 25785, 25685, 25786,
+	25684, 25787, 25683, 25788, 25682, 25789, 25681, 25790,
+	25680, 25791, 25679, 25792, 25678, 25793, 25676, 25794,
+	25675, 25796, 25674, 25797, 25672, 25799, 25671, 25800,
+	25669, 25802, 25668, 25804, 25666, 25805, 25664, 25807,
+	25662, 25809, 25660, 25811, 25658, 25814, 25656, 25816,
+	25653, 25818, 25651, 25821, 25648, 25824, 25645, 25827,
+	25642, 25830, 25638, 25834, 25634, 25838, 25630, 25842,
+	25626, 25846, 25621, 25851, 25616, 25857, 25611, 25863,
+	25604, 25869, 25598, 25876, 25590, 25884, 25582, 25893,
+	25572, 25904, 25561, 25915, 25549, 25928, 25534, 25944,
+	25518, 25962, 25498, 25984, 25474, 26010, 25445, 26042,
+	25409, 26083, 25363, 26136, 25301, 26209, 25215, 26313,
+	25085, 26477, 24871, 26770, 24447, 27438, 23234, 30341,
+	0, -30341, -23234, -27438, -24447, -26770, -24871, -26477,
+	-25085, -26313, -25215, -26209, -25301, -26136, -25363, -26083,
+	-25409, -26042, -25445, -26010, -25474, -25984, -25498, -25962,
+	-25518, -25944, -25534, -25928, -25549, -25915, -25561, -25904,
+	-25572, -25893, -25582, -25884, -25590, -25876, -25598, -25869,
+	-25604, -25863, -25611, -25857, -25616, -25851, -25621, -25846,
+	-25626, -25842, -25630, -25838, -25634, -25834, -25638, -25830,
+	-25642, -25827, -25645, -25824, -25648, -25821, -25651, -25818,
+	-25653, -25816, -25656, -25814, -25658, -25811, -25660, -25809,
+	-25662, -25807, -25664, -25805, -25666, -25804, -25668, -25802,
+	-25669, -25800, -25671, -25799, -25672, -25797, -25674, -25796,
+	-25675, -25794, -25676, -25793, -25678, -25792, -25679, -25791,
+	-25680, -25790, -25681, -25789, -25682, -25788, -25683, -25787,
+	-25684, -25786, -25685, -25785, -25686, -25784, -25687, -25783,
+	-25688, -25782, -25688, -25781, -25689, -25781, -25690, -25780,
+	-25691, -25779, -25691, -25779, -25692, -25778, -25693, -25777,
+	-25693, -25777, -25694, -25776, -25695, -25775, -25695, -25775,
+	-25696, -25774, -25696, -25774, -25697, -25773, -25697, -25773,
+	-25698, -25772, -25698, -25772, -25699, -25771, -25699, -25771,
+	-25700, -25771, -25700, -25770, -25700, -25770, -25701, -25769,
+	-25701, -25769, -25702, -25769, -25702, -25768, -25702, -25768,
+	-25703, -25767, -25703, -25767, -25703, -25767, -25704, -25766,
+	-25704, -25766, -25704, -25766, -25705, -25765, -25705, -25765,
+	-25705, -25765, -25706, -25765, -25706, -25764, -25706, -25764,
+	-25706, -25764, -25707, -25764, -25707, -25763, -25707, -25763,
+	-25707, -25763, -25708, -25763, -25708, -25762, -25708, -25762,
+	-25708, -25762, -25709, -25762, -25709, -25761, -25709, -25761,
+	-25709, -25761, -25709, -25761, -25710, -25761, -25710, -25760,
+	-25710, -25760, -25710, -25760, -25710, -25760, -25710, -25760,
+	-25711, -25760, -25711, -25759, -25711, -25759, -25711, -25759,
+	-25711, -25759, -25711, -25759, -25712, -25759, -25712, -25758,
+	-25712, -25758, -25712, -25758, -25712, -25758, -25712, -25758,
+	-25713, -25758, -25713, -25758, -25713, -25757, -25713, -25757,
+	-25713, -25757, -25713, -25757, -25713, -25757, -25713, -25757,
+	-25714, -25757, -25714, -25757, -25714, -25756, -25714, -25756,
+	-25714, -25756, -25714, -25756, -25714, -25756, -25714, -25756,
+	-25714, -25756, -25715, -25756, -25715, -25756, -25715, -25755,
+	-25715, -25755, -25715, -25755, -25715, -25755, -25715, -25755,
+	-25715, -25755, -25715, -25755, -25715, -25755, -25715, -25755,
+	-25716, -25755, -25716, -25755, -25716, -25755, -25716, -25754,
+	-25716, -25754, -25716, -25754, -25716, -25754, -25716, -25754,
+	-25716, -25754, -25716, -25754, -25716, -25754, -25716, -25754,
+	-25716, -25754, -25717, -25754, -25717, -25754, -25717, -25754,
+	-25717, -25753, -25717, -25753, -25717, -25753, -25717, -25753,
+	-25717, -25753, -25717, -25753, -25717, -25753, -25717, -25753,
+	-25717, -25753, -25717, -25753, -25717, -25753, -25717, -25753,
+	-25717, -25753, -25717, -25753, -25718, -25753, -25718, -25753,
+	-25718, -25753, -25718, -25753, -25718, -25753, -25718, -25752,
+	-25718, -25752, -25718, -25752, -25718, -25752, -25718, -25752,
+	-25718, -25752, -25718, -25752, -25718, -25752, -25718, -25752,
+	-25718, -25752, -25718, -25752, -25718, -25752, -25718, -25752,
+	-25718, -25752, -25718, -25752, -25718, -25752, -25718, -25752,
+	-25718, -25752, -25718, -25752, -25718, -25752, -25719, -25752,
+	-25719, -25752, -25719, -25752, -25719, -25752, -25719, -25752,
+	-25719, -25752, -25719, -25752, -25719, -25752, -25719, -25752,
+	-25719, -25752, -25719, -25752, -25719, -25751, -25719, -25751,
+	-25719, -25751, -25719, -25751, -25719, -25751, -25719, -25751,
+	-25719, -25751, -25719, -25751, -25719, -25751, -25719, -25751,
+	-25719, -25751, -25719, -25751, -25719, -25751, -25719, -25751,
+	-25719, -25751, -25719, -25751, -25719, -25751, -25719, -25751,
+	-25719, -25751, -25719, -25751, -25719, -25751, -25719, -25751,
+	-25719, -25751, -25719, -25751, -25719, -25751, -25719, -25751,
+	-25719, -25751, -25719, -25751, -25719, -25751, -25719, -25751,
+	-25719, -25751, -25719, -25751, -25719, -25751, -25719, -25751,
+	-25719,
+
+	/* Level 1: 2048 samples, 512 harmonics */
+	-25703, -25735, -25767, -25735, -25703, -25735, -25767, -25735,
+	-25703, -25735, -25767, -25735, -25703, -25735, -25767, -25735,
+	-25703, -25735, -25767, -25735, -25703, -25735, -25767, -25735,
+	-25703, -25735, -25767, -25735, -25703, -25735, -25767, -25735,
+	-25703, -25735, -25767, -25735, -25703, -25735, -25767, -25735,
+	-25703, -25735, -25767, -25735, -25703, -25735, -25767, -25735,
+	-25703, -25735, -25768, -25735, -25703, -25735, -25768, -25735,
+	-25703, -25735, -25768, -25735, -25703, -25735, -25768, -25735,
+	-25703, -25735, -25768, -25735, -25702, -25735, -25768, -25735,
+	-25702, -25735, -25768, -25735, -25702, -25735, -25768, -25735,
+	-25702, -25735, -25768, -25735, -25702, -25735, -25768, -25735,
+	-25702, -25735, -25768, -25735, -25702, -25735, -25769, -25735,
+	-25702, -25735, -25769, -25735, -25702, -25735, -25769, -25735,
+	-25701, -25735, -25769, -25735, -25701, -25735, -25769, -25735,
+	-25701, -25735, -25769, -25735, -25701, -25735, -25769, -25735,
+	-25701, -25735, -25770, -25735, -25701, -25735, -25770, -25735,
+	-25701, -25735, -25770, -25735, -25700, -25735, -25770, -25735,
+	-25700, -25735, -25770, -25735, -25700, -25735, -25770, -25735,
+	-25700, -25735, -25771, -25735, -25700, -25735, -25771, -25735,
+	-25699, -25735, -25771, -25735, -25699, -25735, -25771, -25735,
+	-25699, -25735, -25772, -25735, -25699, -25735, -25772, -25735,
+	-25698, -25735, -25772, -25735, -25698, -25735, -25772, -25735,
+	-25698, -25735, -25773, -25735, -25698, -25735, -25773, -25735,
+	-25697, -25735, -25773, -25735, -25697, -25735, -25773, -25735,
+	-25697, -25735, -25774, -25735, -25696, -25735, -25774, -25735,
+	-25696, -25735, -25774, -25735, -25696, -25735, -25775, -25735,
+	-25695, -25735, -25775, -25735, -25695, -25735, -25776, -25735,
+	-25695, -25735, -25776, -25735, -25694, -25735, -25776, -25735,
+	-25694, -25735, -25777, -25735, -25693, -25735, -25777, -25735,
+	-25693, -25735, -25778, -25735, -25692, -25735, -25778, -25735,
+	-25692, -25735, -25779, -25735, -25691, -25735, -25779, -25735,
+	-25691, -25735, -25780, -25735, -25690, -25735, -25780, -25735,
+	-25690, -25735, -25781, -25735, -25689, -25735, -25781, -25735,
+	-25689, -25735, -25782, -25735, -25688, -25735, -25782, -25735,
+	-25687, -25735, -25783, -25735, -25687, -25735, -25784, -25735,
+	-25686, -25735, -25784, -25735, -25685, -25735, -25785, -25735,
+	-25685, -25735, -25786, -25735, -25684, -25735, -25787, -25735,
+	-25683, -25735, -25788, -25735, -25682, -25735, -25788, -25735,
+	-25681, -25735, -25789, -25735, -25681, -25735, -25790, -25735,
+	-25680, -25735, -25791, -25735, -25679, -25735, -25792, -25735,
+	-25678, -25735, -25793, -25735, -25676, -25735, -25794, -25735,
+	-25675, -25735, -25796, -25735, -25674, -25735, -25797, -25735,
+	-25673, -25735, -25798, -25735, -25672, -25735, -25799, -25735,
+	-25670, -25735, -25801, -25735, -25669, -25735, -25802, -25735,
+	-25667, -25735, -25804, -25735, -25666, -25735, -25805, -25735,
+	-25664, -25735, -25807, -25735, -25662, -25735, -25809, -25735,
+	-25660, -25735, -25811, -25735, -25658, -25735, -25813, -25735,
+	-25656, -25735, -25815, -25735, -25654, -25736, -25818, -25735,
+	-25652, -25736, -25820, -25735, -25649, -25736, -25823, -25735,
+	-25646, -25736, -25825, -25735, -25643, -25736, -25829, -25735,
+	-25640, -25736, -25832, -25735, -25637, -25736, -25835, -25735,
+	-25633, -25736, -25839, -25735, -25629, -25736, -25843, -25734,
+	-25625, -25736, -25848, -25734, -25620, -25736, -25853, -25734,
+	-25615, -25736, -25858, -25734, -25610, -25736, -25864, -25734,
+	-25603, -25736, -25870, -25734, -25597, -25736, -25877, -25734,
+	-25589, -25736, -25885, -25734, -25581, -25737, -25894, -25734,
+	-25571, -25737, -25904, -25733, -25560, -25737, -25916, -25733,
+	-25548, -25737, -25929, -25733, -25534, -25738, -25944, -25732,
+	-25517, -25738, -25963, -25732, -25497, -25739, -25984, -25731,
+	-25474, -25739, -26010, -25730, -25445, -25741, -26042, -25729,
+	-25409, -25742, -26083, -25727, -25363, -25744, -26136, -25725,
+	-25301, -25748, -26209, -25720, -25214, -25753, -26313, -25712,
+	-25085, -25764, -26477, -25696, -24871, -25789, -26770, -25655,
+	-24447, -25865, -27439, -25490, -23234, -26351, -30341, -22458,
+	0, 22458, 30341, 26351, 23234, 25490, 27439, 25865,
+	24447, 25655, 26770, 25789, 24871, 25696, 26477, 25764,
+	25085, 25712, 26313, 25753, 25214, 25720, 26209, 25748,
+	25301, 25725, 26136, 25744, 25363, 25727, 26083, 25742,
+	25409, 25729, 26042, 25741, 25445, 25730, 26010, 25739,
+	25474, 25731, 25984, 25739, 25497, 25732, 25963, 25738,
+	25517, 25732, 25944, 25738, 25534, 25733, 25929, 25737,
+	25548, 25733, 25916, 25737, 25560, 25733, 25904, 25737,
+	25571, 25734, 25894, 25737, 25581, 25734, 25885, 25736,
+	25589, 25734, 25877, 25736, 25597, 25734, 25870, 25736,
+	25603, 25734, 25864, 25736, 25610, 25734, 25858, 25736,
+	25615, 25734, 25853, 25736, 25620, 25734, 25848, 25736,
+	25625, 25734, 25843, 25736, 25629, 25735, 25839, 25736,
+	25633, 25735, 25835, 25736, 25637, 25735, 25832, 25736,
+	25640, 25735, 25829, 25736, 25643, 25735, 25825, 25736,
+	25646, 25735, 25823, 25736, 25649, 25735, 25820, 25736,
+	25652, 25735, 25818, 25736, 25654, 25735, 25815, 25735,
+	25656, 25735, 25813, 25735, 25658, 25735, 25811, 25735,
+	25660, 25735, 25809, 25735, 25662, 25735, 25807, 25735,
+	25664, 25735, 25805, 25735, 25666, 25735, 25804, 25735,
+	25667, 25735, 25802, 25735, 25669, 25735, 25801, 25735,
+	25670, 25735, 25799, 25735, 25672, 25735, 25798, 25735,
+	25673, 25735, 25797, 25735, 25674, 25735, 25796, 25735,
+	25675, 25735, 25794, 25735, 25676, 25735, 25793, 25735,
+	25678, 25735, 25792, 25735, 25679, 25735, 25791, 25735,
+	25680, 25735, 25790, 25735, 25681, 25735, 25789, 25735,
+	25681, 25735, 25788, 25735, 25682, 25735, 25788, 25735,
+	25683, 25735, 25787, 25735, 25684, 25735, 25786, 25735,
+	25685, 25735, 25785, 25735, 25685, 25735, 25784, 25735,
+	25686, 25735, 25784, 25735, 25687, 25735, 25783, 25735,
+	25687, 25735, 25782, 25735, 25688, 25735, 25782, 25735,
+	25689, 25735, 25781, 25735, 25689, 25735, 25781, 25735,
+	25690, 25735, 25780, 25735, 25690, 25735, 25780, 25735,
+	25691, 25735, 25779, 25735, 25691, 25735, 25779, 25735,
+	25692, 25735, 25778, 25735, 25692, 25735, 25778, 25735,
+	25693, 25735, 25777, 25735, 25693, 25735, 25777, 25735,
+	25694, 25735, 25776, 25735, 25694, 25735, 25776, 25735,
+	25695, 25735, 25776, 25735, 25695, 25735, 25775, 25735,
+	25695, 25735, 25775, 25735, 25696, 25735, 25774, 25735,
+	25696, 25735, 25774, 25735, 25696, 25735, 25774, 25735,
+	25697, 25735, 25773, 25735, 25697, 25735, 25773, 25735,
+	25697, 25735, 25773, 25735, 25698, 25735, 25773, 25735,
+	25698, 25735, 25772, 25735, 25698, 25735, 25772, 25735,
+	25698, 25735, 25772, 25735, 25699, 25735, 25772, 25735,
+	25699, 25735, 25771, 25735, 25699, 25735, 25771, 25735,
+	25699, 25735, 25771, 25735, 25700, 25735, 25771, 25735,
+	25700, 25735, 25770, 25735, 25700, 25735, 25770, 25735,
+	25700, 25735, 25770, 25735, 25700, 25735, 25770, 25735,
+	25701, 25735, 25770, 25735, 25701, 25735, 25770, 25735,
+	25701, 25735, 25769, 25735, 25701, 25735, 25769, 25735,
+	25701, 25735, 25769, 25735, 25701, 25735, 25769, 25735,
+	25701, 25735, 25769, 25735, 25702, 25735, 25769, 25735,
+	25702, 25735, 25769, 25735, 25702, 25735, 25768, 25735,
+	25702, 25735, 25768, 25735, 25702, 25735, 25768, 25735,
+	25702, 25735, 25768, 25735, 25702, 25735, 25768, 25735,
+	25702, 25735, 25768, 25735, 25702, 25735, 25768, 25735,
+	25703, 25735, 25768, 25735, 25703, 25735, 25768, 25735,
+	25703, 25735, 25768, 25735, 25703, 25735, 25768, 25735,
+	25703, 25735, 25767, 25735, 25703, 25735, 25767, 25735,
+	25703, 25735, 25767, 25735, 25703, 25735, 25767, 25735,
+	25703, 25735, 25767, 25735, 25703, 25735, 25767, 25735,
+	25703, 25735, 25767, 25735, 25703, 25735, 25767, 25735,
+	25703, 25735, 25767, 25735, 25703, 25735, 25767, 25735,
+	25703, 25735, 25767, 25735, 25703, 25735, 25767, 25735,
+	25703, 25735, 25767, 25735, 25703, 25735, 25767, 25735,
+	25703, 25735, 25767, 25735, 25703, 25735, 25767, 25735,
+	25703, 25735, 25767, 25735, 25703, 25735, 25767, 25735,
+	25703, 25735, 25767, 25735, 25703, 25735, 25767, 25735,
+	25703, 25735, 25767, 25735, 25703, 25735, 25767, 25735,
+	25703, 25735, 25767, 25735, 25703, 25735, 25767, 25735,
+	25703, 25735, 25768, 25735, 25703, 25735, 25768, 25735,
+	25703, 25735, 25768, 25735, 25703, 25735, 25768, 25735,
+	25703, 25735, 25768, 25735, 25702, 25735, 25768, 25735,
+	25702, 25735, 25768, 25735, 25702, 25735, 25768, 25735,
+	25702, 25735, 25768, 25735, 25702, 25735, 25768, 25735,
+	25702, 25735, 25768, 25735, 25702, 25735, 25769, 25735,
+	25702, 25735, 25769, 25735, 25702, 25735, 25769, 25735,
+	25701, 25735, 25769, 25735, 25701, 25735, 25769, 25735,
+	25701, 25735, 25769, 25735, 25701, 25735, 25769, 25735,
+	25701, 25735, 25770, 25735, 25701, 25735, 25770, 25735,
+	25701, 25735, 25770, 25735, 25700, 25735, 25770, 25735,
+	25700, 25735, 25770, 25735, 25700, 25735, 25770, 25735,
+	25700, 25735, 25771, 25735, 25700, 25735, 25771, 25735,
+	25699, 25735, 25771, 25735, 25699, 25735, 25771, 25735,
+	25699, 25735, 25772, 25735, 25699, 25735, 25772, 25735,
+	25698, 25735, 25772, 25735, 25698, 25735, 25772, 25735,
+	25698, 25735, 25773, 25735, 25698, 25735, 25773, 25735,
+	25697, 25735, 25773, 25735, 25697, 25735, 25773, 25735,
+	25697, 25735, 25774, 25735, 25696, 25735, 25774, 25735,
+	25696, 25735, 25774, 25735, 25696, 25735, 25775, 25735,
+	25695, 25735, 25775, 25735, 25695, 25735, 25776, 25735,
+	25695, 25735, 25776, 25735, 25694, 25735, 25776, 25735,
+	25694, 25735, 25777, 25735, 25693, 25735, 25777, 25735,
+	25693, 25735, 25778, 25735, 25692, 25735, 25778, 25735,
+	25692, 25735, 25779, 25735, 25691, 25735, 25779, 25735,
+	25691, 25735, 25780, 25735, 25690, 25735, 25780, 25735,
+	25690, 25735, 25781, 25735, 25689, 25735, 25781, 25735,
+	25689, 25735, 25782, 25735, 25688, 25735, 25782, 25735,
+	25687, 25735, 25783, 25735, 25687, 25735, 25784, 25735,
+	25686, 25735, 25784, 25735, 25685, 25735, 25785, 25735,
+	25685, 25735, 25786, 25735, 25684, 25735, 25787, 25735,
+	25683, 25735, 25788, 25735, 25682, 25735, 25788, 25735,
+	25681, 25735, 25789, 25735, 25681, 25735, 25790, 25735,
+	25680, 25735, 25791, 25735, 25679, 25735, 25792, 25735,
+	25678, 25735, 25793, 25735, 25676, 25735, 25794, 25735,
+	25675, 25735, 25796, 25735, 25674, 25735, 25797, 25735,
+	25673, 25735, 25798, 25735, 25672, 25735, 25799, 25735,
+	25670, 25735, 25801, 25735, 25669, 25735, 25802, 25735,
+	25667, 25735, 25804, 25735, 25666, 25735, 25805, 25735,
+	25664, 25735, 25807, 25735, 25662, 25735, 25809, 25735,
+	25660, 25735, 25811, 25735, 25658, 25735, 25813, 25735,
+	25656, 25735, 25815, 25735, 25654, 25736, 25818, 25735,
+	25652, 25736, 25820, 25735, 25649, 25736, 25823, 25735,
+	25646, 25736, 25825, 25735, 25643, 25736, 25829, 25735,
+	25640, 25736, 25832, 25735, 25637, 25736, 25835, 25735,
+	25633, 25736, 25839, 25735, 25629, 25736, 25843, 25734,
+	25625, 25736, 25848, 25734, 25620, 25736, 25853, 25734,
+	25615, 25736, 25858, 25734, 25610, 25736, 25864, 25734,
+	25603, 25736, 25870, 25734, 25597, 25736, 25877, 25734,
+	25589, 25736, 25885, 25734, 25581, 25737, 25894, 25734,
+	25571, 25737, 25904, 25733, 25560, 25737, 25916, 25733,
+	25548, 25737, 25929, 25733, 25534, 25738, 25944, 25732,
+	25517, 25738, 25963, 25732, 25497, 25739, 25984, 25731,
+	25474, 25739, 26010, 25730, 25445, 25741, 26042, 25729,
+	25409, 25742, 26083, 25727, 25363, 25744, 26136, 25725,
+	25301, 25748, 26209, 25720, 25214, 25753, 26313, 25712,
+	25085, 25764, 26477, 25696, 24871, 25789, 26770, 25655,
+	24447, 25865, 27439, 25490, 23234, 26351, 30341, 22458,
+	0, -22458, -30341, -26351, -23234, -25490, -27439, -25865,
+	-24447, -25655, -26770, -25789, -24871, -25696, -26477, -25764,
+	-25085, -25712, -26313, -25753, -25214, -25720, -26209, -25748,
+	-25301, -25725, -26136, -25744, -25363, -25727, -26083, -25742,
+	-25409, -25729, -26042, -25741, -25445, -25730, -26010, -25739,
+	-25474, -25731, -25984, -25739, -25497, -25732, -25963, -25738,
+	-25517, -25732, -25944, -25738, -25534, -25733, -25929, -25737,
+	-25548, -25733, -25916, -25737, -25560, -25733, -25904, -25737,
+	-25571, -25734, -25894, -25737, -25581, -25734, -25885, -25736,
+	-25589, -25734, -25877, -25736, -25597, -25734, -25870, -25736,
+	-25603, -25734, -25864, -25736, -25610, -25734, -25858, -25736,
+	-25615, -25734, -25853, -25736, -25620, -25734, -25848, -25736,
+	-25625, -25734, -25843, -25736, -25629, -25735, -25839, -25736,
+	-25633, -25735, -25835, -25736, -25637, -25735, -25832, -25736,
+	-25640, -25735, -25829, -25736, -25643, -25735, -25825, -25736,
+	-25646, -25735, -25823, -25736, -25649, -25735, -25820, -25736,
+	-25652, -25735, -25818, -25736, -25654, -25735, -25815, -25735,
+	-25656, -25735, -25813, -25735, -25658, -25735, -25811, -25735,
+	-25660, -25735, -25809, -25735, -25662, -25735, -25807, -25735,
+	-25664, -25735, -25805, -25735, -25666, -25735, -25804, -25735,
+	-25667, -25735, -25802, -25735, -25669, -25735, -25801, -25735,
+	-25670, -25735, -25799, -25735, -25672, -25735, -25798, -25735,
+	-25673, -25735, -25797, -25735, -25674, -25735, -25796, -25735,
+	-25675, -25735, -25794, -25735, -25676, -25735, -25793, -25735,
+	-25678, -25735, -25792, -25735, -25679, -25735, -25791, -25735,
+	-25680, -25735, -25790, -25735, -25681, -25735, -25789, -25735,
+	-25681, -25735, -25788, -25735, -25682, -25735, -25788, -25735,
+	-25683, -25735, -25787, -25735, -25684, -25735, -25786, -25735,
+	-25685, -25735, -25785, -25735, -25685, -25735, -25784, -25735,
+	-25686, -25735, -25784, -25735, -25687, -25735, -25783, -25735,
+	-25687, -25735, -25782, -25735, -25688, -25735, -25782, -25735,
+	-25689, -25735, -25781, -25735, -25689, -25735, -25781, -25735,
+	-25690, -25735, -25780, -25735, -25690, -25735, -25780, -25735,
+	-25691, -25735, -25779, -25735, -25691, -25735, -25779, -25735,
+	-25692, -25735, -25778, -25735, -25692, -25735, -25778, -25735,
+	-25693, -25735, -25777, -25735, -25693, -25735, -25777, -25735,
+	-25694, -25735, -25776, -25735, -25694, -25735, -25776, -25735,
+	-25695, -25735, -25776, -25735, -25695, -25735, -25775, -25735,
+	-25695, -25735, -25775, -25735, -25696, -25735, -25774, -25735,
+	-25696, -25735, -25774, -25735, -25696, -25735, -25774, -25735,
+	-25697, -25735, -25773, -25735, -25697, -25735, -25773, -25735,
+	-25697, -25735, -25773, -25735, -25698, -25735, -25773, -25735,
+	-25698, -25735, -25772, -25735, -25698, -25735, -25772, -25735,
+	-25698, -25735, -25772, -25735, -25699, -25735, -25772, -25735,
+	-25699, -25735, -25771, -25735, -25699, -25735, -25771, -25735,
+	-25699, -25735, -25771, -25735, -25700, -25735, -25771, -25735,
+	-25700, -25735, -25770, -25735, -25700, -25735, -25770, -25735,
+	-25700, -25735, -25770, -25735, -25700, -25735, -25770, -25735,
+	-25701, -25735, -25770, -25735, -25701, -25735, -25770, -25735,
+	-25701, -25735, -25769, -25735, -25701, -25735, -25769, -25735,
+	-25701, -25735, -25769, -25735, -25701, -25735, -25769, -25735,
+	-25701, -25735, -25769, -25735, -25702, -25735, -25769, -25735,
+	-25702, -25735, -25769, -25735, -25702, -25735, -25768, -25735,
+	-25702, -25735, -25768, -25735, -25702, -25735, -25768, -25735,
+	-25702, -25735, -25768, -25735, -25702, -25735, -25768, -25735,
+	-25702, -25735, -25768, -25735, -25702, -25735, -25768, -25735,
+	-25703, -25735, -25768, -25735, -25703, -25735, -25768, -25735,
+	-25703, -25735, -25768, -25735, -25703, -25735, -25768, -25735,
+	-25703, -25735, -25767, -25735, -25703, -25735, -25767, -25735,
+	-25703, -25735, -25767, -25735, -25703, -25735, -25767, -25735,
+	-25703, -25735, -25767, -25735, -25703, -25735, -25767, -25735,
+	-25703, -25735, -25767, -25735, -25703, -25735, -25767, -25735,
+	-25703, -25735, -25767, -25735, -25703, -25735, -25767, -25735,
+	-25703, -25735, -25767, -25735, -25703, -25735, -25767, -25735,
+	-25703,
+
+	/* Level 2: 1024 samples, 256 harmonics */
+	-25671, -25735, -25799, -25735, -25671, -25735, -25799, -25735,
+	-25671, -25735, -25799, -25735, -25671, -25735, -25799, -25735,
+	-25671, -25735, -25800, -25735, -25671, -25735, -25800, -25735,
+	-25670, -25735, -25800, -25735, -25670, -25735, -25800, -25735,
+	-25670, -25735, -25801, -25735, -25670, -25735, -25801, -25735,
+	-25669, -25735, -25801, -25735, -25669, -25735, -25802, -25735,
+	-25668, -25735, -25802, -25735, -25668, -25735, -25803, -25735,
+	-25667, -25735, -25803, -25735, -25667, -25735, -25804, -25735,
+	-25666, -25735, -25805, -25735, -25665, -25735, -25806, -25735,
+	-25664, -25735, -25806, -25735, -25663, -25735, -25807, -25735,
+	-25663, -25735, -25808, -25735, -25662, -25735, -25809, -25735,
+	-25661, -25735, -25810, -25735, -25659, -25735, -25811, -25735,
+	-25658, -25735, -25813, -25735, -25657, -25735, -25814, -25735,
+	-25655, -25735, -25816, -25735, -25654, -25735, -25817, -25735,
+	-25652, -25735, -25819, -25735, -25651, -25735, -25821, -25735,
+	-25649, -25735, -25822, -25735, -25647, -25735, -25825, -25735,
+	-25645, -25736, -25827, -25735, -25642, -25736, -25829, -25735,
+	-25640, -25736, -25832, -25735, -25637, -25736, -25835, -25735,
+	-25634, -25736, -25838, -25735, -25631, -25736, -25841, -25735,
+	-25628, -25736, -25844, -25735, -25624, -25736, -25848, -25734,
+	-25620, -25736, -25852, -25734, -25616, -25736, -25857, -25734,
+	-25611, -25736, -25862, -25734, -25605, -25736, -25868, -25734,
+	-25599, -25736, -25874, -25734, -25593, -25736, -25881, -25734,
+	-25585, -25736, -25889, -25734, -25577, -25737, -25898, -25734,
+	-25568, -25737, -25907, -25733, -25557, -25737, -25919, -25733,
+	-25545, -25737, -25932, -25733, -25531, -25738, -25947, -25732,
+	-25515, -25738, -25965, -25732, -25495, -25739, -25986, -25731,
+	-25472, -25739, -26012, -25730, -25443, -25741, -26044, -25729,
+	-25407, -25742, -26084, -25727, -25361, -25744, -26138, -25725,
+	-25300, -25748, -26210, -25720, -25213, -25753, -26314, -25712,
+	-25084, -25764, -26478, -25696, -24870, -25789, -26771, -25655,
+	-24446, -25865, -27439, -25490, -23234, -26351, -30341, -22458,
+	0, 22458, 30341, 26351, 23234, 25490, 27439, 25865,
+	24446, 25655, 26771, 25789, 24870, 25696, 26478, 25764,
+	25084, 25712, 26314, 25753, 25213, 25720, 26210, 25748,
+	25300, 25725, 26138, 25744, 25361, 25727, 26084, 25742,
+	25407, 25729, 26044, 25741, 25443, 25730, 26012, 25739,
+	25472, 25731, 25986, 25739, 25495, 25732, 25965, 25738,
+	25515, 25732, 25947, 25738, 25531, 25733, 25932, 25737,
+	25545, 25733, 25919, 25737, 25557, 25733, 25907, 25737,
+	25568, 25734, 25898, 25737, 25577, 25734, 25889, 25736,
+	25585, 25734, 25881, 25736, 25593, 25734, 25874, 25736,
+	25599, 25734, 25868, 25736, 25605, 25734, 25862, 25736,
+	25611, 25734, 25857, 25736, 25616, 25734, 25852, 25736,
+	25620, 25734, 25848, 25736, 25624, 25735, 25844, 25736,
+	25628, 25735, 25841, 25736, 25631, 25735, 25838, 25736,
+	25634, 25735, 25835, 25736, 25637, 25735, 25832, 25736,
+	25640, 25735, 25829, 25736, 25642, 25735, 25827, 25736,
+	25645, 25735, 25825, 25735, 25647, 25735, 25822, 25735,
+	25649, 25735, 25821, 25735, 25651, 25735, 25819, 25735,
+	25652, 25735, 25817, 25735, 25654, 25735, 25816, 25735,
+	25655, 25735, 25814, 25735, 25657, 25735, 25813, 25735,
+	25658, 25735, 25811, 25735, 25659, 25735, 25810, 25735,
+	25661, 25735, 25809, 25735, 25662, 25735, 25808, 25735,
+	25663, 25735, 25807, 25735, 25663, 25735, 25806, 25735,
+	25664, 25735, 25806, 25735, 25665, 25735, 25805, 25735,
+	25666, 25735, 25804, 25735, 25667, 25735, 25803, 25735,
+	25667, 25735, 25803, 25735, 25668, 25735, 25802, 25735,
+	25668, 25735, 25802, 25735, 25669, 25735, 25801, 25735,
+	25669, 25735, 25801, 25735, 25670, 25735, 25801, 25735,
+	25670, 25735, 25800, 25735, 25670, 25735, 25800, 25735,
+	25670, 25735, 25800, 25735, 25671, 25735, 25800, 25735,
+	25671, 25735, 25799, 25735, 25671, 25735, 25799, 25735,
+	25671, 25735, 25799, 25735, 25671, 25735, 25799, 25735,
+	25671, 25735, 25799, 25735, 25671, 25735, 25799, 25735,
+	25671, 25735, 25799, 25735, 25671, 25735, 25799, 25735,
+	25671, 25735, 25800, 25735, 25671, 25735, 25800, 25735,
+	25670, 25735, 25800, 25735, 25670, 25735, 25800, 25735,
+	25670, 25735, 25801, 25735, 25670, 25735, 25801, 25735,
+	25669, 25735, 25801, 25735, 25669, 25735, 25802, 25735,
+	25668, 25735, 25802, 25735, 25668, 25735, 25803, 25735,
+	25667, 25735, 25803, 25735, 25667, 25735, 25804, 25735,
+	25666, 25735, 25805, 25735, 25665, 25735, 25806, 25735,
+	25664, 25735, 25806, 25735, 25663, 25735, 25807, 25735,
+	25663, 25735, 25808, 25735, 25662, 25735, 25809, 25735,
+	25661, 25735, 25810, 25735, 25659, 25735, 25811, 25735,
+	25658, 25735, 25813, 25735, 25657, 25735, 25814, 25735,
+	25655, 25735, 25816, 25735, 25654, 25735, 25817, 25735,
+	25652, 25735, 25819, 25735, 25651, 25735, 25821, 25735,
+	25649, 25735, 25822, 25735, 25647, 25735, 25825, 25735,
+	25645, 25736, 25827, 25735, 25642, 25736, 25829, 25735,
+	25640, 25736, 25832, 25735, 25637, 25736, 25835, 25735,
+	25634, 25736, 25838, 25735, 25631, 25736, 25841, 25735,
+	25628, 25736, 25844, 25735, 25624, 25736, 25848, 25734,
+	25620, 25736, 25852, 25734, 25616, 25736, 25857, 25734,
+	25611, 25736, 25862, 25734, 25605, 25736, 25868, 25734,
+	25599, 25736, 25874, 25734, 25593, 25736, 25881, 25734,
+	25585, 25736, 25889, 25734, 25577, 25737, 25898, 25734,
+	25568, 25737, 25907, 25733, 25557, 25737, 25919, 25733,
+	25545, 25737, 25932, 25733, 25531, 25738, 25947, 25732,
+	25515, 25738, 25965, 25732, 25495, 25739, 25986, 25731,
+	25472, 25739, 26012, 25730, 25443, 25741, 26044, 25729,
+	25407, 25742, 26084, 25727, 25361, 25744, 26138, 25725,
+	25300, 25748, 26210, 25720, 25213, 25753, 26314, 25712,
+	25084, 25764, 26478, 25696, 24870, 25789, 26771, 25655,
+	24446, 25865, 27439, 25490, 23234, 26351, 30341, 22458,
+	0, -22458, -30341, -26351, -23234, -25490, -27439, -25865,
+	-24446, -25655, -26771, -25789, -24870, -25696, -26478, -25764,
+	-25084, -25712, -26314, -25753, -25213, -25720, -26210, -25748,
+	-25300, -25725, -26138, -25744, -25361, -25727, -26084, -25742,
+	-25407, -25729, -26044, -25741, -25443, -25730, -26012, -25739,
+	-25472, -25731, -25986, -25739, -25495, -25732, -25965, -25738,
+	-25515, -25732, -25947, -25738, -25531, -25733, -25932, -25737,
+	-25545, -25733, -25919, -25737, -25557, -25733, -25907, -25737,
+	-25568, -25734, -25898, -25737, -25577, -25734, -25889, -25736,
+	-25585, -25734, -25881, -25736, -25593, -25734, -25874, -25736,
+	-25599, -25734, -25868, -25736, -25605, -25734, -25862, -25736,
+	-25611, -25734, -25857, -25736, -25616, -25734, -25852, -25736,
+	-25620, -25734, -25848, -25736, -25624, -25735, -25844, -25736,
+	-25628, -25735, -25841, -25736, -25631, -25735, -25838, -25736,
+	-25634, -25735, -25835, -25736, -25637, -25735, -25832, -25736,
+	-25640, -25735, -25829, -25736, -25642, -25735, -25827, -25736,
+	-25645, -25735, -25825, -25735, -25647, -25735, -25822, -25735,
+	-25649, -25735, -25821, -25735, -25651, -25735, -25819, -25735,
+	-25652, -25735, -25817, -25735, -25654, -25735, -25816, -25735,
+	-25655, -25735, -25814, -25735, -25657, -25735, -25813, -25735,
+	-25658, -25735, -25811, -25735, -25659, -25735, -25810, -25735,
+	-25661, -25735, -25809, -25735, -25662, -25735, -25808, -25735,
+	-25663, -25735, -25807, -25735, -25663, -25735, -25806, -25735,
+	-25664, -25735, -25806, -25735, -25665, -25735, -25805, -25735,
+	-25666, -25735, -25804, -25735, -25667, -25735, -25803, -25735,
+	-25667, -25735, -25803, -25735, -25668, -25735, -25802, -25735,
+	-25668, -25735, -25802, -25735, -25669, -25735, -25801, -25735,
+	-25669, -25735, -25801, -25735, -25670, -25735, -25801, -25735,
+	-25670, -25735, -25800, -25735, -25670, -25735, -25800, -25735,
+	-25670, -25735, -25800, -25735, -25671, -25735, -25800, -25735,
+	-25671, -25735, -25799, -25735, -25671, -25735, -25799, -25735,
+	-25671, -25735, -25799, -25735, -25671, -25735, -25799, -25735,
+	-25671,
+
+	/* Level 3: 512 samples, 128 harmonics */
+	-25607, -25735, -25863, -25735, -25607, -25735, -25863, -25735,
+	-25607, -25735, -25864, -25735, -25606, -25735, -25865, -25735,
+	-25605, -25735, -25866, -25735, -25603, -25735, -25868, -25735,
+	-25601, -25735, -25870, -25735, -25599, -25736, -25872, -25735,
+	-25597, -25736, -25875, -25735, -25594, -25736, -25878, -25735,
+	-25590, -25736, -25882, -25734, -25586, -25736, -25887, -25734,
+	-25581, -25736, -25892, -25734, -25576, -25736, -25897, -25734,
+	-25570, -25736, -25904, -25734, -25562, -25736, -25912, -25734,
+	-25554, -25737, -25921, -25734, -25545, -25737, -25931, -25733,
+	-25533, -25737, -25943, -25733, -25520, -25738, -25957, -25733,
+	-25505, -25738, -25974, -25732, -25486, -25739, -25995, -25731,
+	-25464, -25739, -26020, -25730, -25436, -25740, -26051, -25729,
+	-25401, -25742, -26090, -25727, -25356, -25744, -26143, -25725,
+	-25295, -25747, -26214, -25720, -25209, -25753, -26318, -25713,
+	-25081, -25764, -26481, -25697, -24868, -25789, -26773, -25656,
+	-24445, -25865, -27440, -25490, -23233, -26351, -30342, -22458,
+	0, 22458, 30342, 26351, 23233, 25490, 27440, 25865,
+	24445, 25656, 26773, 25789, 24868, 25697, 26481, 25764,
+	25081, 25713, 26318, 25753, 25209, 25720, 26214, 25747,
+	25295, 25725, 26143, 25744, 25356, 25727, 26090, 25742,
+	25401, 25729, 26051, 25740, 25436, 25730, 26020, 25739,
+	25464, 25731, 25995, 25739, 25486, 25732, 25974, 25738,
+	25505, 25733, 25957, 25738, 25520, 25733, 25943, 25737,
+	25533, 25733, 25931, 25737, 25545, 25734, 25921, 25737,
+	25554, 25734, 25912, 25736, 25562, 25734, 25904, 25736,
+	25570, 25734, 25897, 25736, 25576, 25734, 25892, 25736,
+	25581, 25734, 25887, 25736, 25586, 25734, 25882, 25736,
+	25590, 25735, 25878, 25736, 25594, 25735, 25875, 25736,
+	25597, 25735, 25872, 25736, 25599, 25735, 25870, 25735,
+	25601, 25735, 25868, 25735, 25603, 25735, 25866, 25735,
+	25605, 25735, 25865, 25735, 25606, 25735, 25864, 25735,
+	25607, 25735, 25863, 25735, 25607, 25735, 25863, 25735,
+	25607, 25735, 25863, 25735, 25607, 25735, 25863, 25735,
+	25607, 25735, 25864, 25735, 25606, 25735, 25865, 25735,
+	25605, 25735, 25866, 25735, 25603, 25735, 25868, 25735,
+	25601, 25735, 25870, 25735, 25599, 25736, 25872, 25735,
+	25597, 25736, 25875, 25735, 25594, 25736, 25878, 25735,
+	25590, 25736, 25882, 25734, 25586, 25736, 25887, 25734,
+	25581, 25736, 25892, 25734, 25576, 25736, 25897, 25734,
+	25570, 25736, 25904, 25734, 25562, 25736, 25912, 25734,
+	25554, 25737, 25921, 25734, 25545, 25737, 25931, 25733,
+	25533, 25737, 25943, 25733, 25520, 25738, 25957, 25733,
+	25505, 25738, 25974, 25732, 25486, 25739, 25995, 25731,
+	25464, 25739, 26020, 25730, 25436, 25740, 26051, 25729,
+	25401, 25742, 26090, 25727, 25356, 25744, 26143, 25725,
+	25295, 25747, 26214, 25720, 25209, 25753, 26318, 25713,
+	25081, 25764, 26481, 25697, 24868, 25789, 26773, 25656,
+	24445, 25865, 27440, 25490, 23233, 26351, 30342, 22458,
+	0, -22458, -30342, -26351, -23233, -25490, -27440, -25865,
+	-24445, -25656, -26773, -25789, -24868, -25697, -26481, -25764,
+	-25081, -25713, -26318, -25753, -25209, -25720, -26214, -25747,
+	-25295, -25725, -26143, -25744, -25356, -25727, -26090, -25742,
+	-25401, -25729, -26051, -25740, -25436, -25730, -26020, -25739,
+	-25464, -25731, -25995, -25739, -25486, -25732, -25974, -25738,
+	-25505, -25733, -25957, -25738, -25520, -25733, -25943, -25737,
+	-25533, -25733, -25931, -25737, -25545, -25734, -25921, -25737,
+	-25554, -25734, -25912, -25736, -25562, -25734, -25904, -25736,
+	-25570, -25734, -25897, -25736, -25576, -25734, -25892, -25736,
+	-25581, -25734, -25887, -25736, -25586, -25734, -25882, -25736,
+	-25590, -25735, -25878, -25736, -25594, -25735, -25875, -25736,
+	-25597, -25735, -25872, -25736, -25599, -25735, -25870, -25735,
+	-25601, -25735, -25868, -25735, -25603, -25735, -25866, -25735,
+	-25605, -25735, -25865, -25735, -25606, -25735, -25864, -25735,
+	-25607, -25735, -25863, -25735, -25607, -25735, -25863, -25735,
+	-25607,
+
+	/* Level 4: 256 samples, 64 harmonics */
+	-25479, -25735, -25991, -25735, -25478, -25736, -25994, -25734,
+	-25474, -25736, -25999, -25734, -25468, -25737, -26007, -25733,
+	-25458, -25737, -26018, -25733, -25445, -25738, -26033, -25732,
+	-25427, -25739, -26054, -25731, -25404, -25740, -26080, -25730,
+	-25373, -25741, -26116, -25728, -25332, -25743, -26164, -25725,
+	-25275, -25747, -26232, -25721, -25193, -25753, -26332, -25713,
+	-25068, -25764, -26492, -25697, -24858, -25788, -26781, -25656,
+	-24438, -25864, -27445, -25491, -23230, -26350, -30343, -22459,
+	0, 22459, 30343, 26350, 23230, 25491, 27445, 25864,
+	24438, 25656, 26781, 25788, 24858, 25697, 26492, 25764,
+	25068, 25713, 26332, 25753, 25193, 25721, 26232, 25747,
+	25275, 25725, 26164, 25743, 25332, 25728, 26116, 25741,
+	25373, 25730, 26080, 25740, 25404, 25731, 26054, 25739,
+	25427, 25732, 26033, 25738, 25445, 25733, 26018, 25737,
+	25458, 25733, 26007, 25737, 25468, 25734, 25999, 25736,
+	25474, 25734, 25994, 25736, 25478, 25735, 25991, 25735,
+	25479, 25735, 25991, 25735, 25478, 25736, 25994, 25734,
+	25474, 25736, 25999, 25734, 25468, 25737, 26007, 25733,
+	25458, 25737, 26018, 25733, 25445, 25738, 26033, 25732,
+	25427, 25739, 26054, 25731, 25404, 25740, 26080, 25730,
+	25373, 25741, 26116, 25728, 25332, 25743, 26164, 25725,
+	25275, 25747, 26232, 25721, 25193, 25753, 26332, 25713,
+	25068, 25764, 26492, 25697, 24858, 25788, 26781, 25656,
+	24438, 25864, 27445, 25491, 23230, 26350, 30343, 22459,
+	0, -22459, -30343, -26350, -23230, -25491, -27445, -25864,
+	-24438, -25656, -26781, -25788, -24858, -25697, -26492, -25764,
+	-25068, -25713, -26332, -25753, -25193, -25721, -26232, -25747,
+	-25275, -25725, -26164, -25743, -25332, -25728, -26116, -25741,
+	-25373, -25730, -26080, -25740, -25404, -25731, -26054, -25739,
+	-25427, -25732, -26033, -25738, -25445, -25733, -26018, -25737,
+	-25458, -25733, -26007, -25737, -25468, -25734, -25999, -25736,
+	-25474, -25734, -25994, -25736, -25478, -25735, -25991, -25735,
+	-25479,
+
+	/* Level 5: 256 samples, 32 harmonics */
+	-25224, -25374, -25736, -26099, -26249, -26098, -25733, -25366,
+	-25214, -25367, -25739, -26114, -26270, -26112, -25729, -25343,
+	-25182, -25345, -25743, -26146, -26315, -26143, -25724, -25299,
+	-25121, -25303, -25750, -26204, -26396, -26199, -25716, -25222,
+	-25013, -25229, -25761, -26307, -26539, -26298, -25699, -25082,
+	-24818, -25095, -25786, -26504, -26813, -26485, -25658, -24790,
+	-24413, -24821, -25862, -26973, -27464, -26918, -25493, -23929,
+	-23217, -24055, -26348, -29032, -30350, -28509, -22461, -12435,
+	0, 12435, 22461, 28509, 30350, 29032, 26348, 24055,
+	23217, 23929, 25493, 26918, 27464, 26973, 25862, 24821,
+	24413, 24790, 25658, 26485, 26813, 26504, 25786, 25095,
+	24818, 25082, 25699, 26298, 26539, 26307, 25761, 25229,
+	25013, 25222, 25716, 26199, 26396, 26204, 25750, 25303,
+	25121, 25299, 25724, 26143, 26315, 26146, 25743, 25345,
+	25182, 25343, 25729, 26112, 26270, 26114, 25739, 25367,
+	25214, 25366, 25733, 26098, 26249, 26099, 25736, 25374,
+	25224, 25374, 25736, 26099, 26249, 26098, 25733, 25366,
+	25214, 25367, 25739, 26114, 26270, 26112, 25729, 25343,
+	25182, 25345, 25743, 26146, 26315, 26143, 25724, 25299,
+	25121, 25303, 25750, 26204, 26396, 26199, 25716, 25222,
+	25013, 25229, 25761, 26307, 26539, 26298, 25699, 25082,
+	24818, 25095, 25786, 26504, 26813, 26485, 25658, 24790,
+	24413, 24821, 25862, 26973, 27464, 26918, 25493, 23929,
+	23217, 24055, 26348, 29032, 30350, 28509, 22461, 12435,
+	0, -12435, -22461, -28509, -30350, -29032, -26348, -24055,
+	-23217, -23929, -25493, -26918, -27464, -26973, -25862, -24821,
+	-24413, -24790, -25658, -26485, -26813, -26504, -25786, -25095,
+	-24818, -25082, -25699, -26298, -26539, -26307, -25761, -25229,
+	-25013, -25222, -25716, -26199, -26396, -26204, -25750, -25303,
+	-25121, -25299, -25724, -26143, -26315, -26146, -25743, -25345,
+	-25182, -25343, -25729, -26112, -26270, -26114, -25739, -25367,
+	-25214, -25366, -25733, -26098, -26249, -26099, -25736, -25374,
+	-25224,
+
+	/* Level 6: 256 samples, 16 harmonics */
+	-24715, -24793, -25015, -25348, -25741, -26136, -26471, -26696,
+	-26775, -26695, -26467, -26123, -25715, -25304, -24953, -24716,
+	-24632, -24717, -24962, -25331, -25773, -26220, -26605, -26865,
+	-26958, -26863, -26589, -26171, -25669, -25157, -24714, -24411,
+	-24303, -24415, -24742, -25243, -25852, -26479, -27028, -27406,
+	-27543, -27399, -26975, -26315, -25502, -24651, -23894, -23362,
+	-23166, -23378, -24018, -25041, -26340, -27747, -29049, -30005,
+	-30375, -29939, -28529, -26044, -22469, -17879, -12436, -6379,
+	0, 6379, 12436, 17879, 22469, 26044, 28529, 29939,
+	30375, 30005, 29049, 27747, 26340, 25041, 24018, 23378,
+	23166, 23362, 23894, 24651, 25502, 26315, 26975, 27399,
+	27543, 27406, 27028, 26479, 25852, 25243, 24742, 24415,
+	24303, 24411, 24714, 25157, 25669, 26171, 26589, 26863,
+	26958, 26865, 26605, 26220, 25773, 25331, 24962, 24717,
+	24632, 24716, 24953, 25304, 25715, 26123, 26467, 26695,
+	26775, 26696, 26471, 26136, 25741, 25348, 25015, 24793,
+	24715, 24793, 25015, 25348, 25741, 26136, 26471, 26696,
+	26775, 26695, 26467, 26123, 25715, 25304, 24953, 24716,
+	24632, 24717, 24962, 25331, 25773, 26220, 26605, 26865,
+	26958, 26863, 26589, 26171, 25669, 25157, 24714, 24411,
+	24303, 24415, 24742, 25243, 25852, 26479, 27028, 27406,
+	27543, 27399, 26975, 26315, 25502, 24651, 23894, 23362,
+	23166, 23378, 24018, 25041, 26340, 27747, 29049, 30005,
+	30375, 29939, 28529, 26044, 22469, 17879, 12436, 6379,
+	0, -6379, -12436, -17879, -22469, -26044, -28529, -29939,
+	-30375, -30005, -29049, -27747, -26340, -25041, -24018, -23378,
+	-23166, -23362, -23894, -24651, -25502, -26315, -26975, -27399,
+	-27543, -27406, -27028, -26479, -25852, -25243, -24742, -24415,
+	-24303, -24411, -24714, -25157, -25669, -26171, -26589, -26863,
+	-26958, -26865, -26605, -26220, -25773, -25331, -24962, -24717,
+	-24632, -24716, -24953, -25304, -25715, -26123, -26467, -26695,
+	-26775, -26696, -26471, -26136, -25741, -25348, -25015, -24793,
+	-24715,
+
+	/* Level 7: 256 samples, 8 harmonics */
+	-23717, -23756, -23873, -24063, -24318, -24631, -24988, -25377,
+	-25783, -26192, -26587, -26953, -27276, -27543, -27743, -27867,
+	-27910, -27867, -27739, -27528, -27241, -26887, -26477, -26025,
+	-25549, -25064, -24590, -24145, -23748, -23415, -23163, -23004,
+	-22949, -23006, -23177, -23463, -23859, -24356, -24941, -25597,
+	-26303, -27036, -27768, -28471, -29115, -29667, -30098, -30377,
+	-30476, -30369, -30033, -29450, -28605, -27489, -26097, -24432,
+	-22501, -20315, -17894, -15260, -12441, -9469, -6380, -3210,
+	0, 3210, 6380, 9469, 12441, 15260, 17894, 20315,
+	22501, 24432, 26097, 27489, 28605, 29450, 30033, 30369,
+	30476, 30377, 30098, 29667, 29115, 28471, 27768, 27036,
+	26303, 25597, 24941, 24356, 23859, 23463, 23177, 23006,
+	22949, 23004, 23163, 23415, 23748, 24145, 24590, 25064,
+	25549, 26025, 26477, 26887, 27241, 27528, 27739, 27867,
+	27910, 27867, 27743, 27543, 27276, 26953, 26587, 26192,
+	25783, 25377, 24988, 24631, 24318, 24063, 23873, 23756,
+	23717, 23756, 23873, 24063, 24318, 24631, 24988, 25377,
+	25783, 26192, 26587, 26953, 27276, 27543, 27743, 27867,
+	27910, 27867, 27739, 27528, 27241, 26887, 26477, 26025,
+	25549, 25064, 24590, 24145, 23748, 23415, 23163, 23004,
+	22949, 23006, 23177, 23463, 23859, 24356, 24941, 25597,
+	26303, 27036, 27768, 28471, 29115, 29667, 30098, 30377,
+	30476, 30369, 30033, 29450, 28605, 27489, 26097, 24432,
+	22501, 20315, 17894, 15260, 12441, 9469, 6380, 3210,
+	0, -3210, -6380, -9469, -12441, -15260, -17894, -20315,
+	-22501, -24432, -26097, -27489, -28605, -29450, -30033, -30369,
+	-30476, -30377, -30098, -29667, -29115, -28471, -27768, -27036,
+	-26303, -25597, -24941, -24356, -23859, -23463, -23177, -23006,
+	-22949, -23004, -23163, -23415, -23748, -24145, -24590, -25064,
+	-25549, -26025, -26477, -26887, -27241, -27528, -27739, -27867,
+	-27910, -27867, -27743, -27543, -27276, -26953, -26587, -26192,
+	-25783, -25377, -24988, -24631, -24318, -24063, -23873, -23756,
+	-23717,
+
+	/* Level 8: 256 samples, 4 harmonics */
+	-21845, -21864, -21923, -22021, -22157, -22330, -22539, -22781,
+	-23056, -23360, -23692, -24049, -24427, -24824, -25236, -25661,
+	-26093, -26530, -26967, -27401, -27827, -28242, -28641, -29020,
+	-29376, -29703, -29998, -30258, -30478, -30655, -30785, -30866,
+	-30893, -30865, -30778, -30630, -30420, -30145, -29803, -29394,
+	-28917, -28370, -27755, -27070, -26316, -25494, -24605, -23650,
+	-22630, -21549, -20407, -19208, -17955, -16650, -15297, -13899,
+	-12461, -10986, -9478, -7942, -6382, -4804, -3210, -1608,
+	0, 1608, 3210, 4804, 6382, 7942, 9478, 10986,
+	12461, 13899, 15297, 16650, 17955, 19208, 20407, 21549,
+	22630, 23650, 24605, 25494, 26316, 27070, 27755, 28370,
+	28917, 29394, 29803, 30145, 30420, 30630, 30778, 30865,
+	30893, 30866, 30785, 30655, 30478, 30258, 29998, 29703,
+	29376, 29020, 28641, 28242, 27827, 27401, 26967, 26530,
+	26093, 25661, 25236, 24824, 24427, 24049, 23692, 23360,
+	23056, 22781, 22539, 22330, 22157, 22021, 21923, 21864,
+	21845, 21864, 21923, 22021, 22157, 22330, 22539, 22781,
+	23056, 23360, 23692, 24049, 24427, 24824, 25236, 25661,
+	26093, 26530, 26967, 27401, 27827, 28242, 28641, 29020,
+	29376, 29703, 29998, 30258, 30478, 30655, 30785, 30866,
+	30893, 30865, 30778, 30630, 30420, 30145, 29803, 29394,
+	28917, 28370, 27755, 27070, 26316, 25494, 24605, 23650,
+	22630, 21549, 20407, 19208, 17955, 16650, 15297, 13899,
+	12461, 10986, 9478, 7942, 6382, 4804, 3210, 1608,
+	0, -1608, -3210, -4804, -6382, -7942, -9478, -10986,
+	-12461, -13899, -15297, -16650, -17955, -19208, -20407, -21549,
+	-22630, -23650, -24605, -25494, -26316, -27070, -27755, -28370,
+	-28917, -29394, -29803, -30145, -30420, -30630, -30778, -30865,
+	-30893, -30866, -30785, -30655, -30478, -30258, -29998, -29703,
+	-29376, -29020, -28641, -28242, -27827, -27401, -26967, -26530,
+	-26093, -25661, -25236, -24824, -24427, -24049, -23692, -23360,
+	-23056, -22781, -22539, -22330, -22157, -22021, -21923, -21864,
+	-21845,
+
+	/* Level 9: 256 samples, 2 harmonics */
+	-32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285,
+	-32137, -31971, -31785, -31580, -31356, -31113, -30852, -30571,
+	-30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683,
+	-27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731,
+	-23170, -22594, -22005, -21403, -20787, -20159, -19519, -18868,
+	-18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+	-12539, -11793, -11039, -10278, -9512, -8739, -7962, -7179,
+	-6393, -5602, -4808, -4011, -3212, -2410, -1608, -804,
+	0, 804, 1608, 2410, 3212, 4011, 4808, 5602,
+	6393, 7179, 7962, 8739, 9512, 10278, 11039, 11793,
+	12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530,
+	18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+	23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790,
+	27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+	30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971,
+	32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+	32767, 32757, 32728, 32678, 32609, 32521, 32412, 32285,
+	32137, 31971, 31785, 31580, 31356, 31113, 30852, 30571,
+	30273, 29956, 29621, 29268, 28898, 28510, 28105, 27683,
+	27245, 26790, 26319, 25832, 25329, 24811, 24279, 23731,
+	23170, 22594, 22005, 21403, 20787, 20159, 19519, 18868,
+	18204, 17530, 16846, 16151, 15446, 14732, 14010, 13279,
+	12539, 11793, 11039, 10278, 9512, 8739, 7962, 7179,
+	6393, 5602, 4808, 4011, 3212, 2410, 1608, 804,
+	0, -804, -1608, -2410, -3212, -4011, -4808, -5602,
+	-6393, -7179, -7962, -8739, -9512, -10278, -11039, -11793,
+	-12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530,
+	-18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594,
+	-23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790,
+	-27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956,
+	-30273, -30571, -30852, -31113, -31356, -31580, -31785, -31971,
+	-32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+	-32767,
+
+	/* Level 10: 256 samples, 1 harmonics */
+	-32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285,
+	-32137, -31971, -31785, -31580, -31356, -31113, -30852, -30571,
+	-30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683,
+	-27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731,
+	-23170, -22594, -22005, -21403, -20787, -20159, -19519, -18868,
+	-18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+	-12539, -11793, -11039, -10278, -9512, -8739, -7962, -7179,
+	-6393, -5602, -4808, -4011, -3212, -2410, -1608, -804,
+	0, 804, 1608, 2410, 3212, 4011, 4808, 5602,
+	6393, 7179, 7962, 8739, 9512, 10278, 11039, 11793,
+	12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530,
+	18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+	23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790,
+	27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+	30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971,
+	32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+	32767, 32757, 32728, 32678, 32609, 32521, 32412, 32285,
+	32137, 31971, 31785, 31580, 31356, 31113, 30852, 30571,
+	30273, 29956, 29621, 29268, 28898, 28510, 28105, 27683,
+	27245, 26790, 26319, 25832, 25329, 24811, 24279, 23731,
+	23170, 22594, 22005, 21403, 20787, 20159, 19519, 18868,
+	18204, 17530, 16846, 16151, 15446, 14732, 14010, 13279,
+	12539, 11793, 11039, 10278, 9512, 8739, 7962, 7179,
+	6393, 5602, 4808, 4011, 3212, 2410, 1608, 804,
+	0, -804, -1608, -2410, -3212, -4011, -4808, -5602,
+	-6393, -7179, -7962, -8739, -9512, -10278, -11039, -11793,
+	-12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530,
+	-18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594,
+	-23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790,
+	-27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956,
+	-30273, -30571, -30852, -31113, -31356, -31580, -31785, -31971,
+	-32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+	-32767,
+
+	/* Level 11: 256 samples, 1 harmonics */
+	-32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285,
+	-32137, -31971, -31785, -31580, -31356, -31113, -30852, -30571,
+	-30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683,
+	-27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731,
+	-23170, -22594, -22005, -21403, -20787, -20159, -19519, -18868,
+	-18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+	-12539, -11793, -11039, -10278, -9512, -8739, -7962, -7179,
+	-6393, -5602, -4808, -4011, -3212, -2410, -1608, -804,
+	0, 804, 1608, 2410, 3212, 4011, 4808, 5602,
+	6393, 7179, 7962, 8739, 9512, 10278, 11039, 11793,
+	12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530,
+	18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+	23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790,
+	27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+	30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971,
+	32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+	32767, 32757, 32728, 32678, 32609, 32521, 32412, 32285,
+	32137, 31971, 31785, 31580, 31356, 31113, 30852, 30571,
+	30273, 29956, 29621, 29268, 28898, 28510, 28105, 27683,
+	27245, 26790, 26319, 25832, 25329, 24811, 24279, 23731,
+	23170, 22594, 22005, 21403, 20787, 20159, 19519, 18868,
+	18204, 17530, 16846, 16151, 15446, 14732, 14010, 13279,
+	12539, 11793, 11039, 10278, 9512, 8739, 7962, 7179,
+	6393, 5602, 4808, 4011, 3212, 2410, 1608, 804,
+	0, -804, -1608, -2410, -3212, -4011, -4808, -5602,
+	-6393, -7179, -7962, -8739, -9512, -10278, -11039, -11793,
+	-12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530,
+	-18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594,
+	-23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790,
+	-27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956,
+	-30273, -30571, -30852, -31113, -31356, -31580, -31785, -31971,
+	-32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+	-32767,
+};
+
+static const wave_sample_t wave_sin[WAVE_LEN + 1] =
+{
+	/* All levels: 2048 samples */
+	-32767, -32767, -32766, -32766, -32765, -32763, -32761, -32759,
+	-32757, -32755, -32752, -32748, -32745, -32741, -32737, -32732,
+	-32728, -32722, -32717, -32711, -32705, -32699, -32692, -32685,
+	-32678, -32671, -32663, -32655, -32646, -32637, -32628, -32619,
+	-32609, -32599, -32589, -32578, -32567, -32556, -32545, -32533,
+	-32521, -32508, -32495, -32482, -32469, -32455, -32441, -32427,
+	-32412, -32397, -32382, -32367, -32351, -32335, -32318, -32302,
+	-32285, -32267, -32250, -32232, -32213, -32195, -32176, -32157,
+	-32137, -32118, -32098, -32077, -32057, -32036, -32014, -31993,
+	-31971, -31949, -31926, -31903, -31880, -31857, -31833, -31809,
+	-31785, -31760, -31736, -31710, -31685, -31659, -31633, -31607,
+	-31580, -31553, -31526, -31498, -31470, -31442, -31414, -31385,
+	-31356, -31327, -31297, -31267, -31237, -31206, -31176, -31145,
+	-31113, -31082, -31050, -31017, -30985, -30952, -30919, -30885,
+	-30852, -30818, -30783, -30749, -30714, -30679, -30643, -30607,
+	-30571, -30535, -30498, -30462, -30424, -30387, -30349, -30311,
+	-30273, -30234, -30195, -30156, -30117, -30077, -30037, -29997,
+	-29956, -29915, -29874, -29832, -29791, -29749, -29706, -29664,
+	-29621, -29578, -29534, -29491, -29447, -29403, -29358, -29313,
+	-29268, -29223, -29177, -29131, -29085, -29039, -28992, -28945,
+	-28898, -28850, -28803, -28755, -28706, -28658, -28609, -28560,
+	-28510, -28460, -28411, -28360, -28310, -28259, -28208, -28157,
+	-28105, -28053, -28001, -27949, -27896, -27843, -27790, -27737,
+	-27683, -27629, -27575, -27521, -27466, -27411, -27356, -27300,
+	-27245, -27189, -27133, -27076, -27019, -26962, -26905, -26848,
+	-26790, -26732, -26674, -26615, -26556, -26497, -26438, -26378,
+	-26319, -26259, -26198, -26138, -26077, -26016, -25955, -25893,
+	-25832, -25770, -25708, -25645, -25582, -25519, -25456, -25393,
+	-25329, -25265, -25201, -25137, -25072, -25007, -24942, -24877,
+	-24811, -24746, -24680, -24613, -24547, -24480, -24413, -24346,
+	-24279, -24211, -24143, -24075, -24007, -23938, -23870, -23801,
+	-23731, -23662, -23592, -23522, -23452, -23382, -23311, -23241,
+	-23170, -23099, -23027, -22956, -22884, -22812, -22739, -22667,
+	-22594, -22521, -22448, -22375, -22301, -22227, -22154, -22079,
+	-22005, -21930, -21856, -21781, -21705, -21630, -21554, -21479,
+	-21403, -21326, -21250, -21173, -21096, -21019, -20942, -20865,
+	-20787, -20709, -20631, -20553, -20475, -20396, -20317, -20238,
+	-20159, -20080, -20000, -19921, -19841, -19761, -19680, -19600,
+	-19519, -19438, -19357, -19276, -19195, -19113, -19032, -18950,
+	-18868, -18785, -18703, -18620, -18537, -18454, -18371, -18288,
+	-18204, -18121, -18037, -17953, -17869, -17784, -17700, -17615,
+	-17530, -17445, -17360, -17275, -17189, -17104, -17018, -16932,
+	-16846, -16759, -16673, -16586, -16499, -16413, -16325, -16238,
+	-16151, -16063, -15976, -15888, -15800, -15712, -15623, -15535,
+	-15446, -15358, -15269, -15180, -15090, -15001, -14912, -14822,
+	-14732, -14643, -14553, -14462, -14372, -14282, -14191, -14101,
+	-14010, -13919, -13828, -13736, -13645, -13554, -13462, -13370,
+	-13279, -13187, -13094, -13002, -12910, -12817, -12725, -12632,
+	-12539, -12446, -12353, -12260, -12167, -12074, -11980, -11886,
+	-11793, -11699, -11605, -11511, -11417, -11322, -11228, -11133,
+	-11039, -10944, -10849, -10754, -10659, -10564, -10469, -10374,
+	-10278, -10183, -10087, -9992, -9896, -9800, -9704, -9608,
+	-9512, -9416, -9319, -9223, -9126, -9030, -8933, -8836,
+	-8739, -8642, -8545, -8448, -8351, -8254, -8157, -8059,
+	-7962, -7864, -7767, -7669, -7571, -7473, -7375, -7277,
+	-7179, -7081, -6983, -6885, -6786, -6688, -6590, -6491,
+	-6393, -6294, -6195, -6096, -5998, -5899, -5800, -5701,
+	-5602, -5503, -5404, -5305, -5205, -5106, -5007, -4907,
+	-4808, -4708, -4609, -4509, -4410, -4310, -4210, -4111,
+	-4011, -3911, -3811, -3712, -3612, -3512, -3412, -3312,
+	-3212, -3112, -3012, -2911, -2811, -2711, -2611, -2511,
+	-2410, -2310, -2210, -2110, -2009, -1909, -1809, -1708,
+	-1608, -1507, -1407, -1307, -1206, -1106, -1005, -905,
+	-804, -704, -603, -503, -402, -302, -201, -101,
+	0, 101, 201, 302, 402, 503, 603, 704,
+	804, 905, 1005, 1106, 1206, 1307, 1407, 1507,
+	1608, 1708, 1809, 1909, 2009, 2110, 2210, 2310,
+	2410, 2511, 2611, 2711, 2811, 2911, 3012, 3112,
+	3212, 3312, 3412, 3512, 3612, 3712, 3811, 3911,
+	4011, 4111, 4210, 4310, 4410, 4509, 4609, 4708,
+	4808, 4907, 5007, 5106, 5205, 5305, 5404, 5503,
+	5602, 5701, 5800, 5899, 5998, 6096, 6195, 6294,
+	6393, 6491, 6590, 6688, 6786, 6885, 6983, 7081,
+	7179, 7277, 7375, 7473, 7571, 7669, 7767, 7864,
+	7962, 8059, 8157, 8254, 8351, 8448, 8545, 8642,
+	8739, 8836, 8933, 9030, 9126, 9223, 9319, 9416,
+	9512, 9608, 9704, 9800, 9896, 9992, 10087, 10183,
+	10278, 10374, 10469, 10564, 10659, 10754, 10849, 10944,
+	11039, 11133, 11228, 11322, 11417, 11511, 11605, 11699,
+	11793, 11886, 11980, 12074, 12167, 12260, 12353, 12446,
+	12539, 12632, 12725, 12817, 12910, 13002, 13094, 13187,
+	13279, 13370, 13462, 13554, 13645, 13736, 13828, 13919,
+	14010, 14101, 14191, 14282, 14372, 14462, 14553, 14643,
+	14732, 14822, 14912, 15001, 15090, 15180, 15269, 15358,
+	15446, 15535, 15623, 15712, 15800, 15888, 15976, 16063,
+	16151, 16238, 16325, 16413, 16499, 16586, 16673, 16759,
+	16846, 16932, 17018, 17104, 17189, 17275, 17360, 17445,
+	17530, 17615, 17700, 17784, 17869, 17953, 18037, 18121,
+	18204, 18288, 18371, 18454, 18537, 18620, 18703, 18785,
+	18868, 18950, 19032, 19113, 19195, 19276, 19357, 19438,
+	19519, 19600, 19680, 19761, 19841, 19921, 20000, 20080,
+	20159, 20238, 20317, 20396, 20475, 20553, 20631, 20709,
+	20787, 20865, 20942, 21019, 21096, 21173, 21250, 21326,
+	21403, 21479, 21554, 21630, 21705, 21781, 21856, 21930,
+	22005, 22079, 22154, 22227, 22301, 22375, 22448, 22521,
+	22594, 22667, 22739, 22812, 22884, 22956, 23027, 23099,
+	23170, 23241, 23311, 23382, 23452, 23522, 23592, 23662,
+	23731, 23801, 23870, 23938, 24007, 24075, 24143, 24211,
+	24279, 24346, 24413, 24480, 24547, 24613, 24680, 24746,
+	24811, 24877, 24942, 25007, 25072, 25137, 25201, 25265,
+	25329, 25393, 25456, 25519, 25582, 25645, 25708, 25770,
+	25832, 25893, 25955, 26016, 26077, 26138, 26198, 26259,
+	26319, 26378, 26438, 26497, 26556, 26615, 26674, 26732,
+	26790, 26848, 26905, 26962, 27019, 27076, 27133, 27189,
+	27245, 27300, 27356, 27411, 27466, 27521, 27575, 27629,
+	27683, 27737, 27790, 27843, 27896, 27949, 28001, 28053,
+	28105, 28157, 28208, 28259, 28310, 28360, 28411, 28460,
+	28510, 28560, 28609, 28658, 28706, 28755, 28803, 28850,
+	28898, 28945, 28992, 29039, 29085, 29131, 29177, 29223,
+	29268, 29313, 29358, 29403, 29447, 29491, 29534, 29578,
+	29621, 29664, 29706, 29749, 29791, 29832, 29874, 29915,
+	29956, 29997, 30037, 30077, 30117, 30156, 30195, 30234,
+	30273, 30311, 30349, 30387, 30424, 30462, 30498, 30535,
+	30571, 30607, 30643, 30679, 30714, 30749, 30783, 30818,
+	30852, 30885, 30919, 30952, 30985, 31017, 31050, 31082,
+	31113, 31145, 31176, 31206, 31237, 31267, 31297, 31327,
+	31356, 31385, 31414, 31442, 31470, 31498, 31526, 31553,
+	31580, 31607, 31633, 31659, 31685, 31710, 31736, 31760,
+	31785, 31809, 31833, 31857, 31880, 31903, 31926, 31949,
+	31971, 31993, 32014, 32036, 32057, 32077, 32098, 32118,
+	32137, 32157, 32176, 32195, 32213, 32232, 32250, 32267,
+	32285, 32302, 32318, 32335, 32351, 32367, 32382, 32397,
+	32412, 32427, 32441, 32455, 32469, 32482, 32495, 32508,
+	32521, 32533, 32545, 32556, 32567, 32578, 32589, 32599,
+	32609, 32619, 32628, 32637, 32646, 32655, 32663, 32671,
+	32678, 32685, 32692, 32699, 32705, 32711, 32717, 32722,
+	32728, 32732, 32737, 32741, 32745, 32748, 32752, 32755,
+	32757, 32759, 32761, 32763, 32765, 32766, 32766, 32767,
+	32767, 32767, 32766, 32766, 32765, 32763, 32761, 32759,
+	32757, 32755, 32752, 32748, 32745, 32741, 32737, 32732,
+	32728, 32722, 32717, 32711, 32705, 32699, 32692, 32685,
+	32678, 32671, 32663, 32655, 32646, 32637, 32628, 32619,
+	32609, 32599, 32589, 32578, 32567, 32556, 32545, 32533,
+	32521, 32508, 32495, 32482, 32469, 32455, 32441, 32427,
+	32412, 32397, 32382, 32367, 32351, 32335, 32318, 32302,
+	32285, 32267, 32250, 32232, 32213, 32195, 32176, 32157,
+	32137, 32118, 32098, 32077, 32057, 32036, 32014, 31993,
+	31971, 31949, 31926, 31903, 31880, 31857, 31833, 31809,
+	31785, 31760, 31736, 31710, 31685, 31659, 31633, 31607,
+	31580, 31553, 31526, 31498, 31470, 31442, 31414, 31385,
+	31356, 31327, 31297, 31267, 31237, 31206, 31176, 31145,
+	31113, 31082, 31050, 31017, 30985, 30952, 30919, 30885,
+	30852, 30818, 30783, 30749, 30714, 30679, 30643, 30607,
+	30571, 30535, 30498, 30462, 30424, 30387, 30349, 30311,
+	30273, 30234, 30195, 30156, 30117, 30077, 30037, 29997,
+	29956, 29915, 29874, 29832, 29791, 29749, 29706, 29664,
+	29621, 29578, 29534, 29491, 29447, 29403, 29358, 29313,
+	29268, 29223, 29177, 29131, 29085, 29039, 28992, 28945,
+	28898, 28850, 28803, 28755, 28706, 28658, 28609, 28560,
+	28510, 28460, 28411, 28360, 28310, 28259, 28208, 28157,
+	28105, 28053, 28001, 27949, 27896, 27843, 27790, 27737,
+	27683, 27629, 27575, 27521, 27466, 27411, 27356, 27300,
+	27245, 27189, 27133, 27076, 27019, 26962, 26905, 26848,
+	26790, 26732, 26674, 26615, 26556, 26497, 26438, 26378,
+	26319, 26259, 26198, 26138, 26077, 26016, 25955, 25893,
+	25832, 25770, 25708, 25645, 25582, 25519, 25456, 25393,
+	25329, 25265, 25201, 25137, 25072, 25007, 24942, 24877,
+	24811, 24746, 24680, 24613, 24547, 24480, 24413, 24346,
+	24279, 24211, 24143, 24075, 24007, 23938, 23870, 23801,
+	23731, 23662, 23592, 23522, 23452, 23382, 23311, 23241,
+	23170, 23099, 23027, 22956, 22884, 22812, 22739, 22667,
+	22594, 22521, 22448, 22375, 22301, 22227, 22154, 22079,
+	22005, 21930, 21856, 21781, 21705, 21630, 21554, 21479,
+	21403, 21326, 21250, 21173, 21096, 21019, 20942, 20865,
+	20787, 20709, 20631, 20553, 20475, 20396, 20317, 20238,
+	20159, 20080, 20000, 19921, 19841, 19761, 19680, 19600,
+	19519, 19438, 19357, 19276, 19195, 19113, 19032, 18950,
+	18868, 18785, 18703, 18620, 18537, 18454, 18371, 18288,
+	18204, 18121, 18037, 17953, 17869, 17784, 17700, 17615,
+	17530, 17445, 17360, 17275, 17189, 17104, 17018, 16932,
+	16846, 16759, 16673, 16586, 16499, 16413, 16325, 16238,
+	16151, 16063, 15976, 15888, 15800, 15712, 15623, 15535,
+	15446, 15358, 15269, 15180, 15090, 15001, 14912, 14822,
+	14732, 14643, 14553, 14462, 14372, 14282, 14191, 14101,
+	14010, 13919, 13828, 13736, 13645, 13554, 13462, 13370,
+	13279, 13187, 13094, 13002, 12910, 12817, 12725, 12632,
+	12539, 12446, 12353, 12260, 12167, 12074, 11980, 11886,
+	11793, 11699, 11605, 11511, 11417, 11322, 11228, 11133,
+	11039, 10944, 10849, 10754, 10659, 10564, 10469, 10374,
+	10278, 10183, 10087, 9992, 9896, 9800, 9704, 9608,
+	9512, 9416, 9319, 9223, 9126, 9030, 8933, 8836,
+	8739, 8642, 8545, 8448, 8351, 8254, 8157, 8059,
+	7962, 7864, 7767, 7669, 7571, 7473, 7375, 7277,
+	7179, 7081, 6983, 6885, 6786, 6688, 6590, 6491,
+	6393, 6294, 6195, 6096, 5998, 5899, 5800, 5701,
+	5602, 5503, 5404, 5305, 5205, 5106, 5007, 4907,
+	4808, 4708, 4609, 4509, 4410, 4310, 4210, 4111,
+	4011, 3911, 3811, 3712, 3612, 3512, 3412, 3312,
+	3212, 3112, 3012, 2911, 2811, 2711, 2611, 2511,
+	2410, 2310, 2210, 2110, 2009, 1909, 1809, 1708,
+	1608, 1507, 1407, 1307, 1206, 1106, 1005, 905,
+	804, 704, 603, 503, 402, 302, 201, 101,
+	0, -101, -201, -302, -402, -503, -603, -704,
+	-804, -905, -1005, -1106, -1206, -1307, -1407, -1507,
+	-1608, -1708, -1809, -1909, -2009, -2110, -2210, -2310,
+	-2410, -2511, -2611, -2711, -2811, -2911, -3012, -3112,
+	-3212, -3312, -3412, -3512, -3612, -3712, -3811, -3911,
+	-4011, -4111, -4210, -4310, -4410, -4509, -4609, -4708,
+	-4808, -4907, -5007, -5106, -5205, -5305, -5404, -5503,
+	-5602, -5701, -5800, -5899, -5998, -6096, -6195, -6294,
+	-6393, -6491, -6590, -6688, -6786, -6885, -6983, -7081,
+	-7179, -7277, -7375, -7473, -7571, -7669, -7767, -7864,
+	-7962, -8059, -8157, -8254, -8351, -8448, -8545, -8642,
+	-8739, -8836, -8933, -9030, -9126, -9223, -9319, -9416,
+	-9512, -9608, -9704, -9800, -9896, -9992, -10087, -10183,
+	-10278, -10374, -10469, -10564, -10659, -10754, -10849, -10944,
+	-11039, -11133, -11228, -11322, -11417, -11511, -11605, -11699,
+	-11793, -11886, -11980, -12074, -12167, -12260, -12353, -12446,
+	-12539, -12632, -12725, -12817, -12910, -13002, -13094, -13187,
+	-13279, -13370, -13462, -13554, -13645, -13736, -13828, -13919,
+	-14010, -14101, -14191, -14282, -14372, -14462, -14553, -14643,
+	-14732, -14822, -14912, -15001, -15090, -15180, -15269, -15358,
+	-15446, -15535, -15623, -15712, -15800, -15888, -15976, -16063,
+	-16151, -16238, -16325, -16413, -16499, -16586, -16673, -16759,
+	-16846, -16932, -17018, -17104, -17189, -17275, -17360, -17445,
+	-17530, -17615, -17700, -17784, -17869, -17953, -18037, -18121,
+	-18204, -18288, -18371, -18454, -18537, -18620, -18703, -18785,
+	-18868, -18950, -19032, -19113, -19195, -19276, -19357, -19438,
+	-19519, -19600, -19680, -19761, -19841, -19921, -20000, -20080,
+	-20159, -20238, -20317, -20396, -20475, -20553, -20631, -20709,
+	-20787, -20865, -20942, -21019, -21096, -21173, -21250, -21326,
+	-21403, -21479, -21554, -21630, -21705, -21781, -21856, -21930,
+	-22005, -22079, -22154, -22227, -22301, -22375, -22448, -22521,
+	-22594, -22667, -22739, -22812, -22884, -22956, -23027, -23099,
+	-23170, -23241, -23311, -23382, -23452, -23522, -23592, -23662,
+	-23731, -23801, -23870, -23938, -24007, -24075, -24143, -24211,
+	-24279, -24346, -24413, -24480, -24547, -24613, -24680, -24746,
+	-24811, -24877, -24942, -25007, -25072, -25137, -25201, -25265,
+	-25329, -25393, -25456, -25519, -25582, -25645, -25708, -25770,
+	-25832, -25893, -25955, -26016, -26077, -26138, -26198, -26259,
+	-26319, -26378, -26438, -26497, -26556, -26615, -26674, -26732,
+	-26790, -26848, -26905, -26962, -27019, -27076, -27133, -27189,
+	-27245, -27300, -27356, -27411, -27466, -27521, -27575, -27629,
+	-27683, -27737, -27790, -27843, -27896, -27949, -28001, -28053,
+	-28105, -28157, -28208, -28259, -28310, -28360, -28411, -28460,
+	-28510, -28560, -28609, -28658, -28706, -28755, -28803, -28850,
+	-28898, -28945, -28992, -29039, -29085, -29131, -29177, -29223,
+	-29268, -29313, -29358, -29403, -29447, -29491, -29534, -29578,
+	-29621, -29664, -29706, -29749, -29791, -29832, -29874, -29915,
+	-29956, -29997, -30037, -30077, -30117, -30156, -30195, -30234,
+	-30273, -30311, -30349, -30387, -30424, -30462, -30498, -30535,
+	-30571, -30607, -30643, -30679, -30714, -30749, -30783, -30818,
+	-30852, -30885, -30919, -30952, -30985, -31017, -31050, -31082,
+	-31113, -31145, -31176, -31206, -31237, -31267, -31297, -31327,
+	-31356, -31385, -31414, -31442, -31470, -31498, -31526, -31553,
+	-31580, -31607, -31633, -31659, -31685, -31710, -31736, -31760,
+	-31785, -31809, -31833, -31857, -31880, -31903, -31926, -31949,
+	-31971, -31993, -32014, -32036, -32057, -32077, -32098, -32118,
+	-32137, -32157, -32176, -32195, -32213, -32232, -32250, -32267,
+	-32285, -32302, -32318, -32335, -32351, -32367, -32382, -32397,
+	-32412, -32427, -32441, -32455, -32469, -32482, -32495, -32508,
+	-32521, -32533, -32545, -32556, -32567, -32578, -32589, -32599,
+	-32609, -32619, -32628, -32637, -32646, -32655, -32663, -32671,
+	-32678, -32685, -32692, -32699, -32705, -32711, -32717, -32722,
+	-32728, -32732, -32737, -32741, -32745, -32748, -32752, -32755,
+	-32757, -32759, -32761, -32763, -32765, -32766, -32766, -32767,
+	-32767,
+};
+
+const struct wavetable_s wavetables[WAVE_N_TYPES] =
+{
+	{	/* saw */
+		{	&wave_saw[0], &wave_saw[2049], &wave_saw[4098], &wave_saw[5123],
+			&wave_saw[5636], &wave_saw[5893], &wave_saw[6150], &wave_saw[6407],
+			&wave_saw[6664], &wave_saw[6921], &wave_saw[7178], &wave_saw[7435]	},
+		{	21, 21, 22, 23, 24, 24, 24, 24, 24, 24, 24, 24	}
+	},
+	{	/* tri */
+		{	&wave_tri[0], &wave_tri[2049], &wave_tri[4098], &wave_tri[5123],
+			&wave_tri[5636], &wave_tri[5893], &wave_tri[6150], &wave_tri[6407],
+			&wave_tri[6664], &wave_tri[6921], &wave_tri[7178], &wave_tri[7435]	},
+		{	21, 21, 22, 23, 24, 24, 24, 24, 24, 24, 24, 24	}
+	},
+	{	/* squ */
+		{	&wave_squ[0], &wave_squ[2049], &wave_squ[4098], &wave_squ[5123],
+			&wave_squ[5636], &wave_squ[5893], &wave_squ[6150], &wave_squ[6407],
+			&wave_squ[6664], &wave_squ[6921], &wave_squ[7178], &wave_squ[7435]	},
+		{	21, 21, 22, 23, 24, 24, 24, 24, 24, 24, 24, 24	}
+	},
+	{	/* sin */
+		{	&wave_sin[0], &wave_sin[0], &wave_sin[0], &wave_sin[0],
+			&wave_sin[0], &wave_sin[0], &wave_sin[0], &wave_sin[0],
+			&wave_sin[0], &wave_sin[0], &wave_sin[0], &wave_sin[0]	},
+		{	21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21	}
+	}
+};
+
+const dv_u32_t wave_incr[WAVE_N_NOTES] =
+{	731558u, 775059u, 821146u, 869974u, 921705u, 976513u, 1034579u, 1096099u,
+	1161276u, 1230329u, 1303488u, 1380998u, 1463116u, 1550118u, 1642292u, 1739948u,
+	1843411u, 1953026u, 2069159u, 2192197u, 2322552u, 2460658u, 2606977u, 2761996u,
+	2926232u, 3100235u, 3284585u, 3479896u, 3686822u, 3906052u, 4138318u, 4384395u,
+	4645104u, 4921317u, 5213953u, 5523991u, 5852465u, 6200470u, 6569170u, 6959793u,
+	7373644u, 7812103u, 8276635u, 8768789u, 9290209u, 9842633u, 10427907u, 11047982u,
+	11704930u, 12400941u, 13138339u, 13919586u, 14747287u, 15624207u, 16553270u, 17537579u,
+	18580418u, 19685267u, 20855814u, 22095965u, 23409859u, 24801882u, 26276679u, 27839171u,
+	29494575u, 31248413u, 33106541u, 35075158u, 37160835u, 39370534u, 41711627u, 44191930u,
+	46819719u, 49603764u, 52553357u, 55678342u, 58989149u, 62496826u, 66213081u, 70150316u,
+	74321671u, 78741067u, 83423255u, 88383859u, 93639437u, 99207528u, 105106715u, 111356685u,
+	117978298u, 124993653u, 132426162u, 140300631u, 148643341u, 157482134u, 166846509u, 176767719u,
+	187278874u, 198415056u, 210213429u, 222713370u, 235956596u, 249987305u, 264852324u, 280601263u,
+	297286682u, 314964268u, 333693018u, 353535438u, 374557749u, 396830112u, 420426858u, 445426740u,
+	471913192u, 499974611u, 529704648u, 561202526u, 594573365u, 629928537u, 667386037u, 707070876u,
+	749115498u, 793660223u, 840853716u, 890853480u, 943826385u, 999949222u, 1059409297u, 1122405052u,
+};